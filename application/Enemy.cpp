@@ -11,6 +11,7 @@
 #include "MathFunc4x4.h"
 #include "AffineTransformations.h"
 #include "Vector3.h"
+#include "FastMath.h"
 
 ///=============================================================================
 ///						初期化　
@@ -93,10 +94,11 @@ void Enemy::Move() {
     // プレイヤーへのベクトル
     Vector3 direction = playerPos - transform.translate;
     // 距離を取得
-    float distance = Length(direction);
+    // NOTE:向きの判定と距離の比較にしか使わないので近似で求める
+    float distance = FastMath::Length(direction);
 
     // ベクトルの正規化
-    direction = Normalize(direction);
+    direction = FastMath::Normalize(direction);
 
     /// ===八方向の移動ベクトル（45度ずつ）=== ///
     const std::vector<Vector3> directions = {
@@ -148,8 +150,8 @@ void Enemy::Move() {
     velocity_ = velocity_ + acceleration_;
 
     /// ===速度を最大速度で制限=== ///
-    if (Length(velocity_) > maxSpeed_) {
-    velocity_ = Normalize(velocity_) * maxSpeed_;
+    if (FastMath::Length(velocity_) > maxSpeed_) {
+    velocity_ = FastMath::Normalize(velocity_) * maxSpeed_;
     }
 
     /// ===速度を基に新しい位置を計算=== ///
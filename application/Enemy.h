@@ -20,7 +20,7 @@ public:
 	/// \brief 初期化
 	void Initialize(Object3d *object3d);
 
-	/// \brief 更新
+	/// \brief 更新(固定ステップ1回分。移動量などは1ステップあたりの値)
 	void Update(const Vector3& playerPos);
 
 	/// \brief 描画 
@@ -27,6 +27,16 @@ void Player::Initialize(Object3d *object3d) {
 	BaseObject::Initialize(transform.translate, 0.1f);
 }
 
+///=============================================================================
+///						入力の受付
+void Player::HandleInput() {
+	//========================================
+	// 押された瞬間の入力はフレームごとにしか取れないので、次のステップまで保持する
+	if(Input::GetInstance()->TriggerButton(Input::BUTTON_A)) {
+		isDodgeRequested = true;
+	}
+}
+
 ///=============================================================================
 ///						更新
 void Player::Update() {
@@ -49,8 +59,9 @@ void Player::Update() {
 		Dodge();
 	}
 	//コントローラーのボタン
-	if(Input::GetInstance()->TriggerButton(Input::BUTTON_A)) {
+	if(isDodgeRequested) {
 		Dodge();
+		isDodgeRequested = false;
 	}
 
 	//========================================
@@ -20,7 +20,10 @@ public:
 	/// \brief 初期化
 	void Initialize(Object3d *object3d);
 
-	/// \brief 更新
+	/// \brief 入力の受付(毎フレーム)
+	void HandleInput();
+
+	/// \brief 更新(固定ステップ1回分。移動量などは1ステップあたりの値)
 	void Update();
 
 	/// \brief 描画
@@ -105,6 +108,8 @@ private:
 	bool isDodge = false;
 	//回避クールタイム
 	int dodgeCoolTime = 0;
+	// 押された瞬間の回避入力(ステップが0回のフレームでも取りこぼさない)
+	bool isDodgeRequested = false;
 
 	//========================================
 	// ヒットフラグ
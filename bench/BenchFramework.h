@@ -0,0 +1,61 @@
+/*********************************************************************
+ * \file   BenchFramework.h
+ * \brief  ウィンドウとGPUを使わないエンジンのベンチマーク
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   BENCH_CASEで登録した関数をBenchMainで順に実行する。
+ *         結果は各ベンチマークが標準出力に書く(Releaseで実行すること)
+ *********************************************************************/
+#pragma once
+#include <chrono>
+#include <vector>
+
+///=============================================================================
+///						ベンチマーク
+namespace EngineBench {
+
+	/**----------------------------------------------------------------------------
+	 * \brief  BenchCase 登録されたベンチマーク
+	 */
+	struct BenchCase {
+		const char* name;
+		void (*function)();
+	};
+
+	/// \brief 登録されたベンチマークの取得
+	std::vector<BenchCase>& GetBenchCases();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Registrar 静的初期化でベンチマークを登録する
+	 */
+	struct Registrar {
+		Registrar(const char* name, void (*function)()) {
+			GetBenchCases().push_back({ name, function });
+		}
+	};
+
+	/**----------------------------------------------------------------------------
+	 * \brief  MeasureMilliseconds 処理を繰り返して1回あたりの時間を測る
+	 * \param  repeatCount 繰り返す回数
+	 * \param  function 測る処理
+	 * \return 1回あたりのミリ秒
+	 */
+	template<class Function>
+	double MeasureMilliseconds(int repeatCount, Function&& function) {
+		auto start = std::chrono::steady_clock::now();
+		for(int i = 0; i < repeatCount; ++i) {
+			function();
+		}
+		std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / repeatCount;
+	}
+}
+
+///=============================================================================
+///						登録
+// ベンチマークの登録(名前は実行ファイル全体で一意にする)
+#define BENCH_CASE(name) \
+	static void name(); \
+	static const EngineBench::Registrar name##Registrar_(#name, &name); \
+	static void name()
@@ -0,0 +1,33 @@
+/*********************************************************************
+ * \file   BenchMain.cpp
+ * \brief  登録されたベンチマークを実行する
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   引数を渡すと名前にその文字列を含むベンチマークだけを実行する
+ *********************************************************************/
+#include "BenchFramework.h"
+#include <cstdio>
+#include <string>
+
+///=============================================================================
+///						登録されたベンチマークの取得
+std::vector<EngineBench::BenchCase>& EngineBench::GetBenchCases() {
+	// 静的初期化の順番に依存しないよう関数内で持つ
+	static std::vector<BenchCase> benchCases;
+	return benchCases;
+}
+
+///=============================================================================
+///						エントリーポイント
+int main(int argc, char* argv[]) {
+	const std::string filter = argc > 1 ? argv[1] : "";
+	for(const EngineBench::BenchCase& benchCase : EngineBench::GetBenchCases()) {
+		if(!filter.empty() && std::string(benchCase.name).find(filter) == std::string::npos) {
+			continue;
+		}
+		std::printf("[%s]\n", benchCase.name);
+		benchCase.function();
+	}
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*********************************************************************
+ * \file   FastMathBench.cpp
+ * \brief  近似のsin・cos・逆平方根のベンチマーク
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   誤差が上限に収まるかはEngineTestのFastMathTestで確かめる
+ *********************************************************************/
+#include "BenchFramework.h"
+#include "FastMath.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+///=============================================================================
+///						標準関数との比較(1要素あたりの時間)
+BENCH_CASE(FastMathBench) {
+	const uint32_t kValueCount = 4096;
+	const int kRepeatCount = 100;
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> angle(-100.0f, 100.0f);
+	std::uniform_real_distribution<float> exponent(-20.0f, 20.0f);
+	std::vector<float> angles(kValueCount);
+	std::vector<float> values(kValueCount);
+	for(uint32_t i = 0; i < kValueCount; ++i) {
+		angles[i] = angle(random);
+		values[i] = std::exp(exponent(random));
+	}
+	std::vector<float> sinResults(kValueCount);
+	std::vector<float> cosResults(kValueCount);
+	std::vector<float> inverseSqrtResults(kValueCount);
+	auto measure = [&](auto operation) {
+		return EngineBench::MeasureMilliseconds(kRepeatCount, operation) * 1.0e6 / kValueCount;
+	};
+
+	double sinCosNanoseconds[2] = {};
+	double inverseSqrtNanoseconds[2] = {};
+	sinCosNanoseconds[0] = measure([&]() {
+		for(uint32_t i = 0; i < kValueCount; ++i) {
+			sinResults[i] = std::sin(angles[i]);
+			cosResults[i] = std::cos(angles[i]);
+		}
+	});
+	inverseSqrtNanoseconds[0] = measure([&]() {
+		for(uint32_t i = 0; i < kValueCount; ++i) {
+			inverseSqrtResults[i] = 1.0f / std::sqrt(values[i]);
+		}
+	});
+	sinCosNanoseconds[1] = measure([&]() { FastMath::SinCos(angles, sinResults, cosResults); });
+	inverseSqrtNanoseconds[1] = measure([&]() { FastMath::InverseSqrt(values, inverseSqrtResults); });
+
+	//========================================
+	// 倍精度の値との差
+	double sinCosMaxError = 0.0;
+	double inverseSqrtMaxError = 0.0;
+	for(uint32_t i = 0; i < kValueCount; ++i) {
+		sinCosMaxError = ( std::max )( sinCosMaxError, std::fabs(sinResults[i] - std::sin(static_cast<double>( angles[i] ))) );
+		sinCosMaxError = ( std::max )( sinCosMaxError, std::fabs(cosResults[i] - std::cos(static_cast<double>( angles[i] ))) );
+		double inverseSqrt = 1.0 / std::sqrt(static_cast<double>( values[i] ));
+		inverseSqrtMaxError = ( std::max )( inverseSqrtMaxError, std::fabs(inverseSqrtResults[i] - inverseSqrt) / inverseSqrt );
+	}
+
+	std::printf("  ns/value: SinCos %.2f (std %.2f, err %.1e), InverseSqrt %.2f (std %.2f, rel err %.1e)\n",
+		sinCosNanoseconds[1], sinCosNanoseconds[0], sinCosMaxError,
+		inverseSqrtNanoseconds[1], inverseSqrtNanoseconds[0], inverseSqrtMaxError);
+}
@@ -0,0 +1,51 @@
+/*********************************************************************
+ * \file   FrustumCullerBench.cpp
+ * \brief  視錐台カリングのベンチマーク
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "BenchFramework.h"
+#include "FrustumCuller.h"
+#include "RenderingMatrices.h"
+#include <cstdio>
+#include <random>
+
+///=============================================================================
+///						10万個のAABBを散らした場面(1つずつの判定とSoA+SSEの比較)
+BENCH_CASE(CullBench) {
+	const uint32_t kBoundsCount = 100000;
+	const int kCullCount = 10;
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+	std::uniform_real_distribution<float> size(0.1f, 3.0f);
+	std::vector<AABB> bounds(kBoundsCount);
+	for(AABB& aabb : bounds) {
+		Vector3 center = { position(random), position(random), position(random) };
+		float halfSize = size(random);
+		aabb = { center - Vector3{ halfSize, halfSize, halfSize }, center + Vector3{ halfSize, halfSize, halfSize } };
+	}
+	//原点から+Zを向くカメラ
+	Frustum frustum = Frustum::FromViewProjection(MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 100.0f));
+	FrustumCuller culler;
+	culler.Reserve(kBoundsCount);
+	for(const AABB& aabb : bounds) {
+		culler.Push(aabb);
+	}
+
+	std::vector<uint32_t> visibleIndices;
+	visibleIndices.reserve(kBoundsCount);
+	double scalarMilliseconds = EngineBench::MeasureMilliseconds(kCullCount, [&]() {
+		visibleIndices.clear();
+		for(uint32_t index = 0; index < kBoundsCount; ++index) {
+			if(frustum.Intersects(bounds[index])) {
+				visibleIndices.push_back(index);
+			}
+		}
+	});
+	double cullMilliseconds = EngineBench::MeasureMilliseconds(kCullCount, [&]() { culler.Cull(frustum); });
+
+	std::printf("  100k bounds: %.3fms (scalar %.3fms, %zu visible)\n",
+		cullMilliseconds, scalarMilliseconds, culler.GetVisibleIndices().size());
+}
@@ -0,0 +1,55 @@
+/*********************************************************************
+ * \file   LightClusterBench.cpp
+ * \brief  ライトのクラスタへの割り当てのベンチマーク
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   割り当てが総当たりの判定と一致するかはEngineTestのLightClusterTestで確かめる
+ *********************************************************************/
+#include "BenchFramework.h"
+#include "LightCluster.h"
+#include "MathFunc4x4.h"
+#include "RenderingMatrices.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <thread>
+
+///=============================================================================
+///						1024個のライトの割り当て(1スレッドと並列)
+BENCH_CASE(LightClusterBench) {
+	const uint32_t kLightCount = 1024;
+	const int kBuildCount = 10;
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+	std::uniform_real_distribution<float> radius(0.5f, 6.0f);
+	std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+	std::vector<PunctualLight> lights(kLightCount);
+	for(PunctualLight& light : lights) {
+		light.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		light.position = { position(random), position(random) * 0.3f, position(random) + 60.0f };
+		light.intensity = 1.0f;
+		light.direction = Normalize(Vector3{ direction(random), direction(random), direction(random) });
+		light.radius = radius(random);
+		light.decay = 2.0f;
+		light.cosAngle = random() % 2 ? 0.8f : 0.3f;
+		light.cosFalloffStart = 0.9f;
+		light.type = random() % 2 ? PunctualLightType::kSpot : PunctualLightType::kPoint;
+	}
+	//原点から+Zを向くカメラ
+	Matrix4x4 view = Identity4x4();
+	Matrix4x4 projection = MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 100.0f);
+	LightCluster cluster;
+	uint32_t threadCount = ( std::max )( 1u, std::thread::hardware_concurrency() );
+	auto measure = [&](uint32_t useThreadCount) {
+		return EngineBench::MeasureMilliseconds(kBuildCount, [&]() {
+			cluster.Build(lights, view, projection, 0.1f, 100.0f, useThreadCount);
+		});
+	};
+	double singleMilliseconds = measure(1);
+	double parallelMilliseconds = measure(threadCount);
+
+	std::printf("  1k lights: %.3fms on %u threads (1 thread %.3fms), %zu assigned, max %u per cluster, %u dropped\n",
+		parallelMilliseconds, threadCount, singleMilliseconds, cluster.GetLightIndices().size(),
+		cluster.GetMaxLightsPerCluster(), cluster.GetDroppedCount());
+}
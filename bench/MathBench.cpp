@@ -0,0 +1,60 @@
+/*********************************************************************
+ * \file   MathBench.cpp
+ * \brief  行列演算のベンチマーク
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   1回あたりのサイクル数(rdtsc)で測る。x64専用
+ *********************************************************************/
+#include "BenchFramework.h"
+#include "MathFunc4x4.h"
+#include <cstdio>
+#include <random>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+///=============================================================================
+///						行列の乗算・逆行列(SIMD版とスカラー版)
+BENCH_CASE(MathBench) {
+	const uint32_t kMatrixCount = 4096;
+	const int kRepeatCount = 100;
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> element(-2.0f, 2.0f);
+	std::vector<Matrix4x4> matrices(kMatrixCount);
+	for(Matrix4x4& matrix : matrices) {
+		for(auto& row : matrix.m) {
+			for(float& value : row) {
+				value = element(random);
+			}
+		}
+		//対角を大きくして逆行列を持つようにする
+		for(int i = 0; i < 4; ++i) {
+			matrix.m[i][i] += 8.0f;
+		}
+	}
+	std::vector<Matrix4x4> results(kMatrixCount);
+	auto measure = [&](auto operation) {
+		uint64_t start = __rdtsc();
+		for(int repeat = 0; repeat < kRepeatCount; ++repeat) {
+			for(uint32_t i = 0; i < kMatrixCount; ++i) {
+				results[i] = operation(matrices[i], matrices[( i + repeat ) % kMatrixCount]);
+			}
+		}
+		return static_cast<double>( __rdtsc() - start ) / ( static_cast<double>( kMatrixCount ) * kRepeatCount );
+	};
+	double multiplyScalarCycles = measure([](const Matrix4x4& m1, const Matrix4x4& m2) { return Multiply4x4Scalar(m1, m2); });
+	double multiplyCycles = measure([](const Matrix4x4& m1, const Matrix4x4& m2) { return Multiply4x4(m1, m2); });
+	double inverseScalarCycles = measure([](const Matrix4x4& m, const Matrix4x4&) { return Inverse4x4Scalar(m); });
+	double inverseCycles = measure([](const Matrix4x4& m, const Matrix4x4&) { return Inverse4x4(m); });
+
+	//結果を使って計算が省かれないようにする
+	float checksum = 0.0f;
+	for(const Matrix4x4& result : results) {
+		checksum += result.m[0][0];
+	}
+	std::printf("  cycles/op Multiply %.1f (scalar %.1f) Inverse %.1f (scalar %.1f) [checksum %g]\n",
+		multiplyCycles, multiplyScalarCycles, inverseCycles, inverseScalarCycles, checksum);
+}
@@ -0,0 +1,61 @@
+/*********************************************************************
+ * \file   RenderQueueBench.cpp
+ * \brief  描画キューの基数ソートのベンチマーク
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "BenchFramework.h"
+#include "RenderQueue.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+///=============================================================================
+///						10万パケットのソート(std::stable_sortとの比較)
+BENCH_CASE(SortBench) {
+	const uint32_t kPacketCount = 100000;
+	const int kSortCount = 10;
+	std::mt19937 random(1234);
+	std::vector<uint64_t> keys(kPacketCount);
+	for(uint64_t& key : keys) {
+		RenderSortKeyDesc desc;
+		desc.pipeline = random() % 8;
+		desc.material = random() % 256;
+		desc.texture = random() % 256;
+		desc.depth = random() % ( 1u << RenderSortKey::kDepthBits );
+		key = RenderSortKey::Make(desc);
+	}
+
+	//========================================
+	// 基数ソート(毎回詰め直す分は測らない)
+	RenderQueue queue;
+	queue.Reserve(kPacketCount);
+	std::chrono::duration<double, std::milli> radixElapsed{};
+	for(int i = 0; i < kSortCount; ++i) {
+		queue.Clear();
+		for(uint32_t index = 0; index < kPacketCount; ++index) {
+			queue.Push(keys[index], index);
+		}
+		auto start = std::chrono::steady_clock::now();
+		queue.Sort();
+		radixElapsed += std::chrono::steady_clock::now() - start;
+	}
+
+	//========================================
+	// 比較用の比較ソート
+	std::vector<RenderPacket> packets(kPacketCount);
+	std::chrono::duration<double, std::milli> stableSortElapsed{};
+	for(int i = 0; i < kSortCount; ++i) {
+		for(uint32_t index = 0; index < kPacketCount; ++index) {
+			packets[index] = { keys[index], index, 0 };
+		}
+		auto start = std::chrono::steady_clock::now();
+		std::stable_sort(packets.begin(), packets.end(), [](const RenderPacket& a, const RenderPacket& b) { return a.key < b.key; });
+		stableSortElapsed += std::chrono::steady_clock::now() - start;
+	}
+
+	std::printf("  100k packets: radix %.3fms, std::stable_sort %.3fms\n",
+		radixElapsed.count() / kSortCount, stableSortElapsed.count() / kSortCount);
+}
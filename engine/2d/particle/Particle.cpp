@@ -10,10 +10,17 @@
 #include "MathFunc4x4.h"
 #include "Vector3.h"
 #include "AffineTransformations.h"
+#include "TransformBatch.h"
+#include "FastMath.h"
 #include "TextureManager.h"
 #include "ParticleSetup.h"
 #include <numbers>
+#include <algorithm>
 
+namespace {
+	/// \brief ビルボードを使わないときの行列
+	constexpr Matrix4x4 kIdentityMatrix = Identity4x4();
+}
 
 ///=============================================================================
 ///						初期化処理
@@ -37,35 +44,18 @@ void Particle::Initialize(ParticleSetup* particleSetup) {
 
 ///=============================================================================
 ///						更新処理
-void Particle::Update() {
+void Particle::Update(float deltaTime) {
 	//========================================
-	// カメラの取得
-	Camera* camera = particleSetup_->GetDefaultCamera();
-	// カメラ行列の取得
-	Matrix4x4 cameraMatrix = MakeAffineMatrix({ 1.0f,1.0f,1.0f },
-		camera->GetRotate(), camera->GetTranslate());
-	// ビュー行列の取得
-	Matrix4x4 viewMatrix = Inverse4x4(cameraMatrix);
-	// プロジェクション行列の取得
-	Matrix4x4 projectionMatrix = MakePerspectiveFovMatrix(0.45f,
-		float(particleSetup_->GetDXManager()->GetWinApp().kWindowWidth_) / float(particleSetup_->GetDXManager()->GetWinApp().kWindowHeight_),
-		0.1f, 100.0f);
-	// ビュープロジェクション行列の取得
-	Matrix4x4 viewProjectionMatrix = Multiply4x4(viewMatrix, projectionMatrix);
+	// カメラから求めた値の取得
+	// NOTE:Object3dと同じくカメラが求めた行列を使い、ここでは作り直さない
+	const CameraSnapshot& cameraSnapshot = particleSetup_->GetDefaultCamera()->GetSnapshot();
+	const Matrix4x4& viewProjectionMatrix = cameraSnapshot.viewProjectionMatrix;
+	// 奥行きのキーの範囲
+	const float farClip = particleSetup_->GetDefaultCamera()->GetFarClip();
 
 	//========================================
 	// ビルボード行列の取得
-	Matrix4x4 backToFrontMatrix = MakeRotateYMatrix(std::numbers::pi_v<float>);
-	Matrix4x4 billboardMatrix{};
-	if(isUsedBillboard) {
-		billboardMatrix = Multiply4x4(backToFrontMatrix, cameraMatrix);
-		// 平行移動成分は無視
-		billboardMatrix.m[3][0] = 0.0f;
-		billboardMatrix.m[3][1] = 0.0f;
-		billboardMatrix.m[3][2] = 0.0f;
-	} else {
-		billboardMatrix = Identity4x4();
-	}
+	const Matrix4x4& billboardMatrix = isUsedBillboard ? cameraSnapshot.billboardMatrix : kIdentityMatrix;
 
 	// スケール調整用の倍率を設定
 	constexpr float scaleMultiplier = 0.01f; // 必要に応じて調整
@@ -75,7 +65,10 @@ void Particle::Update() {
 	for(auto& group : particleGroups) {
 		// テクスチャサイズの取得
 		Vector2 textureSize = group.second.textureSize;
-		// インスタンス数の初期化
+		// 並べ替え用の作業領域を空にする
+		instanceScratch_.clear();
+		transformScratch_.clear();
+		renderQueue_.Clear();
 		for(auto it = group.second.particleList.begin(); it != group.second.particleList.end();) {
 			// パーティクルの参照
 			ParticleStr& particle = *it;
@@ -88,62 +81,58 @@ void Particle::Update() {
 			particle.transform.scale.x = textureSize.x * scaleMultiplier;
 			particle.transform.scale.y = textureSize.y * scaleMultiplier;
 			// 位置の更新
-			particle.transform.translate = AddVec3(particle.transform.translate, MultiplyVec3(kDeltaTime, particle.velocity));
+			particle.transform.translate = AddVec3(particle.transform.translate, MultiplyVec3(deltaTime, particle.velocity));
 			// 経過時間を更新
-			particle.currentTime += kDeltaTime;
-			// ワールド行列の計算
-			Matrix4x4 worldMatrix = Multiply4x4(
-				billboardMatrix,
-				MakeAffineMatrix(particle.transform.scale, particle.transform.rotate, particle.transform.translate));
-			// ビュー・プロジェクションを掛け合わせて最終行列を計算
-			Matrix4x4 worldviewProjectionMatrix = Multiply4x4(worldMatrix, viewProjectionMatrix);
+			particle.currentTime += deltaTime;
 			//---------------------------------------
-			// インスタンシングデータの設定
-			if(group.second.instanceCount < kNumMaxInstance) {
-				group.second.instancingDataPtr[group.second.instanceCount].WVP = worldviewProjectionMatrix;
-				group.second.instancingDataPtr[group.second.instanceCount].World = worldMatrix;
+			// インスタンシングデータの設定(行列は後でまとめて求める)
+			if(group.second.instances.size() + instanceScratch_.size() < kNumMaxInstance) {
+				ParticleForGPU instance;
 				// カラーを設定し、アルファ値を減衰
-				group.second.instancingDataPtr[group.second.instanceCount].color = particle.color;
-				group.second.instancingDataPtr[group.second.instanceCount].color.w = 1.0f - ( particle.currentTime / particle.lifeTime );
-				if(group.second.instancingDataPtr[group.second.instanceCount].color.w < 0.0f) {
-					group.second.instancingDataPtr[group.second.instanceCount].color.w = 0.0f;
-				}
-				// インスタンス数を増やす
-				++group.second.instanceCount;
+				instance.color = particle.color;
+				instance.color.w = ( std::max )( 1.0f - ( particle.currentTime / particle.lifeTime ), 0.0f );
+				instanceScratch_.push_back(instance);
+				transformScratch_.push_back(particle.transform);
 			}
 			// 次のパーティクルへ
 			++it;
 		}
+		//---------------------------------------
+		// ワールド行列(ビルボード * SRT)とWVPをまとめて求める
+		TransformBatch::WriteParticleMatrices(transformScratch_, billboardMatrix, viewProjectionMatrix, instanceScratch_);
+		//---------------------------------------
+		// 半透明なので奥から手前へ描けるよう、奥行き(WVPの(3,3))でキーを作る
+		for(uint32_t i = 0; i < static_cast<uint32_t>( instanceScratch_.size() ); ++i) {
+			RenderSortKeyDesc desc;
+			desc.pass = RenderQueuePass::kParticle;
+			desc.depth = RenderSortKey::QuantizeDepth(instanceScratch_[i].WVP.m[3][3], farClip);
+			renderQueue_.Push(RenderSortKey::Make(desc), i);
+		}
+		//---------------------------------------
+		// 奥から手前の順でインスタンシングデータに書き込む
+		renderQueue_.Sort();
+		for(const RenderPacket& packet : renderQueue_.GetPackets()) {
+			group.second.instances.push_back(instanceScratch_[packet.index]);
+		}
 	}
 }
 
 ///=============================================================================
 ///						描画
 void Particle::Draw() {
-	ID3D12GraphicsCommandList* commandList = particleSetup_->GetDXManager()->GetCommandList().Get();
-	// TODO: パイプラインステートオブジェクトの設定を行う
-	// ルートシグネチャを設定
-	//commandList->SetGraphicsRootSignature(rootSignature_.Get());
-	//キャッシュ内に指定されたブレンドモードのPSOが存在するか確認
-	//auto it = pipelineStateCache_.find(blendMode_);
-	//if (it == pipelineStateCache_.end() || !it->second) {
-	//	Logger::Log("PSO for blend mode not found, defaulting to normal blend mode.");
-	//	it = pipelineStateCache_.find(kBlendModeNormal);
-	//	if (it == pipelineStateCache_.end() || !it->second) {
-	//		Logger::Log("Default PSO not found. Aborting draw call.");
-	//		return;
-	//	}
-	//}
-
-	//commandList->SetPipelineState(it->second.Get());
+	DirectXCore* dxCore = particleSetup_->GetDXManager();
+	BaseCommandList* commandList = dxCore->GetRenderCommandList();
+	// ブレンドモードに応じたPSOを設定(ルートシグネチャは共通描画設定で設定済み)
+	commandList->SetPipelineState(particleSetup_->GetPipelineState(blendMode_));
 	// プリミティブトポロジ（描画形状）を設定
 	//commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	// VBV (Vertex Buffer View)を設定
-	commandList->IASetVertexBuffers(0, 1, &vertexBufferView_);
+	VertexBufferView vertexBufferView = DirectXCommandList::ToVertexBufferView(vertexBufferView_);
+	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
 
 	// 全てのパーティクルグループについて処理を行う
 	for(auto& group : particleGroups) {
-		if(group.second.instanceCount == 0) continue; // インスタンスが無い場合はスキップ
+		if(group.second.instances.empty()) continue; // インスタンスが無い場合はスキップ
 
 		Vector2 textureLeftTop = group.second.textureLeftTop;
 		Vector2 textureSize = group.second.textureSize;
@@ -160,20 +149,25 @@ void Particle::Draw() {
 		//}
 
 		//マテリアルCBufferの場所を設定
-		commandList->SetGraphicsRootConstantBufferView(0, materialBuffer_->GetGPUVirtualAddress());
+		// NOTE:GPUが前のフレームを実行中でも上書きしないよう、描画のたびにリング領域へ書く
+		commandList->SetGraphicsRootConstantBufferView(0, dxCore->UploadSharedConstantBuffer(materialData_));
 
 		// テクスチャのSRVのDescriptorTableを設定
-		commandList->SetGraphicsRootDescriptorTable(2, particleSetup_->GetSrvSetup()->GetSRVGPUDescriptorHandle(group.second.srvIndex));
+		commandList->SetGraphicsRootDescriptorTable(2, particleSetup_->GetSrvSetup()->GetSRVGPUDescriptorHandle(group.second.srvIndex).ptr);
 
-		// インスタンシングデータのSRVのDescriptorTableを設定
-		commandList->SetGraphicsRootDescriptorTable(1, particleSetup_->GetSrvSetup()->GetSRVGPUDescriptorHandle(group.second.instancingSrvIndex));
+		//========================================
+		// インスタンシングデータをリング領域に書き込み、ルートSRVとして設定
+		const std::vector<ParticleForGPU>& instances = group.second.instances;
+		UploadAllocation allocation = dxCore->AllocateUpload(sizeof(ParticleForGPU) * instances.size());
+		std::memcpy(allocation.cpuAddress, instances.data(), sizeof(ParticleForGPU) * instances.size());
+		commandList->SetGraphicsRootShaderResourceView(1, allocation.gpuAddress);
 
 		// Draw Call (インスタンシング描画)
-		commandList->DrawInstanced(6, group.second.instanceCount, 0, 0);
+		commandList->DrawInstanced(6, static_cast<UINT>( instances.size() ), 0, 0);
 
 
-		// インスタンスカウントをリセット
-		group.second.instanceCount = 0;
+		// インスタンスをリセット
+		group.second.instances.clear();
 	}
 
 }
@@ -245,40 +239,15 @@ void Particle::CreateParticleGroup(const std::string& name, const std::string& t
 	//// テクスチャサイズを設定
 	//AdjustTextureSize(newGroup, textureFilePath);
 
-	// インスタンシング用リソースの生成
-	//newGroup.instancingResource =
-	//	dxCommon_->CreateBufferResource(sizeof(ParticleForGPU) * kNumMaxInstance);
-	newGroup.instancingResource =
-		particleSetup_->
-		GetDXManager()->
-		CreateBufferResource(sizeof(ParticleForGPU) * kNumMaxInstance);
-
-	newGroup.instancingResource->Map(0, nullptr, reinterpret_cast<void**>( &newGroup.instancingDataPtr ));
-	for(uint32_t index = 0; index < kNumMaxInstance; ++index) {
-		newGroup.instancingDataPtr[index].WVP = Identity4x4();
-		newGroup.instancingDataPtr[index].World = Identity4x4();
-		//newGroup.instancingDataPtr[index].color = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
-	}
-
-	// 最大インスタンシング用リソースの生成
-	//InstancingMaxResource();
-
-	// インスタンシング用SRVを確保してSRVインデックスを記録
-	//newGroup.instancingSrvIndex =　srvManager_->Allocate() + 1;
-	newGroup.instancingSrvIndex = particleSetup_->GetSrvSetup()->Allocate() + 1;
-	// 作成したSRVをインスタンシング用リソースに設定
-	//srvManager_->CreateSRVforStructuredBuffer(newGroup.instancingSrvIndex, newGroup.instancingResource.Get(), kNumMaxInstance, sizeof(ParticleForGPU));
-	particleSetup_->GetSrvSetup()->CreateSRVStructuredBuffer(newGroup.instancingSrvIndex, newGroup.instancingResource.Get(), kNumMaxInstance, sizeof(ParticleForGPU));
+	// インスタンシングデータの領域を確保しておく
+	// NOTE:GPU用のバッファは持たず、Drawでフレームごとのリング領域に書き込む
+	newGroup.instances.reserve(kNumMaxInstance);
 
 	// パーティクルグループをリストに追加
 	particleGroups.emplace(name, newGroup);
 
 	// マテリアルデータの初期化
 	CreateMaterialData();
-
-	// TODO:新しいブレンドモードを設定
-	//blendMode_ = blendMode;
-	//GraphicsPipelineState(blendMode);  // 再生成
 }
 
 ///=============================================================================
@@ -314,15 +283,10 @@ void Particle::CreateVertexBufferView() {
 ///=============================================================================
 ///						マテリアルデータの作成
 void Particle::CreateMaterialData() {
-	// マテリアル用のリソースを作成
-	materialBuffer_ = particleSetup_->GetDXManager()->CreateBufferResource(sizeof(Material));
-
-	//書き込むためのアドレスを取得
-	materialBuffer_->Map(0, nullptr, reinterpret_cast<void**>( &materialData_ ));
-	materialData_->color = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
+	materialData_.color = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
 	//SpriteはLightingしないのfalseを設定する
-	materialData_->enableLighting = false;
-	materialData_->uvTransform = Identity4x4();
+	materialData_.enableLighting = false;
+	materialData_.uvTransform = Identity4x4();
 }
 
 ///=============================================================================
@@ -349,9 +313,12 @@ ParticleStr Particle::CreateNewParticle(std::mt19937& randomEngine, const Vector
 	std::uniform_real_distribution<float> distAngle(0.0f, 1.0f);
 	float z = distAngle(randomEngine) * 2.0f - 1.0f; // z ∈ [-1, 1]
 	float theta = distAngle(randomEngine) * 2.0f * std::numbers::pi_v<float>; // θ ∈ [0, 2π]
-	float r = std::sqrt(1.0f - z * z);
-	float x = r * std::cos(theta);
-	float y = r * std::sin(theta);
+	// NOTE:発生方向は見た目にしか効かないので近似のsin・cos・sqrtで求める
+	float r = FastMath::Sqrt(1.0f - z * z);
+	float sinTheta, cosTheta;
+	FastMath::SinCos(theta, sinTheta, cosTheta);
+	float x = r * cosTheta;
+	float y = r * sinTheta;
 
 	Vector3 direction = { x, y, z }; // 方向ベクトル
 
@@ -11,10 +11,13 @@
 #include "ModelData.h"
 #include "VertexData.h"
 #include "Material.h"
+#include "ParticleForGPU.h"
+#include "RenderQueue.h"
 
 //========================================
 // 標準ライブラリ
 #include <random>
+#include <vector>
 
 //========================================
 // DX12include
@@ -37,27 +40,16 @@ struct ParticleStr {
 	float currentTime;
 };
 
-struct ParticleForGPU {
-	Matrix4x4 WVP;
-	Matrix4x4 World;
-	Vector4 color;
-};
-
 // パーティクルグループ構造体の定義
 struct ParticleGroup {
 	// マテリアルデータ
 	std::string materialFilePath;
-	int srvIndex = 0;
+	uint32_t srvIndex = 0;
 	// パーティクルのリスト (std::list<ParticleStr>型)
 	std::list<ParticleStr> particleList = {};
-	// インスタンシングデータ用SRVインデックス
-	int instancingSrvIndex = 0;
-	// インスタンシングリソース
-	Microsoft::WRL::ComPtr<ID3D12Resource> instancingResource = nullptr;
-	// インスタンス数
-	UINT instanceCount = 0;
-	// インスタンシングデータを書き込むためのポインタ
-	ParticleForGPU* instancingDataPtr = nullptr;
+	// 奥から手前へ並べたインスタンシングデータ
+	// NOTE:GPUへはDrawでフレームごとのリング領域に書き込む
+	std::vector<ParticleForGPU> instances;
 
 	Vector2 textureLeftTop = { 0.0f, 0.0f }; // テクスチャ左上座標
 	Vector2 textureSize = { 0.0f, 0.0f }; // テクスチャサイズを追加
@@ -73,8 +65,11 @@ public:
 	/// \brief 初期化
 	void Initialize(ParticleSetup* particleSetup);
 
-	/// \brief 更新
-	void Update();
+	/**----------------------------------------------------------------------------
+	 * \brief  Update 更新
+	 * \param  deltaTime 経過時間(秒)。GameTime::GetDeltaTime()を渡す
+	 */
+	void Update(float deltaTime);
 
 	/// \brief 描画 
 	void Draw();
@@ -124,7 +119,17 @@ private:
 	///--------------------------------------------------------------
 	///							入出力関数
 public:
+	/**----------------------------------------------------------------------------
+	 * \brief  SetBlendMode ブレンドモードの設定
+	 * \param  blendMode ブレンドモード
+	 * \note   PSOはParticleSetup側でブレンドモードごとにキャッシュされるので再生成しない
+	 */
+	void SetBlendMode(BlendMode blendMode) { blendMode_ = blendMode; }
 
+	/**----------------------------------------------------------------------------
+	 * \brief  GetBlendMode ブレンドモードの取得
+	 */
+	BlendMode GetBlendMode() const { return blendMode_; }
 
 	///--------------------------------------------------------------
 	///							メンバ変数
@@ -151,14 +156,19 @@ private:
 	VertexData* vertexData_ = nullptr;
 
 	//---------------------------------------
-	// マテリアルデータ
-	Microsoft::WRL::ComPtr<ID3D12Resource> materialBuffer_;
-	// バッファリソース内のデータを指すポインタ
-	Material* materialData_ = nullptr;
+	// マテリアルデータ(Drawでフレームごとのリング領域に書き込む)
+	Material materialData_ = {};
+
+	//---------------------------------------
+	// 奥から手前へ並べ替えるための作業領域
+	std::vector<ParticleForGPU> instanceScratch_;
+	// 行列をまとめて求めるためのTransform(添え字はinstanceScratch_と同じ)
+	std::vector<Transform> transformScratch_;
+	RenderQueue renderQueue_;
 
 	//---------------------------------------
-	// インスタンシングバッファ
-	Microsoft::WRL::ComPtr<ID3D12Resource> instancingBuffer_;
+	// ブレンドモード
+	BlendMode blendMode_ = BlendMode::kNone;
 
 	//---------------------------------------
 	// 乱数生成器の初期化
@@ -171,8 +181,6 @@ private:
 	bool isUsedBillboard = true;
 	//最大インスタンス数
 	static const uint32_t kNumMaxInstance = 128;
-	//
-	const float kDeltaTime = 1.0f / 60.0f;
 	// 乱数範囲の調整用
 	struct RangeForRandom {
 		float min;
@@ -16,10 +16,10 @@ ParticleEmitter::ParticleEmitter(Particle* particle, const std::string& name, co
     Emit(); // 初期化時に即時発生
 }
 
-void ParticleEmitter::Update() {
+void ParticleEmitter::Update(float deltaTime) {
     if (!repeat_) return; // 繰り返しフラグがfalseの場合は処理をスキップ
 
-    elapsedTime_ += 1.0f / 60.0f; // フレーム単位の経過時間を加算
+    elapsedTime_ += deltaTime; // 経過時間を加算
 
     if (elapsedTime_ >= frequency_)
     {
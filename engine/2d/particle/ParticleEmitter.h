@@ -14,7 +14,8 @@ public:
 
 
     /// \brief 更新
-    void Update();
+    /// \param deltaTime 経過時間(秒)。GameTime::GetDeltaTime()を渡す
+    void Update(float deltaTime);
 
     /// \brief 描画 
     void Draw();
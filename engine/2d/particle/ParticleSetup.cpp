@@ -27,13 +27,37 @@ void ParticleSetup::Initialize(DirectXCore *dxCore, SrvSetup *srvSetup) {
 void ParticleSetup::CommonDrawSetup() {
 	//コマンドリストの取得
 	// NOTE:Getを複数回呼び出すのは非効率的なので、変数に保持しておく
-	auto commandList = dxCore_->GetCommandList();
+	BaseCommandList* commandList = dxCore_->GetRenderCommandList();
 	//ルートシグネイチャのセット
 	commandList->SetGraphicsRootSignature(rootSignature_.Get());
 	//グラフィックスパイプラインステートをセット
-	commandList->SetPipelineState(graphicsPipelineState_.Get());
+	commandList->SetPipelineState(GetPipelineState(BlendMode::kNone));
 	//プリミティブトポロジーをセットする
-	commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	commandList->IASetPrimitiveTopology(PrimitiveTopology::kTriangleList);
+}
+
+///=============================================================================
+///						ブレンドモードごとのPSOの取得
+ID3D12PipelineState* ParticleSetup::GetPipelineState(BlendMode blendMode) {
+	size_t index = static_cast<size_t>( blendMode );
+	assert(index < graphicsPipelineStates_.size());
+	//描画パスは並列に記録されるので生成は排他する
+	std::lock_guard<std::mutex> lock(pipelineMutex_);
+	if(!graphicsPipelineStates_[index]) {
+		graphicsPipelineStates_[index] = dxCore_->GetPipelineStateCache()->GetOrCreate(MakePipelineDesc(blendMode));
+		if(!graphicsPipelineStates_[index]) {
+			throw std::runtime_error("Particle Failed to create graphics pipeline state :(");
+		}
+	}
+	return graphicsPipelineStates_[index].Get();
+}
+
+///=============================================================================
+///						使うブレンドモードのPSOの事前生成
+void ParticleSetup::PrecompileBlendModes(const std::vector<BlendMode>& blendModes) {
+	for(BlendMode blendMode : blendModes) {
+		GetPipelineState(blendMode);
+	}
 }
 
 ///=============================================================================
@@ -57,10 +81,11 @@ void ParticleSetup::CreateRootSignature() {
 	rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 	rootParameters[0].Descriptor.ShaderRegister = 0; // b0
 
-	rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+	//インスタンシングデータの構造化バッファ(t0)
+	// NOTE:フレームごとのリング領域に書くので、ディスクリプタを使わずルートSRVで渡す
+	rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
 	rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
-	rootParameters[1].DescriptorTable.pDescriptorRanges = descriptorRangeForInstancing;
-	rootParameters[1].DescriptorTable.NumDescriptorRanges = _countof(descriptorRangeForInstancing);
+	rootParameters[1].Descriptor.ShaderRegister = 0; // t0
 
 	/// ===DescropterTable=== ///
 	rootParameters[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
@@ -117,31 +142,55 @@ void ParticleSetup::CreateGraphicsPipeline() {
 
 	//========================================
 	// InputLayoutの設定を行う
-	D3D12_INPUT_ELEMENT_DESC inputElementDescs[3] = {};
 	//頂点データ
-	inputElementDescs[0].SemanticName = "POSITION";
-	inputElementDescs[0].SemanticIndex = 0;
-	inputElementDescs[0].Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
-	inputElementDescs[0].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+	inputElementDescs_[0].SemanticName = "POSITION";
+	inputElementDescs_[0].SemanticIndex = 0;
+	inputElementDescs_[0].Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+	inputElementDescs_[0].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
 	//画像座標データ
-	inputElementDescs[1].SemanticName = "TEXCOORD";
-	inputElementDescs[1].SemanticIndex = 0;
-	inputElementDescs[1].Format = DXGI_FORMAT_R32G32_FLOAT;
-	inputElementDescs[1].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+	inputElementDescs_[1].SemanticName = "TEXCOORD";
+	inputElementDescs_[1].SemanticIndex = 0;
+	inputElementDescs_[1].Format = DXGI_FORMAT_R32G32_FLOAT;
+	inputElementDescs_[1].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
 	//法線データ
-	inputElementDescs[2].SemanticName = "NORMAL";
-	inputElementDescs[2].SemanticIndex = 0;
-	inputElementDescs[2].Format = DXGI_FORMAT_R32G32B32_FLOAT;
-	inputElementDescs[2].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+	inputElementDescs_[2].SemanticName = "NORMAL";
+	inputElementDescs_[2].SemanticIndex = 0;
+	inputElementDescs_[2].Format = DXGI_FORMAT_R32G32B32_FLOAT;
+	inputElementDescs_[2].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+
+	//========================================
+	// Shaderをcompileする
+	vertexShaderBlob_ = dxCore_->CompileShader(L"resources/shader/Particle.VS.hlsl", L"vs_6_0");
+	if(!vertexShaderBlob_) {
+		throw std::runtime_error("ENGINE MESSAGE: Particle Failed to compile vertex shader :(");
+	}
+	Log("Particle Vertex shader created successfully :)", LogLevel::Success);
+
+	pixelShaderBlob_ = dxCore_->CompileShader(L"resources/shader/Particle.PS.hlsl", L"ps_6_0");
+	if(!pixelShaderBlob_) {
+		throw std::runtime_error("ENGINE MESSAGE: Particle Failed to compile pixel shader :(");
+	}
+	Log("Particle Pixel shader state created successfully :)", LogLevel::Success);
+
+	//========================================
+	// 既定のブレンドモードのPSOを生成
+	GetPipelineState(BlendMode::kNone);
+	Log("Particle Graphics pipeline state created successfully :)", LogLevel::Success);
+}
 
+///=============================================================================
+///						パイプライン設定の作成
+D3D12_GRAPHICS_PIPELINE_STATE_DESC ParticleSetup::MakePipelineDesc(BlendMode blendMode) const {
+	//========================================
+	// InputLayoutの設定を行う
 	D3D12_INPUT_LAYOUT_DESC inputLayoutDesc{};
-	inputLayoutDesc.pInputElementDescs = inputElementDescs;
-	inputLayoutDesc.NumElements = _countof(inputElementDescs);
+	inputLayoutDesc.pInputElementDescs = inputElementDescs_;
+	inputLayoutDesc.NumElements = _countof(inputElementDescs_);
 
 	//========================================
 	// BlendStateの設定を行う
 	D3D12_BLEND_DESC blendDesc{};
-	blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+	blendDesc.RenderTarget[0] = MakeRenderTargetBlendDesc(blendMode);
 
 	//========================================
 	// RasterizerStateの設定を行う
@@ -149,27 +198,13 @@ void ParticleSetup::CreateGraphicsPipeline() {
 	rasterizerDesc.CullMode = D3D12_CULL_MODE_BACK;
 	rasterizerDesc.FillMode = D3D12_FILL_MODE_SOLID;
 
-	//========================================
-	// Shaderをcompileする
-	Microsoft::WRL::ComPtr <IDxcBlob> vertexShaderBlob = dxCore_->CompileShader(L"resources/shader/Particle.VS.hlsl", L"vs_6_0");
-	if(!vertexShaderBlob) {
-		throw std::runtime_error("ENGINE MESSAGE: Particle Failed to compile vertex shader :(");
-	}
-	Log("Particle Vertex shader created successfully :)", LogLevel::Success);
-
-	Microsoft::WRL::ComPtr <IDxcBlob> pixelShaderBlob = dxCore_->CompileShader(L"resources/shader/Particle.PS.hlsl", L"ps_6_0");
-	if(!pixelShaderBlob) {
-		throw std::runtime_error("ENGINE MESSAGE: Particle Failed to compile pixel shader :(");
-	}
-	Log("Particle Pixel shader state created successfully :)", LogLevel::Success);
-
 	//========================================
 	// PSOを生成する
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC graphicsPipelineStateDesc{};
 	graphicsPipelineStateDesc.pRootSignature = rootSignature_.Get();
 	graphicsPipelineStateDesc.InputLayout = inputLayoutDesc;
-	graphicsPipelineStateDesc.VS = { vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize() };
-	graphicsPipelineStateDesc.PS = { pixelShaderBlob->GetBufferPointer(), pixelShaderBlob->GetBufferSize() };
+	graphicsPipelineStateDesc.VS = { vertexShaderBlob_->GetBufferPointer(), vertexShaderBlob_->GetBufferSize() };
+	graphicsPipelineStateDesc.PS = { pixelShaderBlob_->GetBufferPointer(), pixelShaderBlob_->GetBufferSize() };
 	graphicsPipelineStateDesc.BlendState = blendDesc;
 	graphicsPipelineStateDesc.RasterizerState = rasterizerDesc;
 	graphicsPipelineStateDesc.NumRenderTargets = 1;
@@ -182,17 +217,10 @@ void ParticleSetup::CreateGraphicsPipeline() {
 	// DepthStencilStateの設定を行う
 	D3D12_DEPTH_STENCIL_DESC depthStencilDesc{};
 	depthStencilDesc.DepthEnable = true;
-	depthStencilDesc.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
+	//NOTE:半透明を重ねるブレンドモードでは、後ろのパーティクルが消えないよう深度を書き込まない
+	depthStencilDesc.DepthWriteMask = blendMode == BlendMode::kNone ? D3D12_DEPTH_WRITE_MASK_ALL : D3D12_DEPTH_WRITE_MASK_ZERO;
 	depthStencilDesc.DepthFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL;
 	graphicsPipelineStateDesc.DepthStencilState = depthStencilDesc;
 	graphicsPipelineStateDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
-
-	//========================================
-	// 実際に生成
-	HRESULT hr = dxCore_->GetDevice()->CreateGraphicsPipelineState(&graphicsPipelineStateDesc,
-		IID_PPV_ARGS(&graphicsPipelineState_));
-	if(FAILED(hr)) {
-		throw std::runtime_error("Particle Failed to create graphics pipeline state :(");
-	}
-	Log("Particle Graphics pipeline state created successfully :)", LogLevel::Success);
+	return graphicsPipelineStateDesc;
 }
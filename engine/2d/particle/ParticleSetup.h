@@ -10,6 +10,9 @@
 #include "DirectXCore.h"
 #include "Camera.h"
 #include "SrvSetup.h"
+#include "BlendMode.h"
+#include <array>
+#include <mutex>
 
 class ParticleSetup {
 	///--------------------------------------------------------------
@@ -26,6 +29,21 @@ public:
 	*/
 	void CommonDrawSetup();
 
+	/**----------------------------------------------------------------------------
+	* \brief  GetPipelineState ブレンドモードごとのPSOの取得
+	* \param  blendMode ブレンドモード
+	* \return PSO
+	* \note   初めて使うブレンドモードはここで生成する(パイプラインライブラリにあれば読み込み)
+	*/
+	ID3D12PipelineState* GetPipelineState(BlendMode blendMode);
+
+	/**----------------------------------------------------------------------------
+	* \brief  PrecompileBlendModes 使うブレンドモードのPSOを先に作っておく
+	* \param  blendModes ブレンドモードの一覧
+	* \note   シーンの初期化前に呼び、描画中の生成による引っかかりを避ける
+	*/
+	void PrecompileBlendModes(const std::vector<BlendMode>& blendModes);
+
 
 	///--------------------------------------------------------------
 	///						 静的メンバ関数
@@ -41,6 +59,12 @@ private:
 	*/
 	void CreateGraphicsPipeline();
 
+	/**----------------------------------------------------------------------------
+	* \brief  MakePipelineDesc ブレンドモードに応じたパイプライン設定の作成
+	* \param  blendMode ブレンドモード
+	*/
+	D3D12_GRAPHICS_PIPELINE_STATE_DESC MakePipelineDesc(BlendMode blendMode) const;
+
 	///--------------------------------------------------------------
 	///							入出力関数
 public:
@@ -82,8 +106,15 @@ private:
 	Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature_;
 
 	//========================================
-	// グラフィックスパイプライン
-	Microsoft::WRL::ComPtr<ID3D12PipelineState> graphicsPipelineState_;
+	// パイプライン設定の元(ブレンドモード違いのPSOを後から作るので保持する)
+	Microsoft::WRL::ComPtr<IDxcBlob> vertexShaderBlob_;
+	Microsoft::WRL::ComPtr<IDxcBlob> pixelShaderBlob_;
+	D3D12_INPUT_ELEMENT_DESC inputElementDescs_[3] = {};
+
+	//========================================
+	// グラフィックスパイプライン(ブレンドモードごと)
+	std::array<Microsoft::WRL::ComPtr<ID3D12PipelineState>, static_cast<size_t>( BlendMode::kCount )> graphicsPipelineStates_;
+	std::mutex pipelineMutex_;
 
 	//========================================
 	// デフォルトカメラ
@@ -11,6 +11,16 @@
 #include "AffineTransformations.h"
 #include "TextureManager.h"
 #include "MathFunc4x4.h"
+#include "WinApp.h"
+
+namespace {
+	/// \brief スプライト用の正射影行列(ウィンドウの大きさは固定なのでコンパイル時に求める)
+	constexpr Matrix4x4 kSpriteProjectionMatrix = MakeOrthographicMatrix(
+		0.0f, 0.0f,
+		float(WinApp::GetWindowWidth()),
+		float(WinApp::GetWindowHeight()),
+		0.0f, 100.0f);
+}
 
  ///=============================================================================
  ///								初期化
@@ -18,14 +28,14 @@ void Sprite::Initialize(SpriteSetup* SpriteSetup, std::string textureFilePath) {
 	//引数で受け取ってメンバ変数に記録する
 	this->spriteSetup_ = SpriteSetup;
 
-	//頂点バッファの作成
-	CreateVertexBuffer();
+	//頂点データの初期化
+	InitializeVertexData();
 	//インデックスバッファの作成
 	CreateIndexBuffer();
-	//マテリアルバッファの作成
-	CreateMaterialBuffer();
-	//トランスフォーメーションマトリックスバッファの作成
-	CreateTransformationMatrixBuffer();
+	//マテリアルデータの初期化
+	InitializeMaterialData();
+	//トランスフォーメーションマトリックスの初期化
+	transformationMatrixData_.WVP = Identity4x4();
 
 	//ファイルパスの記録
 	textureFilePath_ = textureFilePath;
@@ -56,20 +66,12 @@ void Sprite::Update(Matrix4x4 viewMatrix) {
 	//---------------------------------------
 	// スプライトの変換行列を作成
 	Matrix4x4 worldMatrixSprite = MakeAffineMatrix(transform_.scale, transform_.rotate, transform_.translate);
-	transformationMatrixData_->World = worldMatrixSprite;
-
-	//---------------------------------------
-	// 正射影行列の作成
-	Matrix4x4 projectionMatrixSprite = MakeOrthographicMatrix(
-		0.0f, 0.0f,
-		float(spriteSetup_->GetDXManager()->GetWinApp().GetWindowWidth()),
-		float(spriteSetup_->GetDXManager()->GetWinApp().GetWindowHeight()),
-		0.0f, 100.0f);
+	transformationMatrixData_.World = worldMatrixSprite;
 
 	//---------------------------------------
 	// ワールド・ビュー・プロジェクション行列を計算
-	Matrix4x4 worldViewProjectionMatrixSprite = Multiply4x4(worldMatrixSprite, Multiply4x4(viewMatrix, projectionMatrixSprite));
-	transformationMatrixData_->WVP = worldViewProjectionMatrixSprite;
+	Matrix4x4 worldViewProjectionMatrixSprite = Multiply4x4(worldMatrixSprite, Multiply4x4(viewMatrix, kSpriteProjectionMatrix));
+	transformationMatrixData_.WVP = worldViewProjectionMatrixSprite;
 }
 
 ///=============================================================================
@@ -79,28 +81,41 @@ void Sprite::Draw() {
 	//NOTE:Material用のCBuffer(色)とSRV(Texture)は3Dの三角形と同じものを使用。無駄を省け。
 	//NOTE:同じものを使用したな？気をつけろ、別々の描画をしたいときは個別のオブジェクトとして宣言し直せ。
 	// まず、描画時に使うバッファが有効か確認する
-	if(!vertexBuffer_ || !indexBuffer_ || !materialBuffer_ || !transfomationMatrixBuffer_) {
+	if(!indexBuffer_) {
 		throw std::runtime_error("One or more buffers are not initialized.");
 	}
 
+	//---------------------------------------
+	// 頂点と定数をフレームごとのリング領域に書き込む
+	// NOTE:GPUが前のフレームを実行中でも上書きしないよう、描画のたびに新しい領域へ書く
+	DirectXCore* dxCore = spriteSetup_->GetDXManager();
+	UploadAllocation vertexAllocation = dxCore->AllocateUpload(sizeof(vertexData_), alignof(VertexData));
+	std::memcpy(vertexAllocation.cpuAddress, vertexData_, sizeof(vertexData_));
+	VertexBufferView vertexBufferView{};
+	vertexBufferView.bufferLocation = vertexAllocation.gpuAddress;
+	vertexBufferView.sizeInBytes = sizeof(vertexData_);
+	vertexBufferView.strideInBytes = sizeof(VertexData);
+	D3D12_GPU_VIRTUAL_ADDRESS materialAddress = dxCore->UploadConstantBuffer(materialData_);
+	D3D12_GPU_VIRTUAL_ADDRESS transformationMatrixAddress = dxCore->UploadConstantBuffer(transformationMatrixData_);
+
 	// コマンドリスト取得
-	auto commandList = spriteSetup_->GetDXManager()->GetCommandList();
+	BaseCommandList* commandList = dxCore->GetRenderCommandList();
 
 	// 頂点バッファの設定
-	commandList->IASetVertexBuffers(0, 1, &vertexBufferView_);
+	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
 
 	// インデックスバッファの設定
-	commandList->IASetIndexBuffer(&indexBufferView_);
+	commandList->IASetIndexBuffer(DirectXCommandList::ToIndexBufferView(indexBufferView_));
 
 	// プリミティブのトポロジーを設定
-	commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	commandList->IASetPrimitiveTopology(PrimitiveTopology::kTriangleList);
 
 	// Material と TransformationMatrix の設定
-	commandList->SetGraphicsRootConstantBufferView(0, materialBuffer_->GetGPUVirtualAddress());
-	commandList->SetGraphicsRootConstantBufferView(1, transfomationMatrixBuffer_->GetGPUVirtualAddress());
+	commandList->SetGraphicsRootConstantBufferView(0, materialAddress);
+	commandList->SetGraphicsRootConstantBufferView(1, transformationMatrixAddress);
 
 	// テクスチャの設定
-	commandList->SetGraphicsRootDescriptorTable(2, TextureManager::GetInstance()->GetSrvHandleGPU(textureFilePath_));
+	commandList->SetGraphicsRootDescriptorTable(2, TextureManager::GetInstance()->GetSrvHandleGPU(textureFilePath_).ptr);
 	
 	// 描画コール
 	commandList->DrawIndexedInstanced(6, 1, 0, 0, 0);
@@ -110,24 +125,8 @@ void Sprite::Draw() {
 ///=============================================================================
 ///									ローカル関数
 ///--------------------------------------------------------------
-///						 頂点バッファの作成
-void Sprite::CreateVertexBuffer() {
-	// 頂点データ用のバッファリソースを作成
-	vertexBuffer_ = spriteSetup_->GetDXManager()->CreateBufferResource(sizeof(VertexData) * 4);
-
-	if(!vertexBuffer_) {
-		throw std::runtime_error("Failed to Create Vertex Buffer");
-		return;
-	}
-
-	// バッファビューの設定
-	vertexBufferView_.BufferLocation = vertexBuffer_->GetGPUVirtualAddress();
-	vertexBufferView_.SizeInBytes = sizeof(VertexData) * 4;
-	vertexBufferView_.StrideInBytes = sizeof(VertexData);
-
-	// リソースにデータを書き込む
-	vertexBuffer_->Map(0, nullptr, reinterpret_cast<void**>( &vertexData_ ));
-
+///						 頂点データの初期化
+void Sprite::InitializeVertexData() {
 	// 2つの三角形の頂点データを設定
 	vertexData_[0].position = { 0.0f, 1.0f, 0.0f, 1.0f };
 	vertexData_[0].texCoord = { 0.0f, 1.0f };
@@ -173,33 +172,14 @@ void Sprite::CreateIndexBuffer() {
 }
 
 ///--------------------------------------------------------------
-///						マテリアルバッファの作成
-void Sprite::CreateMaterialBuffer() {
-	// マテリアルデータ用のバッファリソースを作成
-	materialBuffer_ = spriteSetup_->GetDXManager()->CreateBufferResource(sizeof(Material));
-	//書き込むためのアドレス取得
-	materialBuffer_->Map(0, nullptr, reinterpret_cast<void**>( &materialData_ ));
-	//マテリアルデータ書き込み用変数(赤色を書き込み)
+///						マテリアルデータの初期化
+void Sprite::InitializeMaterialData() {
+	//マテリアルデータ書き込み用変数(白色を書き込み)
 	Material materialSprite = { {1.0f, 1.0f, 1.0f, 1.0f},false };
 	//UVトランスフォーム用の単位行列の書き込み
 	materialSprite.uvTransform = Identity4x4();
 	//マテリアルデータの書き込み
-	*materialData_ = materialSprite;
-}
-
-///--------------------------------------------------------------
-///			トランスフォーメーションマトリックスバッファの作成
-void Sprite::CreateTransformationMatrixBuffer() {
-	//wvp用のリソースを作る
-	transfomationMatrixBuffer_ = spriteSetup_->GetDXManager()->CreateBufferResource(sizeof(TransformationMatrix));
-	//書き込むためのアドレスを取得
-	transfomationMatrixBuffer_->Map(0, nullptr, reinterpret_cast<void**>( &transformationMatrixData_ ));
-	//書き込み用変数
-	TransformationMatrix transformationMatrix;
-	//単位行列の書き込み
-	transformationMatrix.WVP = Identity4x4();
-	//トランスフォーメーションマトリックスの書き込み
-	*transformationMatrixData_ = transformationMatrix;
+	materialData_ = materialSprite;
 }
 
 
@@ -68,10 +68,10 @@ public:
 	///						 静的メンバ関数
 private:
 	/**----------------------------------------------------------------------------
-	 * \brief  頂点バッファの作成
-	 * \note
+	 * \brief  頂点データの初期化
+	 * \note   頂点は描画時にフレームごとのリング領域へ書き込む
 	 */
-	void CreateVertexBuffer();
+	void InitializeVertexData();
 
 	/**----------------------------------------------------------------------------
 	 * \brief  インデックスバッファの作成
@@ -80,16 +80,10 @@ private:
 	void CreateIndexBuffer();
 
 	/**----------------------------------------------------------------------------
-	 * \brief  マテリアルバッファの作成
-	 * \note
-	 */
-	void CreateMaterialBuffer();
-
-	/**----------------------------------------------------------------------------
-	 * \brief  トランスフォーメーションマトリックスバッファの作成
+	 * \brief  マテリアルデータの初期化
 	 * \note
 	 */
-	void CreateTransformationMatrixBuffer();
+	void InitializeMaterialData();
 
 	/**----------------------------------------------------------------------------
 	 * \brief  ReflectSRT SRTの反映
@@ -153,13 +147,13 @@ public:
 	 * \return 色
 	 * \note
 	 */
-	const Vector4& GetColor() const { return materialData_->color; }
+	const Vector4& GetColor() const { return materialData_.color; }
 	/**----------------------------------------------------------------------------
 	 * \brief  SetColor 色の設定
 	 * \param  color
 	 * \note
 	 */
-	void SetColor(const Vector4& color) { materialData_->color = color; }
+	void SetColor(const Vector4& color) { materialData_.color = color; }
 
 
 	/**----------------------------------------------------------------------------
@@ -263,30 +257,22 @@ private:
 
 	///---------------------------------------
 	/// バッファデータ
-	//頂点
-	Microsoft::WRL::ComPtr <ID3D12Resource> vertexBuffer_ = nullptr;
-	//インデックス
+	//インデックス(内容が変わらないので専用のリソースに置く)
 	Microsoft::WRL::ComPtr <ID3D12Resource> indexBuffer_ = nullptr;
-	//マテリアル
-	Microsoft::WRL::ComPtr <ID3D12Resource> materialBuffer_ = nullptr;
-	//トランスフォーメーションマトリックス
-	Microsoft::WRL::ComPtr <ID3D12Resource> transfomationMatrixBuffer_ = nullptr;
 
 	///---------------------------------------
-	/// バッファリソース内のデータを指すポインタ
+	/// 描画時にフレームごとのリング領域へ書き込むデータ
 	//頂点
-	VertexData* vertexData_ = nullptr;
+	VertexData vertexData_[4] = {};
 	//インデックス
 	uint32_t* indexData_ = nullptr;
 	//マテリアル
-	Material* materialData_ = nullptr;
+	Material materialData_ = {};
 	//トランスフォーメーションマトリックス
-	TransformationMatrix* transformationMatrixData_ = nullptr;
+	TransformationMatrix transformationMatrixData_ = {};
 
 	///---------------------------------------
 	/// バッファリソースの使い道を指すポインタ
-	//頂点
-    D3D12_VERTEX_BUFFER_VIEW vertexBufferView_ = {};
 	//インデックス
 	D3D12_INDEX_BUFFER_VIEW indexBufferView_ = {};
 
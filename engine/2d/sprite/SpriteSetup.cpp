@@ -26,13 +26,13 @@ void SpriteSetup::Initialize(DirectXCore* dxCore) {
 void SpriteSetup::CommonDrawSetup() {
 	//コマンドリストの取得
 	// NOTE:Getを複数回呼び出すのは非効率的なので、変数に保持しておく
-    auto commandList = dxCore_->GetCommandList();
+    BaseCommandList* commandList = dxCore_->GetRenderCommandList();
     //ルートシグネイチャのセット
     commandList->SetGraphicsRootSignature(rootSignature_.Get());
     //グラフィックスパイプラインステートをセット
     commandList->SetPipelineState(graphicsPipelineState_.Get());
     //プリミティブトポロジーをセットする
-    commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    commandList->IASetPrimitiveTopology(PrimitiveTopology::kTriangleList);
 }
 
 ///=============================================================================
@@ -178,9 +178,9 @@ void SpriteSetup::CreateGraphicsPipeline() {
     graphicsPipelineStateDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
 
     //実際に生成
-    HRESULT hr = dxCore_->GetDevice()->CreateGraphicsPipelineState(&graphicsPipelineStateDesc,
-        IID_PPV_ARGS(&graphicsPipelineState_));
-    if (FAILED(hr)) {
+    //NOTE:キャッシュ経由で生成し、次回起動時はパイプラインライブラリから読み込む
+    graphicsPipelineState_ = dxCore_->GetPipelineStateCache()->GetOrCreate(graphicsPipelineStateDesc);
+    if (!graphicsPipelineState_) {
         throw std::runtime_error("ENGINE MESSAGE: Sprite Failed to create graphics pipeline state :(");
     }
 	Log("Sprite Graphics pipeline state created successfully :), LogLevel::SUCCESS");
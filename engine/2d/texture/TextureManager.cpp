@@ -114,10 +114,9 @@ uint32_t TextureManager::GetTextureIndex(const std::string& filePath) {
 	std::string fullPath = kTextureDirectoryPath + filePath;
 
 	if(textureDatas_.contains(fullPath)) {
-		//読み込み済みなら要素番号を返す
-		auto it = textureDatas_.find(fullPath);
-		uint32_t textureIndex = static_cast<uint32_t>( std::distance(textureDatas_.begin(), it) );
-		return textureIndex;
+		//読み込み済みならSRVインデックスを返す
+		//NOTE: SRVは再利用されるのでマップの要素番号とは一致しない
+		return textureDatas_.at(fullPath).srvIndex;
 	}
 	//---------------------------------------
 	// 検索化ヒットしない場合は停止
@@ -133,7 +132,8 @@ D3D12_GPU_DESCRIPTOR_HANDLE TextureManager::GetSrvHandleGPU(const std::string& f
 	// 範囲外指定チェック
 	assert(textureDatas_.contains(fullPath));
 	// テクスチャデータの参照を取得
-	TextureData& textureData = textureDatas_[fullPath];
+	// NOTE:描画パスから並列に呼ばれるので要素を追加しないat()で参照する
+	const TextureData& textureData = textureDatas_.at(fullPath);
 	return textureData.srvHandleGPU;
 }
 
@@ -14,6 +14,7 @@
 #include <sstream>
 //---------------------------------------
 // 数学関数　
+#include <algorithm>
 #include <cmath>
 #include "MathFunc4x4.h"
 #include "AffineTransformations.h"
@@ -30,7 +31,7 @@ void Model::Initialize(ModelSetup *modelSetup, const std::string &directorypath,
 	//頂点バッファの作成
 	CreateVertexBuffer();
 	//マテリアルバッファの作成
-	CreateMaterialBuffer();
+	CreateMaterialData();
 	//テクスチャの読み込み
 	TextureManager::GetInstance()->LoadTexture(modelData_.material.textureFilePath);
 	//テクスチャ番号を取得して、メンバ変数に格納
@@ -47,41 +48,42 @@ void Model::Update() {
 ///						描画
 void Model::Draw() {
 
-	if(!vertexBuffer_ || !materialBuffer_) {
+	if(!vertexBuffer_) {
 		throw std::runtime_error("One or more buffers are not initialized.");
 	}
 	// コマンドリスト取得
-	auto commandList = modelSetup_->GetDXManager()->GetCommandList();
+	BaseCommandList* commandList = modelSetup_->GetDXManager()->GetRenderCommandList();
 
 	//VertexBufferViewの設定
-	commandList->IASetVertexBuffers(0, 1, &vertexBufferView_);
-	//マテリアルバッファの設定
-	commandList->SetGraphicsRootConstantBufferView(0, materialBuffer_->GetGPUVirtualAddress());
+	VertexBufferView vertexBufferView = DirectXCommandList::ToVertexBufferView(vertexBufferView_);
+	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
+	//マテリアルの設定(同じ内容なら同じアドレスを使い回す)
+	commandList->SetGraphicsRootConstantBufferView(0, modelSetup_->GetDXManager()->UploadSharedConstantBuffer(materialData_));
 
 	//SRVのDescriptorTableの設定
-	commandList->SetGraphicsRootDescriptorTable(2, TextureManager::GetInstance()->GetSrvHandleGPU(modelData_.material.textureFilePath));
+	commandList->SetGraphicsRootDescriptorTable(2, TextureManager::GetInstance()->GetSrvHandleGPU(modelData_.material.textureFilePath).ptr);
 
 	//描画(DrawCall)
-	commandList->DrawInstanced(UINT(modelData_.vertices.size()), 1, 0, 0);
+	commandList->DrawInstanced(static_cast<uint32_t>( modelData_.vertices.size() ), 1, 0, 0);
 }
 
-// TODO: この関数はどこで使われているのか？
 ///=============================================================================
 ///						インスタンシング描画
 void Model::InstancingDraw(uint32_t instanceCount) {
-	if(!vertexBuffer_ || !materialBuffer_) {
+	if(!vertexBuffer_) {
 		throw std::runtime_error("One or more buffers are not initialized.");
 	}
 	// コマンドリスト取得
-	auto commandList = modelSetup_->GetDXManager()->GetCommandList();
+	BaseCommandList* commandList = modelSetup_->GetDXManager()->GetRenderCommandList();
 	//VertexBufferViewの設定
-	commandList->IASetVertexBuffers(0, 1, &vertexBufferView_);
-	//マテリアルバッファの設定
-	commandList->SetGraphicsRootConstantBufferView(0, materialBuffer_->GetGPUVirtualAddress());
+	VertexBufferView vertexBufferView = DirectXCommandList::ToVertexBufferView(vertexBufferView_);
+	commandList->IASetVertexBuffers(0, 1, &vertexBufferView);
+	//マテリアルの設定(同じ内容なら同じアドレスを使い回す)
+	commandList->SetGraphicsRootConstantBufferView(0, modelSetup_->GetDXManager()->UploadSharedConstantBuffer(materialData_));
 	//SRVのDescriptorTableの設定
-	commandList->SetGraphicsRootDescriptorTable(2, TextureManager::GetInstance()->GetSrvHandleGPU(modelData_.material.textureFilePath));
+	commandList->SetGraphicsRootDescriptorTable(2, TextureManager::GetInstance()->GetSrvHandleGPU(modelData_.material.textureFilePath).ptr);
 	//描画(DrawCall)
-	commandList->DrawInstanced(6, instanceCount, 0, 0);
+	commandList->DrawInstanced(static_cast<uint32_t>( modelData_.vertices.size() ), instanceCount, 0, 0);
 }
 
 ///=============================================================================
@@ -203,10 +205,48 @@ void Model::LoadObjFile(const std::string &directoryPath, const std::string &fil
 	}
 
 	//========================================
-	// 4.ModelDataを返す
+	// 4.境界を求める(カリングに使う)
+	ComputeBounds(modelData);
+
+	//========================================
+	// 5.ModelDataを返す
 	modelData_ = modelData;
 }
 
+///--------------------------------------------------------------
+///						 境界の計算
+void Model::ComputeBounds(ModelData &modelData) {
+	if(modelData.vertices.empty()) {
+		modelData.bounds = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+		modelData.boundingSphere = { { 0.0f, 0.0f, 0.0f }, 0.0f };
+		return;
+	}
+	//========================================
+	// AABBは全頂点の最小・最大
+	const Vector4 &first = modelData.vertices.front().position;
+	AABB bounds = { { first.x, first.y, first.z }, { first.x, first.y, first.z } };
+	for(const VertexData &vertex : modelData.vertices) {
+		bounds.min.x = ( std::min )( bounds.min.x, vertex.position.x );
+		bounds.min.y = ( std::min )( bounds.min.y, vertex.position.y );
+		bounds.min.z = ( std::min )( bounds.min.z, vertex.position.z );
+		bounds.max.x = ( std::max )( bounds.max.x, vertex.position.x );
+		bounds.max.y = ( std::max )( bounds.max.y, vertex.position.y );
+		bounds.max.z = ( std::max )( bounds.max.z, vertex.position.z );
+	}
+	modelData.bounds = bounds;
+
+	//========================================
+	// 境界球はAABBの中心から一番遠い頂点までを半径にする
+	// NOTE:AABBの対角線の半分より小さくなることが多い
+	Vector3 center = GetCenter(bounds);
+	float radiusSquared = 0.0f;
+	for(const VertexData &vertex : modelData.vertices) {
+		Vector3 offset = Vector3{ vertex.position.x, vertex.position.y, vertex.position.z } - center;
+		radiusSquared = ( std::max )( radiusSquared, Dot(offset, offset) );
+	}
+	modelData.boundingSphere = { center, std::sqrt(radiusSquared) };
+}
+
 ///--------------------------------------------------------------
 ///						 頂点データの作成
 void Model::CreateVertexBuffer() {
@@ -227,17 +267,10 @@ void Model::CreateVertexBuffer() {
 
 ///--------------------------------------------------------------
 ///						 マテリアルデータの作成
-void Model::CreateMaterialBuffer() {
-	materialBuffer_ = modelSetup_->GetDXManager()->CreateBufferResource(sizeof(Material));
-	//マテリアルデータ
-	materialData_ = nullptr;
-	//マテリアルデータ書き込み用変数
-	Material material = { {1.0f, 1.0f, 1.0f, 1.0f},true };
-	//書き込むためのアドレス取得
-	materialBuffer_->Map(0, nullptr, reinterpret_cast<void **>( &materialData_ ));
-	//今回は赤を書き込む
-	*materialData_ = material;
-	materialData_->uvTransform = Identity4x4();
+// NOTE:GPUへは描画のたびにフレームごとのリング領域へ書き込むので、ここではバッファを作らない
+void Model::CreateMaterialData() {
+	materialData_ = { {1.0f, 1.0f, 1.0f, 1.0f},true };
+	materialData_.uvTransform = Identity4x4();
 	//光沢度
-	materialData_->shininess = 32.0f;
+	materialData_.shininess = 32.0f;
 }
\ No newline at end of file
@@ -38,8 +38,8 @@ public:
 	/// \brief 描画 
 	void Draw();
 
-	// TODO: この関数はどこで使われているのか？
-	/// @brief インスタンス描画
+	/// @brief インスタンス描画(Object3dSetupがまとめた描画から使う)
+	/// @param instanceCount インスタンス数
 	void InstancingDraw(uint32_t instanceCount);
 
 	/// \brief テクスチャの変更
@@ -65,6 +65,12 @@ private:
 	 */
 	void LoadObjFile(const std::string &directoryPath, const std::string &filename);
 
+	/**----------------------------------------------------------------------------
+	 * \brief  ComputeBounds 頂点からAABBと境界球を求める
+	 * \param  modelData 頂点を読み込んだモデルデータ(boundsとboundingSphereに書き込む)
+	 */
+	void ComputeBounds(ModelData &modelData);
+
 	/**----------------------------------------------------------------------------
 	 * \brief  頂点バッファの作成
 	 * \note
@@ -72,10 +78,10 @@ private:
 	void CreateVertexBuffer();
 
 	/**----------------------------------------------------------------------------
-	 * \brief  マテリアルバッファの作成
+	 * \brief  マテリアルデータの作成
 	 * \note
 	 */
-	void CreateMaterialBuffer();
+	void CreateMaterialData();
 
 	///--------------------------------------------------------------
 	///							入出力関数
@@ -85,25 +91,43 @@ public:
 	 * \brief  SetMaterialColor マテリアルカラーの設定
 	 * \param  color カラー
 	 */
-	void SetMaterialColor(const Vector4 &color) { materialData_->color = color; }
+	void SetMaterialColor(const Vector4 &color) { materialData_.color = color; }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  GetMaterialColor マテリアルカラーの取得
 	 * \return 
 	 */
-	Vector4 GetMaterialColor() const { return materialData_->color; }
+	Vector4 GetMaterialColor() const { return materialData_.color; }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetShininess 光沢度の設定
 	 * \param  shininess
 	 */
-	void SetShininess(float shininess) { materialData_->shininess = shininess; }
+	void SetShininess(float shininess) { materialData_.shininess = shininess; }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  GetShininess 光沢度の取得
 	 * \return 
 	 */
-	float GetShininess() const { return materialData_->shininess; }
+	float GetShininess() const { return materialData_.shininess; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetTextureIndex テクスチャ番号の取得
+	 * \return
+	 */
+	uint32_t GetTextureIndex() const { return textureIndex_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetLocalBounds ローカル空間のAABBの取得
+	 * \return
+	 */
+	const AABB &GetLocalBounds() const { return modelData_.bounds; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetBoundingSphere ローカル空間の境界球の取得
+	 * \return
+	 */
+	const BoundingSphere &GetBoundingSphere() const { return modelData_.boundingSphere; }
 
 	///--------------------------------------------------------------
 	///							メンバ変数
@@ -119,21 +143,21 @@ private:
 	//---------------------------------------
 	// 頂点データ
 	Microsoft::WRL::ComPtr<ID3D12Resource> vertexBuffer_;
-	//マテリアル
-	Microsoft::WRL::ComPtr <ID3D12Resource> materialBuffer_;
 
 	///---------------------------------------
 	/// バッファリソース内のデータを指すポインタ
 	//頂点
 	VertexData *vertexData_ = nullptr;
-	//マテリアル
-	Material *materialData_ = nullptr;
 
 	///---------------------------------------
 	/// バッファリソースの使い道を指すポインタ
 	//頂点
 	D3D12_VERTEX_BUFFER_VIEW vertexBufferView_;
 
+	//---------------------------------------
+	// マテリアル(描画のたびにフレームごとのリング領域へ書き込む)
+	Material materialData_ = {};
+
 	//---------------------------------------
 	// テクスチャ用変数
 	uint32_t textureIndex_ = 0;
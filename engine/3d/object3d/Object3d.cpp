@@ -21,6 +21,14 @@
 #include "TextureManager.h"
 
 
+///=============================================================================
+///						デストラクタ
+Object3d::~Object3d() {
+	if(object3dSetup_ && transformHandle_ != TransformHierarchy::kInvalidHandle) {
+		object3dSetup_->GetTransformHierarchy().Destroy(transformHandle_);
+	}
+}
+
 ///=============================================================================
 ///						初期化
 void Object3d::Initialize(Object3dSetup* object3dSetup) {
@@ -28,17 +36,16 @@ void Object3d::Initialize(Object3dSetup* object3dSetup) {
 	// 引数からSetupを受け取る
 	this->object3dSetup_ = object3dSetup;
 
-	//========================================
-	//トランスフォーメーションマトリックスバッファの作成
-	CreateTransformationMatrixBuffer();
-	//並行光源の作成
-	CreateDirectionalLight();
-	//カメラバッファの作成
-	CreateCameraBuffer();
-
 	//========================================
 	// ワールド行列の初期化
 	transform_ = { {1.0f,1.0f,1.0f},{0.0f,0.0f,0.0f},{0.0f,0.0f,0.0f} };
+	// 階層にノードを作る(作り直すときは前のノードを外す)
+	TransformHierarchy& transformHierarchy = object3dSetup_->GetTransformHierarchy();
+	if(transformHandle_ != TransformHierarchy::kInvalidHandle) {
+		transformHierarchy.Destroy(transformHandle_);
+	}
+	transformHandle_ = transformHierarchy.Create(transform_);
+	worldVersion_ = 0;
 
 	//========================================
 	// カメラの取得
@@ -49,34 +56,63 @@ void Object3d::Initialize(Object3dSetup* object3dSetup) {
 ///						更新
 void Object3d::Update() {
 	//========================================
-	// カメラの位置を取得
+	// カメラの取得
 	camera_ = object3dSetup_->GetDefaultCamera();
-	// カメラの位置を書き込む
-	cameraData_->worldPosition = camera_->GetTransform().translate;
 
 	//========================================
-	// TransformからWorld行列を作成
-	Matrix4x4 worldMatrix = MakeAffineMatrix(transform_.scale, transform_.rotate, transform_.translate);
-	Matrix4x4 worldViewProjectionMatrix;
+	// 階層の変更のあった部分だけワールド行列を求め直す
+	// NOTE:最初に呼んだObject3dがまとめて求め直し、残りは変更がないのですぐ戻る
+	TransformHierarchy& transformHierarchy = object3dSetup_->GetTransformHierarchy();
+	transformHierarchy.UpdateWorldMatrices();
 
 	//========================================
-	// カメラがセットされている場合はビュー行列を作成
+	// ワールド行列が変わったときだけ、逆行列と境界を作り直す
+	uint32_t worldVersion = transformHierarchy.GetWorldVersion(transformHandle_);
+	bool isWorldChanged = worldVersion != worldVersion_;
+	if(isWorldChanged) {
+		worldVersion_ = worldVersion;
+		const Matrix4x4& worldMatrix = transformHierarchy.GetWorldMatrix(transformHandle_);
+		transformationMatrixData_.World = worldMatrix;
+		// NOTE:ワールド行列はアフィン行列なので一般の逆行列は使わない
+		transformationMatrixData_.WorldInvTranspose = InverseAffine(worldMatrix);
+		// ワールド空間の境界(カリングに使う)
+		if(model_) {
+			worldBounds_ = TransformAABB(model_->GetLocalBounds(), worldMatrix);
+		}
+	}
+
+	//========================================
+	// ワールド行列かカメラが変わったときだけWVPを求め直す
+	uint32_t cameraVersion = camera_ ? camera_->GetVersion() : 0;
+	if(!isWorldChanged && camera_ == wvpCamera_ && cameraVersion == wvpCameraVersion_) {
+		return;
+	}
+	wvpCamera_ = camera_;
+	wvpCameraVersion_ = cameraVersion;
+	const Matrix4x4& worldMatrix = transformationMatrixData_.World;
 	if(camera_) {
-		// カメラのビュー行列を取得
-		const Matrix4x4& viewProjectionMatrix = camera_->GetViewProjectionMatrix();
+		// カメラから求めた値はこのフレームのものを共通で使う
 		// ワールドビュープロジェクション行列を計算
-		worldViewProjectionMatrix = Multiply4x4(worldMatrix, viewProjectionMatrix);
+		transformationMatrixData_.WVP = Multiply4x4(worldMatrix, camera_->GetSnapshot().viewProjectionMatrix);
 	} else {
 		// カメラがセットされていない場合はワールド行列をそのまま使う
 		// NOTE:カメラがセットされてなくても描画できるようにするため
-		worldViewProjectionMatrix = worldMatrix;
+		transformationMatrixData_.WVP = worldMatrix;
 	}
+}
 
-	//========================================
-	// トランスフォーメーションマトリックスバッファに書き込む
-	transformationMatrixData_->WVP = worldViewProjectionMatrix;
-	transformationMatrixData_->World = worldMatrix;
-	transformationMatrixData_->WorldInvTranspose = Inverse4x4(worldMatrix);
+///=============================================================================
+///						親の設定
+void Object3d::SetParent(Object3d* parent) {
+	object3dSetup_->GetTransformHierarchy().SetParent(transformHandle_, parent ? parent->transformHandle_ : TransformHierarchy::kInvalidHandle);
+}
+
+///=============================================================================
+///						Transformを階層に反映
+void Object3d::SyncTransform() {
+	if(transformHandle_ != TransformHierarchy::kInvalidHandle) {
+		object3dSetup_->GetTransformHierarchy().SetLocalTransform(transformHandle_, transform_);
+	}
 }
 
 ///=============================================================================
@@ -84,20 +120,39 @@ void Object3d::Update() {
 // NOTE:見た目を持たないオブジェクトが存在する
 void Object3d::Draw() {
 	//========================================
-	// モデルが存在しない場合は描画しない
-	if (!transfomationMatrixBuffer_) {
-		throw std::runtime_error("One or more buffers are not initialized.");
+	// まとめて描画しない場合は、ここで視錐台の外のものを落とす
+	// NOTE:まとめて描画する場合はFlushInstancesで全件まとめて判定する
+	if(model_ && !object3dSetup_->IsInstancingEnabled() && object3dSetup_->CullBounds(worldBounds_)) {
+		return;
 	}
 
+	//========================================
+	// 定数をフレームごとのリング領域に書き込む
+	// NOTE:GPUが前のフレームを実行中でも上書きしないよう、描画のたびに新しい領域へ書く
+	DirectXCore* dxCore = object3dSetup_->GetDXManager();
+	// ライトとカメラはObject3dSetupがフレームに1回書いたものを参照する
+	// NOTE:自分だけの光源を持つときだけ書く(同じ内容なら同じアドレスを使い回す)
+	D3D12_GPU_VIRTUAL_ADDRESS directionalLightAddress = hasOwnDirectionalLight_ ?
+		dxCore->UploadSharedConstantBuffer(directionalLightData_) : object3dSetup_->GetLightConstantAddress();
+	D3D12_GPU_VIRTUAL_ADDRESS cameraAddress = object3dSetup_->GetViewConstantAddress();
+
+	//========================================
+	// まとめて描画する場合は行列を預けるだけにする(描画はObject3dSetup::FlushInstances)
+	if(model_ && object3dSetup_->IsInstancingEnabled()) {
+		object3dSetup_->QueueInstance(model_, transformationMatrixData_, worldBounds_, directionalLightAddress, cameraAddress);
+		return;
+	}
+	D3D12_GPU_VIRTUAL_ADDRESS transformationMatrixAddress = dxCore->UploadConstantBuffer(transformationMatrixData_);
+
 	//========================================
 	// コマンドリスト取得
-	auto commandList = object3dSetup_->GetDXManager()->GetCommandList();
+	BaseCommandList* commandList = dxCore->GetRenderCommandList();
 	// トランスフォーメーションマトリックスバッファの設定
-	commandList->SetGraphicsRootConstantBufferView(1, transfomationMatrixBuffer_->GetGPUVirtualAddress());
-	// 並行光源の設定
-	commandList->SetGraphicsRootConstantBufferView(3, directionalLightBuffer_->GetGPUVirtualAddress());
-	// カメラバッファの設定
-	commandList->SetGraphicsRootConstantBufferView(4, cameraBuffer_->GetGPUVirtualAddress());
+	commandList->SetGraphicsRootConstantBufferView(1, transformationMatrixAddress);
+	// 並行光源・カメラの設定
+	// NOTE:CommonDrawSetupで設定済みのアドレスと同じなら、ステートフィルタが再設定を落とす
+	commandList->SetGraphicsRootConstantBufferView(3, directionalLightAddress);
+	commandList->SetGraphicsRootConstantBufferView(4, cameraAddress);
 
 	//========================================
 	// 描画コール
@@ -107,53 +162,14 @@ void Object3d::Draw() {
 }
 
 
+///=============================================================================
+///						並行光源の取得
+const DirectionalLight& Object3d::GetDirectionalLight() const {
+	return hasOwnDirectionalLight_ ? directionalLightData_ : object3dSetup_->GetDirectionalLight();
+}
+
 ///=============================================================================
 ///						テクスチャの変更
 void Object3d::ChangeTexture(const std::string &texturePath) {
 	model_->ChangeTexture(texturePath);
 }
-
-
-///--------------------------------------------------------------
-///						 座標変換行列
-void Object3d::CreateTransformationMatrixBuffer() {
-	// 定数バッファのサイズを 256 バイトの倍数に設定
-	size_t bufferSize = (sizeof(TransformationMatrix) + 255) & ~255;
-	transfomationMatrixBuffer_ = object3dSetup_->GetDXManager()->CreateBufferResource(bufferSize);
-	// 書き込み用変数
-	TransformationMatrix transformationMatrix = {};
-	// 書き込むためのアドレスを取得
-	transfomationMatrixBuffer_->Map(0, nullptr, reinterpret_cast<void**>(&transformationMatrixData_));
-	// 書き込み
-	transformationMatrix.WVP = Identity4x4();
-	// 単位行列を書き込む
-	*transformationMatrixData_ = transformationMatrix;
-}
-
-///--------------------------------------------------------------
-///						 並行光源の作成
-void Object3d::CreateDirectionalLight() {
-	size_t bufferSize = (sizeof(DirectionalLight) + 255) & ~255;
-	directionalLightBuffer_ = object3dSetup_->GetDXManager()->CreateBufferResource(bufferSize);
-	// 並行光源書き込み用データ
-	DirectionalLight directionalLight{};
-	// 書き込むためのアドレス取得
-	directionalLightBuffer_->Map(0, nullptr, reinterpret_cast<void**>(&directionalLightData_));
-	// 書き込み
-	directionalLight.color = { 1.0f,1.0f,1.0f,1.0f };
-	directionalLight.direction = { 0.0f,-1.0f,0.0f };
-	directionalLight.intensity = 32.0f;
-	*directionalLightData_ = directionalLight;
-}
-
-///--------------------------------------------------------------
-///						 カメラバッファの作成
-void Object3d::CreateCameraBuffer() {
-	size_t bufferSize = (sizeof(CameraForGpu) + 255) & ~255;
-	cameraBuffer_ = object3dSetup_->GetDXManager()->CreateBufferResource(bufferSize);
-	cameraBuffer_->Map(0, nullptr, reinterpret_cast<void**>(&cameraData_));
-	// カメラの位置を書き込む
-	CameraForGpu cameraForGpu = {};
-	cameraForGpu.worldPosition = { 1.0f, 1.0f, 1.0f };
-	*cameraData_ = cameraForGpu;
-}
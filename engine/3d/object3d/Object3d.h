@@ -9,9 +9,13 @@
 #pragma once
 #include "TransformationMatrix.h"
 #include "DirectionalLight.h"
+#include "CameraForGpu.h"
 #include "Transform.h"
+#include "BoundingVolume.h"
 #include "Model.h"
 #include "ModelManager.h"
+#include "MathFunc4x4.h"
+#include "TransformHierarchy.h"
  //========================================
  // DX12include
 #include<d3d12.h>
@@ -24,16 +28,21 @@
 #include <dxcapi.h>
 #pragma comment(lib,"dxcompiler.lib")
 
-struct CameraForGpu {
-	Vector3 worldPosition;
-};
-
 class Object3dSetup;
 class Camera;
 class Object3d {
 	///--------------------------------------------------------------
 	///							メンバ関数
 public:
+	/// \brief コンストラクタ
+	Object3d() = default;
+
+	/// \brief デストラクタ(Transformの階層からノードを外す)
+	~Object3d();
+
+	// 階層のノードを持つのでコピーしない
+	Object3d(const Object3d&) = delete;
+	Object3d& operator=(const Object3d&) = delete;
 
 	/// \brief 初期化
 	void Initialize(Object3dSetup* object3dSetup);
@@ -47,27 +56,6 @@ public:
 	/// \brief ImGui描画
 	void ChangeTexture(const std::string &texturePath);
 
-	///--------------------------------------------------------------
-	///						 静的メンバ関数
-private:
-	/**----------------------------------------------------------------------------
-	 * \brief  トランスフォーメーションマトリックスバッファの作成
-	 * \note
-	 */
-	void CreateTransformationMatrixBuffer();
-
-	/**----------------------------------------------------------------------------
-	 * \brief  並行光源の作成
-	 * \note
-	 */
-	void CreateDirectionalLight();
-
-	/**----------------------------------------------------------------------------
-	 * \brief  カメラバッファの作成
-	 * \note
-	 */
-	void CreateCameraBuffer();
-
 	///--------------------------------------------------------------
 	///							入出力関数
 public:
@@ -76,21 +64,31 @@ public:
 	* \param  filePath ファイルパス
 	* \note
 	*/
-	void SetModel(const std::string& filePath) {model_ = ModelManager::GetInstance()->FindModel(filePath);}
+	void SetModel(const std::string& filePath) {
+		model_ = ModelManager::GetInstance()->FindModel(filePath);
+		// 境界をモデルに合わせて求め直す
+		worldVersion_ = 0;
+	}
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetTransform トランスフォーメーションの設定
 	 * \param  transform トランスフォーメーション
-	 * \note
+	 * \note   親があるときは親から見た値
 	 */
-	void SetTransform(const Transform& transform) { transform_ = transform; }
+	void SetTransform(const Transform& transform) {
+		transform_ = transform;
+		SyncTransform();
+	}
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetModel モデルの設定
 	 * \param  model モデル
 	 * \note
 	 */
-	void SetScale(const Vector3& scale) { transform_.scale = scale; }
+	void SetScale(const Vector3& scale) {
+		transform_.scale = scale;
+		SyncTransform();
+	}
 	/**----------------------------------------------------------------------------
 	 * \brief  GetScale スケールの取得
 	 * \return Vector3 スケール
@@ -103,7 +101,10 @@ public:
 	 * \param  rotate 回転
 	 * \note
 	 */
-	void SetRotation(const Vector3& rotate) { transform_.rotate = rotate; }
+	void SetRotation(const Vector3& rotate) {
+		transform_.rotate = rotate;
+		SyncTransform();
+	}
 	/**----------------------------------------------------------------------------
 	 * \brief  GetRotate 回転の取得
 	 * \return Vector3 回転
@@ -116,7 +117,10 @@ public:
 	 * \param  translate 移動
 	 * \note
 	 */
-	void SetPosition(const Vector3& translate) { transform_.translate = translate; } 
+	void SetPosition(const Vector3& translate) {
+		transform_.translate = translate;
+		SyncTransform();
+	}
 	/**----------------------------------------------------------------------------
 	 * \brief  GetTranslate 移動の取得
 	 * \return Vector3 移動
@@ -124,6 +128,19 @@ public:
 	 */
 	const Vector3& GetPosition() const { return transform_.translate; }
 
+	/**----------------------------------------------------------------------------
+	 * \brief  SetParent 親の設定
+	 * \param  parent 親(nullptrなら外す。自分の子孫は指定できない)
+	 * \note   Transformは親から見た値になる。親が動くと子のワールド行列も次のUpdateで求め直す
+	 */
+	void SetParent(Object3d* parent);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetWorldMatrix ワールド行列の取得
+	 * \return Updateで求めた親を含むワールド行列
+	 */
+	const Matrix4x4& GetWorldMatrix() const { return transformationMatrixData_.World; }
+
 	/**----------------------------------------------------------------------------
 	 * \brief  SetCamera カメラの設定
 	 * \param  camera
@@ -135,18 +152,20 @@ public:
 	 * \param  color
 	 * \param  direction
 	 * \param  intensity
+	 * \note   設定するとこのオブジェクトだけの光源になる(設定しなければObject3dSetupの光源を使う)
 	 */
 	void SetDirectionalLight(const Vector4 &color, const Vector3 &direction, float intensity) {
-		directionalLightData_->color = color;
-		directionalLightData_->direction = direction;
-		directionalLightData_->intensity = intensity;
+		directionalLightData_.color = color;
+		directionalLightData_.direction = direction;
+		directionalLightData_.intensity = intensity;
+		hasOwnDirectionalLight_ = true;
 	}
 
 	/**----------------------------------------------------------------------------
 	 * \brief  GetDirectionalLight 並行光源の取得
-	 * \return 
+	 * \return このオブジェクトの光源(設定していなければObject3dSetupの光源)
 	 */
-	const DirectionalLight &GetDirectionalLight() const { return *directionalLightData_; }
+	const DirectionalLight &GetDirectionalLight() const;
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetMaterialColor マテリアルカラーの設定
@@ -172,6 +191,18 @@ public:
 	 */
 	float GetShininess() const { return model_->GetShininess(); }
 
+	/**----------------------------------------------------------------------------
+	 * \brief  GetWorldBounds ワールド空間のAABBの取得
+	 * \return Updateで求めたAABB
+	 */
+	const AABB &GetWorldBounds() const { return worldBounds_; }
+
+	///--------------------------------------------------------------
+	///							内部処理
+private:
+	/// \brief Transformを階層に反映する(ワールド行列は次のUpdateで求め直す)
+	void SyncTransform();
+
 	///--------------------------------------------------------------
 	///							メンバ変数
 private:
@@ -185,26 +216,29 @@ private:
 	Model* model_ = nullptr;
 
 	//---------------------------------------
+	// 定数バッファに書き込むデータ
+	// NOTE:描画時にDirectXCoreのフレームごとのリング領域へ書き込む
 	//トランスフォーメーションマトリックス
-	Microsoft::WRL::ComPtr <ID3D12Resource> transfomationMatrixBuffer_;
-	//並行光源
-	Microsoft::WRL::ComPtr <ID3D12Resource> directionalLightBuffer_;
-	//カメラ
-	Microsoft::WRL::ComPtr <ID3D12Resource> cameraBuffer_;
-
-
-	//---------------------------------------
-	// バッファリソース内のデータを指すポインタ
-	//トランスフォーメーションマトリックス
-	TransformationMatrix* transformationMatrixData_ = nullptr;
-	//並行光源
-	DirectionalLight* directionalLightData_ = nullptr;
-	//カメラ
-	CameraForGpu *cameraData_ = nullptr;
+	TransformationMatrix transformationMatrixData_ = { Identity4x4(), Identity4x4(), Identity4x4() };
+	//並行光源(SetDirectionalLightで設定したときだけ使う)
+	DirectionalLight directionalLightData_ = { { 1.0f,1.0f,1.0f,1.0f }, { 0.0f,-1.0f,0.0f }, 32.0f };
+	bool hasOwnDirectionalLight_ = false;
+	// NOTE:カメラの定数はObject3dSetupがフレームに1回書いたものを使う
 
 	//--------------------------------------
 	// Transform
 	Transform transform_ = {};
+	// 階層のノード
+	uint32_t transformHandle_ = TransformHierarchy::kInvalidHandle;
+	// 最後に行列を作ったときのワールド行列の版(0はまだ作っていない)
+	uint32_t worldVersion_ = 0;
+	// 最後にWVPを作ったときのカメラとその版
+	const Camera* wvpCamera_ = nullptr;
+	uint32_t wvpCameraVersion_ = 0;
+
+	//--------------------------------------
+	// ワールド空間の境界
+	AABB worldBounds_ = {};
 
 	//--------------------------------------
 	// カメラ
@@ -7,7 +7,12 @@
  * \note   
  *********************************************************************/
 #include "Object3dSetup.h"
+#include "Model.h"
 #include "Logger.h"
+#include "MathFunc4x4.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
 using namespace Logger;
 
 ///=============================================================================
@@ -15,6 +20,7 @@ using namespace Logger;
 void Object3dSetup::Initialize(DirectXCore* dxCore) {
 	/// ===引数でdxManagerを受取=== ///
 	dxCore_ = dxCore;
+	lightClusterThreadCount_ = ( std::max )( 1u, std::thread::hardware_concurrency() );
 
 	/// ===グラフィックスパイプラインの生成=== ///
 	CreateGraphicsPipeline();
@@ -25,13 +31,199 @@ void Object3dSetup::Initialize(DirectXCore* dxCore) {
 void Object3dSetup::CommonDrawSetup() {
 	//コマンドリストの取得
 	// NOTE:Getを複数回呼び出すのは非効率的なので、変数に保持しておく
-	auto commandList = dxCore_->GetCommandList();
+	BaseCommandList* commandList = dxCore_->GetRenderCommandList();
 	//ルートシグネイチャのセット
 	commandList->SetGraphicsRootSignature(rootSignature_.Get());
 	//グラフィックスパイプラインステートをセット
 	commandList->SetPipelineState(graphicsPipelineState_.Get());
 	//プリミティブトポロジーをセットする
-	commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	commandList->IASetPrimitiveTopology(PrimitiveTopology::kTriangleList);
+
+	//========================================
+	// このフレームの視錐台
+	// NOTE:Object3d::Updateと同じく、カメラの行列は描画より前に更新されている。視錐台はカメラが求めたものを使う
+	hasFrustum_ = defaultCamera_ != nullptr;
+	if(hasFrustum_) {
+		frustum_ = defaultCamera_->GetSnapshot().frustum;
+	}
+	culledCount_ = 0;
+
+	//========================================
+	// カメラと並行光源の定数(Object3dすべてで共通なのでフレームに1回だけ書く)
+	CameraForGpu cameraData = { { 1.0f, 1.0f, 1.0f } };
+	if(defaultCamera_) {
+		cameraData.worldPosition = defaultCamera_->GetSnapshot().worldPosition;
+	}
+	viewConstantAddress_ = dxCore_->UploadConstantBuffer(cameraData);
+	lightConstantAddress_ = dxCore_->UploadConstantBuffer(directionalLight_);
+	// パスの最初に1回設定する(同じアドレスの再設定はステートフィルタが落とす)
+	commandList->SetGraphicsRootConstantBufferView(3, lightConstantAddress_);
+	commandList->SetGraphicsRootConstantBufferView(4, viewConstantAddress_);
+
+	//========================================
+	// 点光源・スポットライトをクラスタに割り当てて書き込む
+	if(defaultCamera_) {
+		const CameraSnapshot& snapshot = defaultCamera_->GetSnapshot();
+		lightCluster_.Build(punctualLights_, snapshot.viewMatrix, snapshot.projectionMatrix,
+			defaultCamera_->GetNearClip(), defaultCamera_->GetFarClip(), lightClusterThreadCount_);
+	} else {
+		//カメラがなければライトを使わない
+		lightCluster_.Build({}, Identity4x4(), Identity4x4(), 0.1f, 100.0f);
+	}
+	lightClusterConstantAddress_ = dxCore_->UploadConstantBuffer(
+		lightCluster_.MakeGpuParams(static_cast<float>( WinApp::kWindowWidth_ ), static_cast<float>( WinApp::kWindowHeight_ )));
+	// NOTE:ルートSRVは空にできないので、ライトがなくても1つ分は確保する
+	auto uploadArray = [&](const void* data, size_t elementSize, size_t count) {
+		UploadAllocation allocation = dxCore_->AllocateUpload(elementSize * ( std::max )( count, size_t(1) ));
+		if(count > 0) {
+			std::memcpy(allocation.cpuAddress, data, elementSize * count);
+		}
+		return allocation.gpuAddress;
+	};
+	punctualLightAddress_ = uploadArray(punctualLights_.data(), sizeof(PunctualLight), punctualLights_.size());
+	clusterRangeAddress_ = uploadArray(lightCluster_.GetRanges().data(), sizeof(LightCluster::Range), lightCluster_.GetRanges().size());
+	clusterLightIndexAddress_ = uploadArray(lightCluster_.GetLightIndices().data(), sizeof(uint32_t), lightCluster_.GetLightIndices().size());
+	BindLightCluster(commandList);
+
+	//========================================
+	// このフレームの更新で求め直したワールド行列の数
+	transformUpdateCount_ = transformHierarchy_.GetUpdatedCount();
+	transformHierarchy_.ResetUpdatedCount();
+}
+
+///=============================================================================
+///						 インスタンス描画の予約
+void Object3dSetup::QueueInstance(Model* model, const TransformationMatrix& transformationMatrix, const AABB& worldBounds,
+	D3D12_GPU_VIRTUAL_ADDRESS directionalLightAddress, D3D12_GPU_VIRTUAL_ADDRESS cameraAddress) {
+	InstanceEntry entry;
+	entry.model = model;
+	entry.directionalLightAddress = directionalLightAddress;
+	entry.cameraAddress = cameraAddress;
+	instanceEntries_.push_back(entry);
+	instanceMatrices_.push_back(transformationMatrix);
+	frustumCuller_.Push(worldBounds);
+}
+
+///=============================================================================
+///						 予約したインスタンスの描画
+void Object3dSetup::FlushInstances() {
+	instanceCount_ = 0;
+	instancedDrawCount_ = 0;
+	if(instanceEntries_.empty()) {
+		return;
+	}
+	//========================================
+	// 視錐台の外のものを落とす(SoAにした境界を4つずつ判定する)
+	const std::vector<uint32_t>* visibleIndices = nullptr;
+	if(isCullingEnabled_ && hasFrustum_) {
+		frustumCuller_.Cull(frustum_);
+		visibleIndices = &frustumCuller_.GetVisibleIndices();
+		culledCount_ += static_cast<uint32_t>( instanceEntries_.size() - visibleIndices->size() );
+	}
+	uint32_t visibleCount = visibleIndices ? static_cast<uint32_t>( visibleIndices->size() ) : static_cast<uint32_t>( instanceEntries_.size() );
+	instanceCount_ = visibleCount;
+	if(visibleCount == 0) {
+		instanceEntries_.clear();
+		instanceMatrices_.clear();
+		frustumCuller_.Clear();
+		return;
+	}
+
+	//========================================
+	// ソートキーを作って並べ替える
+	// NOTE:マテリアル・組の番号はこのフレームで出てきた順に振る。ビット数を超えて重なっても、
+	//      まとめる判定は実際の値で行うので描画は壊れない(並びが少し悪くなるだけ)
+	float farClip = defaultCamera_ ? defaultCamera_->GetFarClip() : 100.0f;
+	renderQueue_.Clear();
+	renderQueue_.Reserve(visibleCount);
+	modelIds_.clear();
+	variants_.clear();
+	for(uint32_t visible = 0; visible < visibleCount; ++visible) {
+		uint32_t i = visibleIndices ? ( *visibleIndices )[visible] : visible;
+		const InstanceEntry& entry = instanceEntries_[i];
+		RenderSortKeyDesc desc;
+		desc.pass = RenderQueuePass::kOpaque;
+		desc.material = modelIds_.try_emplace(entry.model, static_cast<uint32_t>( modelIds_.size() )).first->second;
+		desc.texture = entry.model->GetTextureIndex();
+		//ライトとカメラの組はほとんど1つなので線形に探す
+		std::pair<D3D12_GPU_VIRTUAL_ADDRESS, D3D12_GPU_VIRTUAL_ADDRESS> variant(entry.directionalLightAddress, entry.cameraAddress);
+		auto it = std::find(variants_.begin(), variants_.end(), variant);
+		desc.variant = static_cast<uint32_t>( it - variants_.begin() );
+		if(it == variants_.end()) {
+			variants_.push_back(variant);
+		}
+		//WVPの(3,3)は原点のクリップ空間のw、つまりカメラからの奥行き
+		desc.depth = RenderSortKey::QuantizeDepth(instanceMatrices_[i].WVP.m[3][3], farClip);
+		renderQueue_.Push(RenderSortKey::Make(desc), i);
+	}
+	renderQueue_.Sort();
+	const std::vector<RenderPacket>& packets = renderQueue_.GetPackets();
+
+	//========================================
+	// 並べ替えた順に1つの構造化バッファへ書き込む(フレームに1回の確保で済ませる)
+	UploadAllocation allocation = dxCore_->AllocateUpload(sizeof(TransformationMatrix) * packets.size());
+	TransformationMatrix* matrices = static_cast<TransformationMatrix*>( allocation.cpuAddress );
+	for(size_t i = 0; i < packets.size(); ++i) {
+		matrices[i] = instanceMatrices_[packets[i].index];
+	}
+
+	//========================================
+	// 同じモデル・ライト・カメラの並びごとに1回描画する
+	BaseCommandList* commandList = dxCore_->GetRenderCommandList();
+	commandList->SetGraphicsRootSignature(instancingRootSignature_.Get());
+	commandList->SetPipelineState(instancingPipelineState_.Get());
+	commandList->IASetPrimitiveTopology(PrimitiveTopology::kTriangleList);
+	BindLightCluster(commandList);
+	size_t first = 0;
+	while(first < packets.size()) {
+		const InstanceEntry& entry = instanceEntries_[packets[first].index];
+		size_t last = first + 1;
+		while(last < packets.size()) {
+			const InstanceEntry& next = instanceEntries_[packets[last].index];
+			if(next.model != entry.model || next.directionalLightAddress != entry.directionalLightAddress || next.cameraAddress != entry.cameraAddress) {
+				break;
+			}
+			++last;
+		}
+		commandList->SetGraphicsRootShaderResourceView(1, allocation.gpuAddress + sizeof(TransformationMatrix) * first);
+		commandList->SetGraphicsRootConstantBufferView(3, entry.directionalLightAddress);
+		commandList->SetGraphicsRootConstantBufferView(4, entry.cameraAddress);
+		entry.model->InstancingDraw(static_cast<uint32_t>( last - first ));
+		++instancedDrawCount_;
+		first = last;
+	}
+	instanceEntries_.clear();
+	instanceMatrices_.clear();
+	frustumCuller_.Clear();
+}
+
+///=============================================================================
+///						 点光源・スポットライトの設定
+void Object3dSetup::SetPunctualLights(std::span<const PunctualLight> lights) {
+	if(lights.size() > kMaxPunctualLights) {
+		Log("Object3dSetup: too many punctual lights, extra lights are ignored", LogLevel::Warning);
+		lights = lights.first(kMaxPunctualLights);
+	}
+	punctualLights_.assign(lights.begin(), lights.end());
+}
+
+///=============================================================================
+///						 ライトのクラスタの設定
+void Object3dSetup::BindLightCluster(BaseCommandList* commandList) {
+	commandList->SetGraphicsRootConstantBufferView(5, lightClusterConstantAddress_);
+	commandList->SetGraphicsRootShaderResourceView(6, punctualLightAddress_);
+	commandList->SetGraphicsRootShaderResourceView(7, clusterRangeAddress_);
+	commandList->SetGraphicsRootShaderResourceView(8, clusterLightIndexAddress_);
+}
+
+///=============================================================================
+///						 1つの境界の視錐台カリング
+bool Object3dSetup::CullBounds(const AABB& worldBounds) {
+	if(!isCullingEnabled_ || !hasFrustum_ || frustum_.Intersects(worldBounds)) {
+		return false;
+	}
+	++culledCount_;
+	return true;
 }
 
 ///=============================================================================
@@ -46,7 +238,7 @@ void Object3dSetup::CreateRootSignature() {
 	descriptorRange[0].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
 	descriptorRange[0].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
-	D3D12_ROOT_PARAMETER rootParameters[5] = {};
+	D3D12_ROOT_PARAMETER rootParameters[9] = {};
 	rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
 	rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 	rootParameters[0].Descriptor.ShaderRegister = 0;
@@ -68,6 +260,18 @@ void Object3dSetup::CreateRootSignature() {
 	rootParameters[4].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 	rootParameters[4].Descriptor.ShaderRegister = 2;
 
+	//点光源・スポットライトのクラスタ(b3)
+	rootParameters[5].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootParameters[5].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+	rootParameters[5].Descriptor.ShaderRegister = 3;
+
+	//ライト・クラスタの範囲・ライトの番号の構造化バッファ(t1~t3)
+	for(UINT i = 0; i < 3; ++i) {
+		rootParameters[6 + i].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+		rootParameters[6 + i].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+		rootParameters[6 + i].Descriptor.ShaderRegister = 1 + i;
+	}
+
 	descriptionRootSignature.pParameters = rootParameters;
 	descriptionRootSignature.NumParameters = _countof(rootParameters);
 
@@ -83,18 +287,30 @@ void Object3dSetup::CreateRootSignature() {
 	descriptionRootSignature.pStaticSamplers = staticSamplers;
 	descriptionRootSignature.NumStaticSamplers = _countof(staticSamplers);
 
-	Microsoft::WRL::ComPtr <ID3DBlob> signatureBlob = nullptr;
-	Microsoft::WRL::ComPtr <ID3DBlob> errorBlob = nullptr;
-	HRESULT hr = D3D12SerializeRootSignature(&descriptionRootSignature, D3D_ROOT_SIGNATURE_VERSION_1, &signatureBlob, &errorBlob);
-	if(FAILED(hr)) {
-		throw std::runtime_error(reinterpret_cast<char*>( errorBlob->GetBufferPointer() ));
-	}
+	auto createRootSignature = [&](Microsoft::WRL::ComPtr<ID3D12RootSignature>& rootSignature) {
+		Microsoft::WRL::ComPtr <ID3DBlob> signatureBlob = nullptr;
+		Microsoft::WRL::ComPtr <ID3DBlob> errorBlob = nullptr;
+		HRESULT hr = D3D12SerializeRootSignature(&descriptionRootSignature, D3D_ROOT_SIGNATURE_VERSION_1, &signatureBlob, &errorBlob);
+		if(FAILED(hr)) {
+			throw std::runtime_error(reinterpret_cast<char*>( errorBlob->GetBufferPointer() ));
+		}
 
-	hr = dxCore_->GetDevice()->CreateRootSignature(0, signatureBlob->GetBufferPointer(), signatureBlob->GetBufferSize(), IID_PPV_ARGS(&rootSignature_));
-	if(FAILED(hr)) {
-		throw std::runtime_error("Failed to create root signature");
-	}
+		hr = dxCore_->GetDevice()->CreateRootSignature(0, signatureBlob->GetBufferPointer(), signatureBlob->GetBufferSize(), IID_PPV_ARGS(&rootSignature));
+		if(FAILED(hr)) {
+			throw std::runtime_error("Failed to create root signature");
+		}
+	};
+	createRootSignature(rootSignature_);
 	Log("Object3d Root signature created successfully :), LogLevel::SUCCESS");
+
+	//========================================
+	// インスタンス描画用
+	//NOTE:行列だけをインスタンスごとの構造化バッファ(VSのt1)に差し替え、他のパラメータ番号はそろえる
+	rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+	rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+	rootParameters[1].Descriptor.ShaderRegister = 1;
+	createRootSignature(instancingRootSignature_);
+	Log("Object3d Instancing root signature created successfully :)", LogLevel::Success);
 }
 
 
@@ -196,10 +412,30 @@ void Object3dSetup::CreateGraphicsPipeline() {
 
 	//========================================
 	// 実際に生成
-	HRESULT hr = dxCore_->GetDevice()->CreateGraphicsPipelineState(&graphicsPipelineStateDesc,
-		IID_PPV_ARGS(&graphicsPipelineState_));
-	if(FAILED(hr)) {
+	//NOTE:キャッシュ経由で生成し、次回起動時はパイプラインライブラリから読み込む
+	graphicsPipelineState_ = dxCore_->GetPipelineStateCache()->GetOrCreate(graphicsPipelineStateDesc);
+	if(!graphicsPipelineState_) {
 		throw std::runtime_error("ENGINE MESSAGE: Object3d Failed to create graphics pipeline state :(");
 	}
 	Log("Object3d Graphics pipeline state created successfully :)", LogLevel::Success);
+
+	//========================================
+	// インスタンス描画用
+	CreateInstancingGraphicsPipeline(graphicsPipelineStateDesc);
+}
+
+///=============================================================================
+///						 インスタンス描画用パイプラインの作成
+void Object3dSetup::CreateInstancingGraphicsPipeline(D3D12_GRAPHICS_PIPELINE_STATE_DESC graphicsPipelineStateDesc) {
+	Microsoft::WRL::ComPtr <IDxcBlob> vertexShaderBlob = dxCore_->CompileShader(L"resources/shader/Object3dInstancing.VS.hlsl", L"vs_6_0");
+	if(!vertexShaderBlob) {
+		throw std::runtime_error("ENGINE MESSAGE: Object3d Failed to compile instancing vertex shader :(");
+	}
+	graphicsPipelineStateDesc.pRootSignature = instancingRootSignature_.Get();
+	graphicsPipelineStateDesc.VS = { vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize() };
+	instancingPipelineState_ = dxCore_->GetPipelineStateCache()->GetOrCreate(graphicsPipelineStateDesc);
+	if(!instancingPipelineState_) {
+		throw std::runtime_error("ENGINE MESSAGE: Object3d Failed to create instancing graphics pipeline state :(");
+	}
+	Log("Object3d Instancing graphics pipeline state created successfully :)", LogLevel::Success);
 }
@@ -9,6 +9,20 @@
 #pragma once
 #include "DirectXCore.h"
 #include "Camera.h"
+#include "TransformationMatrix.h"
+#include "DirectionalLight.h"
+#include "CameraForGpu.h"
+#include "RenderQueue.h"
+#include "FrustumCuller.h"
+#include "TransformHierarchy.h"
+#include "LightCluster.h"
+#include "PunctualLight.h"
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Model;
 
 
  ///=============================================================================
@@ -26,10 +40,41 @@ public:
 
 	/**----------------------------------------------------------------------------
 	 * \brief  CommonDrawSetup 共通描画設定
-	 * \note
+	 * \note   デフォルトカメラからこのフレームの視錐台も作る。
+	 *         カメラと並行光源の定数をフレームに1回だけ書き込み、パスの最初に設定する。
+	 *         点光源・スポットライトのクラスタへの割り当てもここで行う
 	 */
 	void CommonDrawSetup();
 
+	/**----------------------------------------------------------------------------
+	 * \brief  QueueInstance インスタンス描画の予約
+	 * \param  model モデル
+	 * \param  transformationMatrix このインスタンスの行列
+	 * \param  worldBounds ワールド空間のAABB(視錐台カリングに使う)
+	 * \param  directionalLightAddress 並行光源のCBV
+	 * \param  cameraAddress カメラのCBV
+	 * \note   Object3d::Drawから呼ぶ。Object3dは1つのパスでしか描かないのでロックしない
+	 */
+	void QueueInstance(Model* model, const TransformationMatrix& transformationMatrix, const AABB& worldBounds,
+		D3D12_GPU_VIRTUAL_ADDRESS directionalLightAddress, D3D12_GPU_VIRTUAL_ADDRESS cameraAddress);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  FlushInstances 予約したインスタンスをまとめて描画
+	 * \note   視錐台の外のものをまとめて落としてから、
+	 *         モデル(=マテリアル・テクスチャ)・ライト・カメラが同じものを1回の描画にまとめる。
+	 *         描画キューでステート順・手前から奥へ並べ替えるので、まとめた中も手前から描かれる。
+	 *         Object3dの描画をすべて予約した後に呼ぶ
+	 */
+	void FlushInstances();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  CullBounds 1つの境界を視錐台と判定する
+	 * \param  worldBounds ワールド空間のAABB
+	 * \return 視錐台の外で描かなくてよいならtrue(落とした数に数える)
+	 * \note   まとめて描画しないときのObject3d::Drawから使う
+	 */
+	bool CullBounds(const AABB& worldBounds);
+
 
 	///--------------------------------------------------------------
 	///						 静的メンバ関数
@@ -47,6 +92,19 @@ private:
 	 */
 	void CreateGraphicsPipeline();
 
+	/**----------------------------------------------------------------------------
+	 * \brief  CreateInstancingGraphicsPipeline インスタンス描画用パイプラインの作成
+	 * \param  graphicsPipelineStateDesc 通常のパイプラインの設定(VSとルートシグネチャだけ差し替える)
+	 */
+	void CreateInstancingGraphicsPipeline(D3D12_GRAPHICS_PIPELINE_STATE_DESC graphicsPipelineStateDesc);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  BindLightCluster ライトのクラスタをルートパラメータ5~8に設定する
+	 * \param  commandList
+	 * \note   ルートシグネチャを切り替えると設定が消えるので、切り替えた後に呼ぶ
+	 */
+	void BindLightCluster(BaseCommandList* commandList);
+
 	///--------------------------------------------------------------
 	///							入出力関数
 public:
@@ -68,6 +126,95 @@ public:
 	*/
 	Camera* GetDefaultCamera() { return defaultCamera_; }
 
+	/**----------------------------------------------------------------------------
+	 * \brief  SetDirectionalLight 並行光源の設定
+	 * \param  directionalLight 自分の光源を持たないObject3dすべてに使う光源(次のCommonDrawSetupで反映)
+	 */
+	void SetDirectionalLight(const DirectionalLight& directionalLight) { directionalLight_ = directionalLight; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetDirectionalLight 並行光源の取得
+	 */
+	const DirectionalLight& GetDirectionalLight() const { return directionalLight_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetViewConstantAddress このフレームのカメラの定数のアドレス
+	 * \note   CommonDrawSetupで書き込む
+	 */
+	D3D12_GPU_VIRTUAL_ADDRESS GetViewConstantAddress() const { return viewConstantAddress_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetLightConstantAddress このフレームの並行光源の定数のアドレス
+	 * \note   CommonDrawSetupで書き込む
+	 */
+	D3D12_GPU_VIRTUAL_ADDRESS GetLightConstantAddress() const { return lightConstantAddress_; }
+
+	/// \brief 設定できる点光源・スポットライトの数の上限
+	static constexpr size_t kMaxPunctualLights = 4096;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  SetPunctualLights 点光源・スポットライトの設定
+	 * \param  lights すべてのObject3dに使うライト(kMaxPunctualLightsを超えた分は使わない)
+	 * \note   次のCommonDrawSetupでクラスタに割り当てる
+	 */
+	void SetPunctualLights(std::span<const PunctualLight> lights);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetPunctualLights 点光源・スポットライトの取得
+	 */
+	const std::vector<PunctualLight>& GetPunctualLights() const { return punctualLights_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetLightCluster 直前のフレームのライトの割り当ての取得
+	 */
+	const LightCluster& GetLightCluster() const { return lightCluster_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  SetInstancingEnabled Object3dの描画をまとめるかの設定
+	 */
+	void SetInstancingEnabled(bool isEnabled) { isInstancingEnabled_ = isEnabled; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  IsInstancingEnabled Object3dの描画をまとめているか
+	 */
+	bool IsInstancingEnabled() const { return isInstancingEnabled_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetInstanceCount 直前のFlushInstancesで描いたインスタンス数
+	 */
+	uint32_t GetInstanceCount() const { return instanceCount_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetInstancedDrawCount 直前のFlushInstancesの描画コール数
+	 */
+	uint32_t GetInstancedDrawCount() const { return instancedDrawCount_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  SetCullingEnabled 視錐台カリングをするかの設定
+	 */
+	void SetCullingEnabled(bool isEnabled) { isCullingEnabled_ = isEnabled; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  IsCullingEnabled 視錐台カリングをしているか
+	 */
+	bool IsCullingEnabled() const { return isCullingEnabled_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetCulledCount 直前のフレームで視錐台の外として落とした数
+	 */
+	uint32_t GetCulledCount() const { return culledCount_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetTransformHierarchy Object3dのTransformの階層の取得
+	 * \note   Object3dはInitializeでここにノードを作り、親子関係と変更の有無を預ける
+	 */
+	TransformHierarchy& GetTransformHierarchy() { return transformHierarchy_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetTransformUpdateCount 直前のフレームでワールド行列を求め直した数
+	 */
+	uint32_t GetTransformUpdateCount() const { return transformUpdateCount_; }
+
 
 	///--------------------------------------------------------------
 	///							メンバ変数
@@ -86,7 +233,69 @@ private:
 	// グラフィックスパイプライン
 	Microsoft::WRL::ComPtr<ID3D12PipelineState> graphicsPipelineState_;
 
+	//========================================
+	// インスタンス描画用(ルートパラメータ1が構造化バッファのルートSRVになる)
+	Microsoft::WRL::ComPtr<ID3D12RootSignature> instancingRootSignature_;
+	Microsoft::WRL::ComPtr<ID3D12PipelineState> instancingPipelineState_;
+
 	//========================================
 	// デフォルトカメラ
 	Camera* defaultCamera_ = nullptr;
+
+	//========================================
+	// フレームごとの共通の定数
+	// 並行光源
+	DirectionalLight directionalLight_ = { { 1.0f,1.0f,1.0f,1.0f }, { 0.0f,-1.0f,0.0f }, 32.0f };
+	// このフレームで書き込んだアドレス
+	D3D12_GPU_VIRTUAL_ADDRESS viewConstantAddress_ = 0;
+	D3D12_GPU_VIRTUAL_ADDRESS lightConstantAddress_ = 0;
+
+	//========================================
+	// 点光源・スポットライト(クラスタごとに使うライトをCPUで割り当てる)
+	std::vector<PunctualLight> punctualLights_;
+	LightCluster lightCluster_;
+	// 割り当てに使うスレッド数
+	uint32_t lightClusterThreadCount_ = 1;
+	// このフレームで書き込んだアドレス
+	D3D12_GPU_VIRTUAL_ADDRESS lightClusterConstantAddress_ = 0;
+	D3D12_GPU_VIRTUAL_ADDRESS punctualLightAddress_ = 0;
+	D3D12_GPU_VIRTUAL_ADDRESS clusterRangeAddress_ = 0;
+	D3D12_GPU_VIRTUAL_ADDRESS clusterLightIndexAddress_ = 0;
+
+	//========================================
+	// 予約したインスタンス
+	// NOTE:下のvectorはフレームごとにclearして容量を残す。最初の数フレームで
+	//      容量が伸びきるまでは確保が起き、それ以降のフレームでは確保しない
+	//      (modelIds_はclearでノードを解放するので毎フレーム確保する)
+	struct InstanceEntry {
+		Model* model = nullptr;
+		D3D12_GPU_VIRTUAL_ADDRESS directionalLightAddress = 0;
+		D3D12_GPU_VIRTUAL_ADDRESS cameraAddress = 0;
+	};
+	std::vector<InstanceEntry> instanceEntries_;
+	std::vector<TransformationMatrix> instanceMatrices_;
+	// 予約したインスタンスの境界(添え字はinstanceEntries_と同じ)
+	FrustumCuller frustumCuller_;
+	// 並べ替え用(キーの番号はフレームごとに振り直す)
+	RenderQueue renderQueue_;
+	std::unordered_map<const Model*, uint32_t> modelIds_;
+	std::vector<std::pair<D3D12_GPU_VIRTUAL_ADDRESS, D3D12_GPU_VIRTUAL_ADDRESS>> variants_;
+	bool isInstancingEnabled_ = true;
+	// 直前のフレームの件数
+	uint32_t instanceCount_ = 0;
+	uint32_t instancedDrawCount_ = 0;
+
+	//========================================
+	// 視錐台カリング
+	// このフレームの視錐台(CommonDrawSetupでデフォルトカメラから作る)
+	Frustum frustum_ = {};
+	// 視錐台を作れたか(カメラがなければ判定しない)
+	bool hasFrustum_ = false;
+	bool isCullingEnabled_ = true;
+	uint32_t culledCount_ = 0;
+
+	//========================================
+	// Transformの階層(変更のあった部分木だけワールド行列を求め直す)
+	TransformHierarchy transformHierarchy_;
+	uint32_t transformUpdateCount_ = 0;
 };
\ No newline at end of file
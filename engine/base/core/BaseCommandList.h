@@ -0,0 +1,109 @@
+/*********************************************************************
+ * \file   BaseCommandList.h
+ * \brief  描画コマンドの発行先のインターフェース
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   描画側はここに並んだ呼び出しだけを使う。D3D12版とNull版(記録用)を差し替えられる。
+ *         D3D12のオブジェクトは前方宣言のポインタとして受け取るだけなので、
+ *         このヘッダーはD3D12なしでもコンパイルできる
+ *********************************************************************/
+#pragma once
+#include "RenderGraph.h"
+#include <cstdint>
+
+struct ID3D12DescriptorHeap;
+struct ID3D12RootSignature;
+struct ID3D12PipelineState;
+struct ID3D12Resource;
+
+///=============================================================================
+///						プリミティブトポロジー(値はD3D_PRIMITIVE_TOPOLOGYと同じ)
+enum class PrimitiveTopology : uint32_t {
+	kUndefined = 0,
+	kPointList = 1,
+	kLineList = 2,
+	kLineStrip = 3,
+	kTriangleList = 4,
+	kTriangleStrip = 5,
+};
+
+///=============================================================================
+///						インデックスの形式
+enum class IndexFormat : uint32_t {
+	kUint16,
+	kUint32,
+};
+
+///=============================================================================
+///						頂点バッファビュー
+struct VertexBufferView {
+	uint64_t bufferLocation = 0;	// GPUアドレス
+	uint32_t sizeInBytes = 0;
+	uint32_t strideInBytes = 0;
+};
+
+///=============================================================================
+///						インデックスバッファビュー
+struct IndexBufferView {
+	uint64_t bufferLocation = 0;	// GPUアドレス
+	uint32_t sizeInBytes = 0;
+	IndexFormat format = IndexFormat::kUint32;
+};
+
+///=============================================================================
+///						リソースバリア
+struct ResourceBarrierDesc {
+	enum class Type : uint32_t { kTransition, kAliasing };
+	Type type = Type::kTransition;
+	ID3D12Resource* resource = nullptr;			// 遷移するリソース(エイリアシングではこれから使うリソース)
+	ID3D12Resource* resourceBefore = nullptr;	// エイリアシングでそれまで使っていたリソース
+	ResourceState before = ResourceState::kCommon;
+	ResourceState after = ResourceState::kCommon;
+};
+
+///=============================================================================
+///						描画コマンドの発行先インターフェース
+class BaseCommandList {
+public:
+	virtual ~BaseCommandList() = default;
+
+	/// \brief ディスクリプタヒープの設定
+	virtual void SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) = 0;
+
+	/// \brief ルートシグネチャの設定
+	virtual void SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) = 0;
+
+	/// \brief パイプラインステートの設定
+	virtual void SetPipelineState(ID3D12PipelineState* pipelineState) = 0;
+
+	/// \brief プリミティブトポロジーの設定
+	virtual void IASetPrimitiveTopology(PrimitiveTopology topology) = 0;
+
+	/// \brief 頂点バッファの設定
+	virtual void IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) = 0;
+
+	/// \brief インデックスバッファの設定
+	virtual void IASetIndexBuffer(const IndexBufferView& view) = 0;
+
+	/// \brief ルートCBVの設定
+	/// \param gpuAddress 定数バッファのGPUアドレス
+	virtual void SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) = 0;
+
+	/// \brief ルートSRVの設定
+	/// \param gpuAddress 構造化バッファのGPUアドレス
+	virtual void SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) = 0;
+
+	/// \brief ディスクリプタテーブルの設定
+	/// \param gpuDescriptor 先頭のGPUディスクリプタハンドル(ptr)
+	virtual void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) = 0;
+
+	/// \brief 描画
+	virtual void DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) = 0;
+
+	/// \brief インデックス付き描画
+	virtual void DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) = 0;
+
+	/// \brief リソースバリアをまとめて張る
+	virtual void ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) = 0;
+};
@@ -0,0 +1,35 @@
+/*********************************************************************
+ * \file   BaseCommandRecorder.h
+ * \brief  パスごとのコマンド記録先のインターフェース
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   D3D12版とNull版(検証用)を差し替えられるようにする
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <vector>
+
+///=============================================================================
+///						コマンド記録インターフェース
+class BaseCommandRecorder {
+public:
+	virtual ~BaseCommandRecorder() = default;
+
+	/// \brief フレームの記録開始(メインスレッドから呼ばれる)
+	/// \param passCount このフレームで記録するパス数
+	virtual void BeginFrame(uint32_t passCount) = 0;
+
+	/// \brief パスの記録開始。呼び出したスレッドに記録先を結び付ける
+	/// \param passIndex パス番号
+	/// \note  異なるパス番号に対して複数のスレッドから同時に呼ばれる
+	virtual void BeginPass(uint32_t passIndex) = 0;
+
+	/// \brief パスの記録終了
+	/// \param passIndex パス番号
+	virtual void EndPass(uint32_t passIndex) = 0;
+
+	/// \brief 記録したパスを指定順でまとめて提出(メインスレッドから呼ばれる)
+	/// \param passOrder 提出するパス番号の並び
+	virtual void Submit(const std::vector<uint32_t>& passOrder) = 0;
+};
@@ -0,0 +1,68 @@
+/*********************************************************************
+ * \file   BlendMode.h
+ * \brief  ブレンドモードとレンダーターゲットのブレンド設定
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <d3d12.h>
+
+///=============================================================================
+///						ブレンドモード
+enum class BlendMode : uint32_t {
+	kNone,		// ブレンドなし
+	kNormal,	// 通常αブレンド
+	kAdd,		// 加算
+	kSubtract,	// 減算
+	kMultiply,	// 乗算
+	kScreen,	// スクリーン
+	kCount,		// 種類数
+};
+
+///=============================================================================
+///						ブレンド設定の作成
+inline D3D12_RENDER_TARGET_BLEND_DESC MakeRenderTargetBlendDesc(BlendMode blendMode) {
+	D3D12_RENDER_TARGET_BLEND_DESC blendDesc{};
+	blendDesc.RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+	if(blendMode == BlendMode::kNone) {
+		return blendDesc;
+	}
+	//========================================
+	// αは共通で書き込み元をそのまま使う
+	blendDesc.BlendEnable = TRUE;
+	blendDesc.SrcBlendAlpha = D3D12_BLEND_ONE;
+	blendDesc.DestBlendAlpha = D3D12_BLEND_ZERO;
+	blendDesc.BlendOpAlpha = D3D12_BLEND_OP_ADD;
+	blendDesc.BlendOp = D3D12_BLEND_OP_ADD;
+	//========================================
+	// 色
+	switch(blendMode) {
+	case BlendMode::kNormal:
+		blendDesc.SrcBlend = D3D12_BLEND_SRC_ALPHA;
+		blendDesc.DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
+		break;
+	case BlendMode::kAdd:
+		blendDesc.SrcBlend = D3D12_BLEND_SRC_ALPHA;
+		blendDesc.DestBlend = D3D12_BLEND_ONE;
+		break;
+	case BlendMode::kSubtract:
+		blendDesc.SrcBlend = D3D12_BLEND_SRC_ALPHA;
+		blendDesc.DestBlend = D3D12_BLEND_ONE;
+		blendDesc.BlendOp = D3D12_BLEND_OP_REV_SUBTRACT;
+		break;
+	case BlendMode::kMultiply:
+		blendDesc.SrcBlend = D3D12_BLEND_ZERO;
+		blendDesc.DestBlend = D3D12_BLEND_SRC_COLOR;
+		break;
+	case BlendMode::kScreen:
+		blendDesc.SrcBlend = D3D12_BLEND_INV_DEST_COLOR;
+		blendDesc.DestBlend = D3D12_BLEND_ONE;
+		break;
+	default:
+		break;
+	}
+	return blendDesc;
+}
@@ -0,0 +1,105 @@
+/*********************************************************************
+ * \file   CaptureCommandList.cpp
+ * \brief  描画コマンドを記録しながら本来の発行先へ流す発行先
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "CaptureCommandList.h"
+
+///=============================================================================
+///						ディスクリプタヒープ
+void CaptureCommandList::SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) {
+	recorder_.SetDescriptorHeaps(heapCount, heaps);
+	if(target_) {
+		target_->SetDescriptorHeaps(heapCount, heaps);
+	}
+}
+
+///=============================================================================
+///						ルートシグネチャ・PSO
+void CaptureCommandList::SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) {
+	recorder_.SetGraphicsRootSignature(rootSignature);
+	if(target_) {
+		target_->SetGraphicsRootSignature(rootSignature);
+	}
+}
+
+void CaptureCommandList::SetPipelineState(ID3D12PipelineState* pipelineState) {
+	recorder_.SetPipelineState(pipelineState);
+	if(target_) {
+		target_->SetPipelineState(pipelineState);
+	}
+}
+
+///=============================================================================
+///						入力アセンブラ
+void CaptureCommandList::IASetPrimitiveTopology(PrimitiveTopology topology) {
+	recorder_.IASetPrimitiveTopology(topology);
+	if(target_) {
+		target_->IASetPrimitiveTopology(topology);
+	}
+}
+
+void CaptureCommandList::IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) {
+	recorder_.IASetVertexBuffers(startSlot, viewCount, views);
+	if(target_) {
+		target_->IASetVertexBuffers(startSlot, viewCount, views);
+	}
+}
+
+void CaptureCommandList::IASetIndexBuffer(const IndexBufferView& view) {
+	recorder_.IASetIndexBuffer(view);
+	if(target_) {
+		target_->IASetIndexBuffer(view);
+	}
+}
+
+///=============================================================================
+///						ルートパラメータ
+void CaptureCommandList::SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	recorder_.SetGraphicsRootConstantBufferView(rootParameterIndex, gpuAddress);
+	if(target_) {
+		target_->SetGraphicsRootConstantBufferView(rootParameterIndex, gpuAddress);
+	}
+}
+
+void CaptureCommandList::SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	recorder_.SetGraphicsRootShaderResourceView(rootParameterIndex, gpuAddress);
+	if(target_) {
+		target_->SetGraphicsRootShaderResourceView(rootParameterIndex, gpuAddress);
+	}
+}
+
+void CaptureCommandList::SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) {
+	recorder_.SetGraphicsRootDescriptorTable(rootParameterIndex, gpuDescriptor);
+	if(target_) {
+		target_->SetGraphicsRootDescriptorTable(rootParameterIndex, gpuDescriptor);
+	}
+}
+
+///=============================================================================
+///						描画
+void CaptureCommandList::DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) {
+	recorder_.DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+	if(target_) {
+		target_->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+	}
+}
+
+void CaptureCommandList::DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) {
+	recorder_.DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+	if(target_) {
+		target_->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+	}
+}
+
+///=============================================================================
+///						リソースバリア
+void CaptureCommandList::ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) {
+	recorder_.ResourceBarriers(barrierCount, barriers);
+	if(target_) {
+		target_->ResourceBarriers(barrierCount, barriers);
+	}
+}
@@ -0,0 +1,53 @@
+/*********************************************************************
+ * \file   CaptureCommandList.h
+ * \brief  描画コマンドを記録しながら本来の発行先へ流す発行先
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   呼び出しをNull版と同じ形式で記録してから、そのまま本来の発行先へ渡す。
+ *         描画結果を変えずに1フレーム分のコマンド列を取り出すために使う
+ *********************************************************************/
+#pragma once
+#include "NullCommandList.h"
+
+///=============================================================================
+///						記録付きコマンドリスト
+class CaptureCommandList : public BaseCommandList {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	void SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) override;
+	void SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) override;
+	void SetPipelineState(ID3D12PipelineState* pipelineState) override;
+	void IASetPrimitiveTopology(PrimitiveTopology topology) override;
+	void IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) override;
+	void IASetIndexBuffer(const IndexBufferView& view) override;
+	void SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) override;
+	void DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) override;
+	void DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) override;
+	void ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) override;
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  SetTarget 転送先と記録先の設定
+	 * \param  target 本来の発行先(nullptrなら記録だけ行う)
+	 * \param  output 記録先
+	 */
+	void SetTarget(BaseCommandList* target, std::vector<RenderCommand>* output) {
+		target_ = target;
+		recorder_.SetOutput(output);
+	}
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 本来の発行先
+	BaseCommandList* target_ = nullptr;
+	// 記録用
+	NullCommandList recorder_;
+};
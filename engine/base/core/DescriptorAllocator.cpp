@@ -0,0 +1,189 @@
+/*********************************************************************
+ * \file   DescriptorAllocator.cpp
+ * \brief  ディスクリプタインデックスの割り当て管理(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "DescriptorAllocator.h"
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+///=============================================================================
+///						初期化
+void DescriptorAllocator::Initialize(uint32_t capacity) {
+	//========================================
+	// 状態のリセット
+	capacity_ = capacity;
+	freeBlocks_.clear();
+	pendingRanges_.clear();
+	allocatedCount_ = 0;
+	peakAllocatedCount_ = 0;
+	transientCount_ = 0;
+	allocationCount_ = 0;
+	freeCount_ = 0;
+	failedAllocationCount_ = 0;
+	//========================================
+	// 全体を1つの空きブロックとして登録
+	if(capacity_ > 0) {
+		freeBlocks_.emplace(0, capacity_);
+	}
+}
+
+///=============================================================================
+///						連続範囲の確保
+uint32_t DescriptorAllocator::AllocateRange(uint32_t count) {
+	assert(count > 0);
+	//========================================
+	// 先頭から最初に収まるブロックを探す(ファーストフィット)
+	for(auto it = freeBlocks_.begin(); it != freeBlocks_.end(); ++it) {
+		if(it->second < count) {
+			continue;
+		}
+		//---------------------------------------
+		// ブロックの先頭から切り出す
+		uint32_t index = it->first;
+		uint32_t remain = it->second - count;
+		freeBlocks_.erase(it);
+		if(remain > 0) {
+			freeBlocks_.emplace(index + count, remain);
+		}
+		//---------------------------------------
+		// 統計の更新
+		allocatedCount_ += count;
+		peakAllocatedCount_ = ( std::max )( peakAllocatedCount_, allocatedCount_ );
+		++allocationCount_;
+		return index;
+	}
+	//========================================
+	// 空きなし
+	++failedAllocationCount_;
+	return kInvalidIndex;
+}
+
+///=============================================================================
+///						即時解放
+void DescriptorAllocator::Free(uint32_t index, uint32_t count) {
+	assert(count > 0);
+	assert(index < capacity_ && count <= capacity_ - index);
+	assert(allocatedCount_ >= count);
+	//========================================
+	// 空きブロックに戻す
+	InsertFreeBlock(index, count);
+	allocatedCount_ -= count;
+	++freeCount_;
+}
+
+///=============================================================================
+///						フェンス値到達後に解放
+void DescriptorAllocator::FreeDeferred(uint32_t index, uint32_t count, uint64_t fenceValue) {
+	assert(count > 0);
+	assert(index < capacity_ && count <= capacity_ - index);
+	pendingRanges_.push_back({ index, count, fenceValue, false });
+}
+
+///=============================================================================
+///						一時範囲の確保
+uint32_t DescriptorAllocator::AllocateTransient(uint32_t count, uint64_t fenceValue) {
+	assert(count > 0);
+	//========================================
+	// 末尾から最初に収まるブロックを探す
+	for(auto it = freeBlocks_.rbegin(); it != freeBlocks_.rend(); ++it) {
+		if(it->second < count) {
+			continue;
+		}
+		//---------------------------------------
+		// ブロックの末尾から切り出す
+		uint32_t blockIndex = it->first;
+		uint32_t remain = it->second - count;
+		freeBlocks_.erase(std::next(it).base());
+		if(remain > 0) {
+			freeBlocks_.emplace(blockIndex, remain);
+		}
+		uint32_t index = blockIndex + remain;
+		//---------------------------------------
+		// フェンス完了時に自動で解放
+		pendingRanges_.push_back({ index, count, fenceValue, true });
+		//---------------------------------------
+		// 統計の更新
+		allocatedCount_ += count;
+		transientCount_ += count;
+		peakAllocatedCount_ = ( std::max )( peakAllocatedCount_, allocatedCount_ );
+		++allocationCount_;
+		return index;
+	}
+	//========================================
+	// 空きなし
+	++failedAllocationCount_;
+	return kInvalidIndex;
+}
+
+///=============================================================================
+///						完了した範囲の回収
+void DescriptorAllocator::ReleaseCompleted(uint64_t completedFenceValue) {
+	std::erase_if(pendingRanges_, [&](const PendingRange& range) {
+		if(range.fenceValue > completedFenceValue) {
+			return false;
+		}
+		if(range.isTransient) {
+			transientCount_ -= range.count;
+		}
+		Free(range.index, range.count);
+		return true;
+	});
+}
+
+///=============================================================================
+///						空きブロックの挿入
+void DescriptorAllocator::InsertFreeBlock(uint32_t index, uint32_t count) {
+	uint32_t start = index;
+	uint32_t end = index + count;
+	//========================================
+	// 後ろのブロックと結合
+	auto next = freeBlocks_.lower_bound(start);
+	// 二重解放チェック
+	assert(next == freeBlocks_.end() || next->first >= end);
+	if(next != freeBlocks_.end() && next->first == end) {
+		end += next->second;
+		next = freeBlocks_.erase(next);
+	}
+	//========================================
+	// 前のブロックと結合
+	if(next != freeBlocks_.begin()) {
+		auto prev = std::prev(next);
+		// 二重解放チェック
+		assert(prev->first + prev->second <= start);
+		if(prev->first + prev->second == start) {
+			start = prev->first;
+			freeBlocks_.erase(prev);
+		}
+	}
+	freeBlocks_.emplace(start, end - start);
+}
+
+///=============================================================================
+///						統計情報の取得
+DescriptorAllocator::Stats DescriptorAllocator::GetStats() const {
+	Stats stats{};
+	stats.capacity = capacity_;
+	stats.allocatedCount = allocatedCount_;
+	stats.peakAllocatedCount = peakAllocatedCount_;
+	stats.transientCount = transientCount_;
+	stats.freeBlockCount = static_cast<uint32_t>( freeBlocks_.size() );
+	stats.allocationCount = allocationCount_;
+	stats.freeCount = freeCount_;
+	stats.failedAllocationCount = failedAllocationCount_;
+	//========================================
+	// 集計が必要なもの
+	for(const auto& block : freeBlocks_) {
+		stats.largestFreeBlock = ( std::max )( stats.largestFreeBlock, block.second );
+	}
+	for(const auto& range : pendingRanges_) {
+		if(!range.isTransient) {
+			stats.pendingFreeCount += range.count;
+		}
+	}
+	return stats;
+}
@@ -0,0 +1,148 @@
+/*********************************************************************
+ * \file   DescriptorAllocator.h
+ * \brief  ディスクリプタインデックスの割り当て管理(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   フリーリストによる再利用、連続範囲の確保、
+ *         フェンス値によるフレーム単位の遅延解放を行う
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <map>
+#include <vector>
+
+class DescriptorAllocator {
+	///--------------------------------------------------------------
+	///							構造体
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Stats 統計情報
+	 */
+	struct Stats {
+		uint32_t capacity = 0;				// 総ディスクリプタ数
+		uint32_t allocatedCount = 0;		// 使用中(解放待ちを含む)
+		uint32_t peakAllocatedCount = 0;	// 使用中の最大値
+		uint32_t transientCount = 0;		// 一時確保中
+		uint32_t pendingFreeCount = 0;		// フェンス待ちの解放数
+		uint32_t freeBlockCount = 0;		// 空きブロック数
+		uint32_t largestFreeBlock = 0;		// 最大の連続空き数
+		uint64_t allocationCount = 0;		// 確保回数
+		uint64_t freeCount = 0;				// 解放回数
+		uint64_t failedAllocationCount = 0;	// 確保失敗回数
+	};
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  capacity 管理するディスクリプタ数
+	 */
+	void Initialize(uint32_t capacity);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Allocate ディスクリプタを1つ確保
+	 * \return 先頭インデックス 失敗時はkInvalidIndex
+	 */
+	uint32_t Allocate() { return AllocateRange(1); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  AllocateRange 連続したディスクリプタを確保(ディスクリプタテーブル用)
+	 * \param  count 個数
+	 * \return 先頭インデックス 失敗時はkInvalidIndex
+	 */
+	uint32_t AllocateRange(uint32_t count);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Free 即時解放
+	 * \param  index 先頭インデックス
+	 * \param  count 個数
+	 * \note   GPUが参照していないことが確実な場合のみ使用すること
+	 */
+	void Free(uint32_t index, uint32_t count = 1);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  FreeDeferred フェンス値到達後に解放
+	 * \param  index 先頭インデックス
+	 * \param  count 個数
+	 * \param  fenceValue このフェンス値が完了したら再利用可能
+	 */
+	void FreeDeferred(uint32_t index, uint32_t count, uint64_t fenceValue);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  AllocateTransient フレーム内だけ使う連続範囲を確保
+	 * \param  count 個数
+	 * \param  fenceValue このフェンス値が完了したら自動で解放
+	 * \return 先頭インデックス 失敗時はkInvalidIndex
+	 * \note   常駐確保と混ざらないようにヒープの末尾側から切り出す
+	 */
+	uint32_t AllocateTransient(uint32_t count, uint64_t fenceValue);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  ReleaseCompleted 完了したフェンス値までの解放待ちを回収
+	 * \param  completedFenceValue GPUが完了したフェンス値
+	 */
+	void ReleaseCompleted(uint64_t completedFenceValue);
+
+	///--------------------------------------------------------------
+	///							静的メンバ関数
+private:
+	/**----------------------------------------------------------------------------
+	 * \brief  InsertFreeBlock 空きブロックを挿入して前後と結合
+	 * \param  index 先頭インデックス
+	 * \param  count 個数
+	 */
+	void InsertFreeBlock(uint32_t index, uint32_t count);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  IsFull 空きがないか
+	 */
+	bool IsFull() const { return freeBlocks_.empty(); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetStats 統計情報の取得
+	 */
+	Stats GetStats() const;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetCapacity 総ディスクリプタ数の取得
+	 */
+	uint32_t GetCapacity() const { return capacity_; }
+
+	//========================================
+	// 無効なインデックス
+	static constexpr uint32_t kInvalidIndex = 0xFFFFFFFF;
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 解放待ちの範囲
+	struct PendingRange {
+		uint32_t index;
+		uint32_t count;
+		uint64_t fenceValue;
+		bool isTransient;
+	};
+
+	//========================================
+	// 総ディスクリプタ数
+	uint32_t capacity_ = 0;
+	// 空きブロック(先頭インデックス -> 個数) 隣接ブロックは常に結合済み
+	std::map<uint32_t, uint32_t> freeBlocks_;
+	// フェンス待ちの範囲
+	std::vector<PendingRange> pendingRanges_;
+
+	//========================================
+	// 統計
+	uint32_t allocatedCount_ = 0;
+	uint32_t peakAllocatedCount_ = 0;
+	uint32_t transientCount_ = 0;
+	uint64_t allocationCount_ = 0;
+	uint64_t freeCount_ = 0;
+	uint64_t failedAllocationCount_ = 0;
+};
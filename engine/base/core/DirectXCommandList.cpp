@@ -0,0 +1,108 @@
+/*********************************************************************
+ * \file   DirectXCommandList.cpp
+ * \brief  描画コマンドをそのままID3D12GraphicsCommandListに流すD3D12版の発行先
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "DirectXCommandList.h"
+#include "DirectXRenderGraph.h"
+#include <cassert>
+#include <vector>
+
+static_assert(static_cast<uint32_t>( PrimitiveTopology::kTriangleList ) == D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+static_assert(static_cast<uint32_t>( PrimitiveTopology::kTriangleStrip ) == D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+static_assert(sizeof(VertexBufferView) == sizeof(D3D12_VERTEX_BUFFER_VIEW));
+
+///=============================================================================
+///						ディスクリプタヒープ
+void DirectXCommandList::SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) {
+	commandList_->SetDescriptorHeaps(heapCount, heaps);
+}
+
+///=============================================================================
+///						ルートシグネチャ・PSO
+void DirectXCommandList::SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) {
+	commandList_->SetGraphicsRootSignature(rootSignature);
+}
+
+void DirectXCommandList::SetPipelineState(ID3D12PipelineState* pipelineState) {
+	commandList_->SetPipelineState(pipelineState);
+}
+
+///=============================================================================
+///						入力アセンブラ
+void DirectXCommandList::IASetPrimitiveTopology(PrimitiveTopology topology) {
+	commandList_->IASetPrimitiveTopology(static_cast<D3D12_PRIMITIVE_TOPOLOGY>( topology ));
+}
+
+void DirectXCommandList::IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) {
+	//========================================
+	// 頂点バッファは1～2本がほとんどなのでスタック上で変換する
+	constexpr uint32_t kMaxViews = D3D12_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT;
+	assert(viewCount <= kMaxViews);
+	D3D12_VERTEX_BUFFER_VIEW d3d12Views[kMaxViews];
+	for(uint32_t i = 0; i < viewCount; ++i) {
+		d3d12Views[i].BufferLocation = views[i].bufferLocation;
+		d3d12Views[i].SizeInBytes = views[i].sizeInBytes;
+		d3d12Views[i].StrideInBytes = views[i].strideInBytes;
+	}
+	commandList_->IASetVertexBuffers(startSlot, viewCount, d3d12Views);
+}
+
+void DirectXCommandList::IASetIndexBuffer(const IndexBufferView& view) {
+	D3D12_INDEX_BUFFER_VIEW d3d12View{};
+	d3d12View.BufferLocation = view.bufferLocation;
+	d3d12View.SizeInBytes = view.sizeInBytes;
+	d3d12View.Format = view.format == IndexFormat::kUint16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+	commandList_->IASetIndexBuffer(&d3d12View);
+}
+
+///=============================================================================
+///						ルートパラメータ
+void DirectXCommandList::SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	commandList_->SetGraphicsRootConstantBufferView(rootParameterIndex, gpuAddress);
+}
+
+void DirectXCommandList::SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	commandList_->SetGraphicsRootShaderResourceView(rootParameterIndex, gpuAddress);
+}
+
+void DirectXCommandList::SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) {
+	commandList_->SetGraphicsRootDescriptorTable(rootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE{ gpuDescriptor });
+}
+
+///=============================================================================
+///						描画
+void DirectXCommandList::DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) {
+	commandList_->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+}
+
+void DirectXCommandList::DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) {
+	commandList_->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+}
+
+///=============================================================================
+///						リソースバリア
+void DirectXCommandList::ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) {
+	if(barrierCount == 0) {
+		return;
+	}
+	std::vector<D3D12_RESOURCE_BARRIER> d3d12Barriers(barrierCount);
+	for(uint32_t i = 0; i < barrierCount; ++i) {
+		D3D12_RESOURCE_BARRIER& barrier = d3d12Barriers[i];
+		if(barriers[i].type == ResourceBarrierDesc::Type::kAliasing) {
+			barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+			barrier.Aliasing.pResourceBefore = barriers[i].resourceBefore;
+			barrier.Aliasing.pResourceAfter = barriers[i].resource;
+		} else {
+			barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+			barrier.Transition.pResource = barriers[i].resource;
+			barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+			barrier.Transition.StateBefore = DirectXRenderGraph::ToD3D12State(barriers[i].before);
+			barrier.Transition.StateAfter = DirectXRenderGraph::ToD3D12State(barriers[i].after);
+		}
+	}
+	commandList_->ResourceBarrier(barrierCount, d3d12Barriers.data());
+}
@@ -0,0 +1,63 @@
+/*********************************************************************
+ * \file   DirectXCommandList.h
+ * \brief  描画コマンドをそのままID3D12GraphicsCommandListに流すD3D12版の発行先
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#pragma once
+#include "BaseCommandList.h"
+#include <d3d12.h>
+
+///=============================================================================
+///						D3D12コマンドリスト
+class DirectXCommandList : public BaseCommandList {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	DirectXCommandList() = default;
+	explicit DirectXCommandList(ID3D12GraphicsCommandList* commandList) : commandList_(commandList) {}
+
+	void SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) override;
+	void SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) override;
+	void SetPipelineState(ID3D12PipelineState* pipelineState) override;
+	void IASetPrimitiveTopology(PrimitiveTopology topology) override;
+	void IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) override;
+	void IASetIndexBuffer(const IndexBufferView& view) override;
+	void SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) override;
+	void DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) override;
+	void DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) override;
+	void ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) override;
+
+	///--------------------------------------------------------------
+	///							静的メンバ関数
+public:
+	/// \brief D3D12の頂点バッファビューからの変換
+	static VertexBufferView ToVertexBufferView(const D3D12_VERTEX_BUFFER_VIEW& view) {
+		return { view.BufferLocation, view.SizeInBytes, view.StrideInBytes };
+	}
+
+	/// \brief D3D12のインデックスバッファビューからの変換
+	static IndexBufferView ToIndexBufferView(const D3D12_INDEX_BUFFER_VIEW& view) {
+		return { view.BufferLocation, view.SizeInBytes, view.Format == DXGI_FORMAT_R16_UINT ? IndexFormat::kUint16 : IndexFormat::kUint32 };
+	}
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 流し先の設定
+	void SetCommandList(ID3D12GraphicsCommandList* commandList) { commandList_ = commandList; }
+
+	/// \brief 流し先の取得
+	ID3D12GraphicsCommandList* GetCommandList() const { return commandList_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 流し先
+	ID3D12GraphicsCommandList* commandList_ = nullptr;
+};
@@ -0,0 +1,78 @@
+/*********************************************************************
+ * \file   DirectXCommandRecorder.cpp
+ * \brief  パスごとにコマンドアロケータとコマンドリストを持つD3D12版の記録先
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "DirectXCommandRecorder.h"
+
+///=============================================================================
+///						初期化
+void DirectXCommandRecorder::Initialize(DirectXCore* dxCore, SrvSetup* srvSetup) {
+	assert(dxCore);
+	assert(srvSetup);
+	dxCore_ = dxCore;
+	srvSetup_ = srvSetup;
+}
+
+///=============================================================================
+///						フレームの記録開始
+void DirectXCommandRecorder::BeginFrame(uint32_t passCount) {
+	//========================================
+	// 足りない記録先を生成(ワーカーから生成しないようにここで行う)
+	while(passContexts_.size() < passCount) {
+		PassContext context;
+		for(uint32_t i = 0; i < DirectXCore::kFrameCount_; ++i) {
+			HRESULT hr = dxCore_->GetDevice()->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&context.allocators[i]));
+			assert(SUCCEEDED(hr));
+		}
+		HRESULT hr = dxCore_->GetDevice()->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, context.allocators[0].Get(), nullptr,
+			IID_PPV_ARGS(&context.commandList));
+		assert(SUCCEEDED(hr));
+		//記録開始時にResetするので閉じておく
+		hr = context.commandList->Close();
+		assert(SUCCEEDED(hr));
+		passContexts_.push_back(std::move(context));
+	}
+}
+
+///=============================================================================
+///						パスの記録開始
+void DirectXCommandRecorder::BeginPass(uint32_t passIndex) {
+	PassContext& context = passContexts_[passIndex];
+	//========================================
+	// このフレームスロットのアロケータはAdvance時に完了待ち済み
+	ID3D12CommandAllocator* commandAllocator = context.allocators[dxCore_->GetFrameIndex()].Get();
+	HRESULT hr = commandAllocator->Reset();
+	assert(SUCCEEDED(hr));
+	hr = context.commandList->Reset(commandAllocator, nullptr);
+	assert(SUCCEEDED(hr));
+	//========================================
+	// このスレッドの記録先に設定し、引き継がれない状態を設定し直す
+	DirectXCore::BindCommandList(context.commandList.Get());
+	dxCore_->SetupRenderTarget(context.commandList.Get());
+	srvSetup_->SetDescriptorHeap();
+}
+
+///=============================================================================
+///						パスの記録終了
+void DirectXCommandRecorder::EndPass(uint32_t passIndex) {
+	HRESULT hr = passContexts_[passIndex].commandList->Close();
+	assert(SUCCEEDED(hr));
+	DirectXCore::BindCommandList(nullptr);
+}
+
+///=============================================================================
+///						提出
+void DirectXCommandRecorder::Submit(const std::vector<uint32_t>& passOrder) {
+	//========================================
+	// メインのコマンドリストの後ろに実行順で並べる
+	std::vector<ID3D12CommandList*> commandLists;
+	commandLists.reserve(passOrder.size());
+	for(uint32_t passIndex : passOrder) {
+		commandLists.push_back(passContexts_[passIndex].commandList.Get());
+	}
+	dxCore_->QueuePassCommandLists(commandLists);
+}
@@ -0,0 +1,50 @@
+/*********************************************************************
+ * \file   DirectXCommandRecorder.h
+ * \brief  パスごとにコマンドアロケータとコマンドリストを持つD3D12版の記録先
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#pragma once
+#include "BaseCommandRecorder.h"
+#include "DirectXCore.h"
+#include "SrvSetup.h"
+
+///=============================================================================
+///						D3D12コマンド記録
+class DirectXCommandRecorder : public BaseCommandRecorder {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  dxCore DirectXCore
+	 * \param  srvSetup パスの記録開始時にSRVヒープを設定するため
+	 */
+	void Initialize(DirectXCore* dxCore, SrvSetup* srvSetup);
+
+	void BeginFrame(uint32_t passCount) override;
+	void BeginPass(uint32_t passIndex) override;
+	void EndPass(uint32_t passIndex) override;
+	void Submit(const std::vector<uint32_t>& passOrder) override;
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// パスごとの記録先
+	struct PassContext {
+		// フレームごとのアロケータ(GPU実行中のものをリセットしないため)
+		Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocators[DirectXCore::kFrameCount_];
+		Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList;
+	};
+
+	//========================================
+	// DirectXCoreポインタ
+	DirectXCore* dxCore_ = nullptr;
+	// SrvSetupポインタ
+	SrvSetup* srvSetup_ = nullptr;
+	// パスごとの記録先
+	std::vector<PassContext> passContexts_;
+};
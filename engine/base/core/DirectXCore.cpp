@@ -10,16 +10,27 @@
  //========================================
  // 標準ライブラリ
 #include <vector>
+#include <atomic>
+#include <future>
+#include <algorithm>
 //========================================
 // DirectXTex
 #include "d3dx12.h"
 #pragma comment(lib,"winmm.lib")
 
+//========================================
+// スレッドごとの記録先
+thread_local ID3D12GraphicsCommandList* DirectXCore::boundCommandList_ = nullptr;
+thread_local BaseCommandList* DirectXCore::boundRenderCommandList_ = nullptr;
+thread_local DirectXCore::ThreadRenderContext* DirectXCore::threadRenderContext_ = nullptr;
+
 
 ///=============================================================================
 ///						描画前処理
 //TODO:ループ内の前処理後処理を作成
 void DirectXCore::PreDraw() {
+	/// 要求があればこのフレームの描画コマンドを取り込む
+	frameCapture_.BeginFrame();
 	/// バックバッファの決定
 	SettleCommandList();
 	/// バリア設定
@@ -30,13 +41,13 @@ void DirectXCore::PreDraw() {
 	// ViewPortとScissorRectの設定
 	commandList_->RSSetViewports(1, &viewport_);
 	commandList_->RSSetScissorRects(1, &scissorRect_);
+	// シーンのパスの前のバリア(並列記録したパスはメインのコマンドリストの後ろで実行される)
+	RecordFramePassBarriers(scenePass_, commandList_.Get());
 }
 
 ///=============================================================================
 ///						描画後処理
 void DirectXCore::PostDraw() {
-	//FPS固定
-	UpdateFixFPS();
 	// コマンドリストのクローズと実行
 	CloseCommandList();
 	ExecuteCommandList();
@@ -45,14 +56,16 @@ void DirectXCore::PostDraw() {
 ///=============================================================================
 ///						DirectXの初期化
 void DirectXCore::InitializeDirectX(WinApp* winApp) {
-	//FPS固定初期化
-	InitializeFixFPS();
+	//フレームペーサー初期化
+	InitializeFramePacer();
 
 	/// ===WinApp=== ///
 	///NULL検出
 	assert(winApp);
 	/// メンバ変数に記録
 	this->winApp_ = winApp;
+	/// 同時進行フレーム数の設定
+	frameInFlight_.Initialize(kFrameCount_);
 
 	// ウィンドウハンドルの取得
 	CreateDebugLayer();
@@ -72,6 +85,8 @@ void DirectXCore::InitializeDirectX(WinApp* winApp) {
 	CreateSwapChain();
 	// フェンスの生成
 	CreateFence();
+	// フレームごとのリングバッファの生成
+	CreateFrameRingBuffer();
 	//深度バッファの生成
 	CreateDepthBuffer();
 	//様々なヒープサイズの取得
@@ -82,6 +97,8 @@ void DirectXCore::InitializeDirectX(WinApp* winApp) {
 	GetResourcesFromSwapChain();
 	//RTVの生成
 	CreateRenderTargetViews();
+	//フレームのレンダーグラフの構築
+	CreateFrameGraph();
 	//コマンドリストの決定
 	SettleCommandList();
 	//バリアの設定
@@ -105,6 +122,12 @@ void DirectXCore::InitializeDirectX(WinApp* winApp) {
 ///=============================================================================
 ///						開放処理
 void DirectXCore::ReleaseDirectX() {
+	///GPUの処理完了を待つ
+	WaitForGpu();
+	///パイプラインライブラリの保存
+	pipelineStateCache_.Finalize();
+	///システムタイマーの分解能を戻す
+	timeEndPeriod(1);
 	///開放処理
 	ReleaseResources();
 }
@@ -235,17 +258,32 @@ void DirectXCore::CreateCommandQueue() {
 ///=============================================================================
 ///						コマンドアロケータを生成する
 void DirectXCore::CreateCommandAllocator() {
-	commandAllocator_ = nullptr;
-	hr_ = device_->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&commandAllocator_));
-	//コマンドアロケータのせいせがうまくいかなかったので起動できない
-	assert(SUCCEEDED(hr_));
+	//フレームごとにアロケータを用意し、GPUが使用中のアロケータをリセットしないようにする
+	for(uint32_t i = 0; i < kFrameCount_; ++i) {
+		commandAllocators_[i] = nullptr;
+		hr_ = device_->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&commandAllocators_[i]));
+		//コマンドアロケータのせいせがうまくいかなかったので起動できない
+		assert(SUCCEEDED(hr_));
+	}
 
 	//コマンドリスト
 	commandList_ = nullptr;
-	hr_ = device_->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, commandAllocator_.Get(), nullptr,
+	hr_ = device_->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, commandAllocators_[frameInFlight_.GetFrameIndex()].Get(), nullptr,
 		IID_PPV_ARGS(&commandList_));
 	//コマンドリストの生成がうまくいかなかったので起動できない
 	assert(SUCCEEDED(hr_));
+
+	//並列記録したパスの後ろに続けるコマンドリスト
+	for(uint32_t i = 0; i < kFrameCount_; ++i) {
+		hr_ = device_->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&epilogueAllocators_[i]));
+		assert(SUCCEEDED(hr_));
+	}
+	hr_ = device_->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, epilogueAllocators_[0].Get(), nullptr,
+		IID_PPV_ARGS(&epilogueCommandList_));
+	assert(SUCCEEDED(hr_));
+	//使うときにResetするので閉じておく
+	hr_ = epilogueCommandList_->Close();
+	assert(SUCCEEDED(hr_));
 }
 
 
@@ -270,8 +308,7 @@ void DirectXCore::CreateSwapChain() {
 void DirectXCore::CreateFence() {
 	//初期値0でFenceを作る
 	fence_ = nullptr;
-	fenceValue_ = 0;
-	hr_ = device_->CreateFence(fenceValue_, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence_));
+	hr_ = device_->CreateFence(frameInFlight_.GetLastFenceValue(), D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence_));
 	assert(SUCCEEDED(hr_));
 
 	//FenceのSignalを持つためのイベントを生成する
@@ -279,6 +316,18 @@ void DirectXCore::CreateFence() {
 	assert(fenceEvent_ != nullptr);
 }
 
+///=============================================================================
+///						フレームごとのリングバッファの生成
+void DirectXCore::CreateFrameRingBuffer() {
+	//全フレーム分をひとつのアップロードバッファにまとめ、フレーム番号で領域を切り替える
+	frameRingResource_ = CreateBufferResource(kFrameRingRegionSize_ * kFrameCount_);
+	hr_ = frameRingResource_->Map(0, nullptr, reinterpret_cast<void**>( &frameRingData_ ));
+	assert(SUCCEEDED(hr_));
+	//最初のフレームの領域を設定
+	FrameRingRegion region = GetFrameRingRegion();
+	uploadAllocator_.Reset(region.cpuAddress, region.gpuAddress, region.size);
+}
+
 ///=============================================================================
 ///						深度バッファの生成
 void DirectXCore::CreateDepthBuffer() {
@@ -351,16 +400,8 @@ void DirectXCore::CreateRenderTargetViews() {
 ///=============================================================================
 ///						Fenceの生成
 void DirectXCore::FenceGeneration() {
-	fenceValue_++;
-	//GPUがここまでたどり着いついたときに、Fenceの値を指定した値に代入するようにSignalを送る
-	commandQueue_->Signal(fence_.Get(), fenceValue_);
-	//GetCompketedvalueの初期値はFence作成時に渡した初期値
-	if(fence_->GetCompletedValue() < fenceValue_) {
-		//指定したSignalにたどり着いていないので、たどり着くまで待つようにイベントを設定する
-		fence_->SetEventOnCompletion(fenceValue_, fenceEvent_);
-		//イベントを待つ
-		WaitForSingleObject(fenceEvent_, INFINITE);
-	}
+	//初期化で積んだコマンドの完了を待つ
+	WaitForGpu();
 }
 
 
@@ -372,21 +413,48 @@ void DirectXCore::SettleCommandList() {
 }
 
 
+///=============================================================================
+///						フレームのレンダーグラフの構築
+void DirectXCore::CreateFrameGraph() {
+	frameGraph_.Initialize(device_.Get());
+	//========================================
+	// リソース:バックバッファは毎フレーム差し替える
+	backBufferHandle_ = frameGraph_.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	depthStencilHandle_ = frameGraph_.ImportResource("DepthStencil", ResourceState::kDepthWrite, ResourceState::kDepthWrite);
+	frameGraph_.SetImportedResource(depthStencilHandle_, depthStencilResource_.Get());
+
+	//========================================
+	// パス:クリア → シーン(並列記録するパス) → オーバーレイ(ImGui)
+	// 各パスのバリアはそのパスを記録し始める位置で張る
+	clearPass_ = frameGraph_.AddPass("Clear");
+	frameGraph_.Write(clearPass_, backBufferHandle_, ResourceState::kRenderTarget);
+	frameGraph_.Write(clearPass_, depthStencilHandle_, ResourceState::kDepthWrite);
+	scenePass_ = frameGraph_.AddPass("Scene");
+	frameGraph_.Write(scenePass_, backBufferHandle_, ResourceState::kRenderTarget);
+	frameGraph_.Write(scenePass_, depthStencilHandle_, ResourceState::kDepthWrite);
+	overlayPass_ = frameGraph_.AddPass("Overlay", true);
+	frameGraph_.Write(overlayPass_, backBufferHandle_, ResourceState::kRenderTarget);
+
+	//========================================
+	// バリアの配置を決める
+	frameGraph_.Compile();
+}
+
 ///=============================================================================
 ///						TransitionBarrierを張る
 void DirectXCore::SetupTransitionBarrier() {
-	//ここでのバリアはTransition
-	barrier_.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-	//Noneにしておく
-	barrier_.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
 	//バリアを張る対象のリソース。現在のバックバッファに対して行う
-	barrier_.Transition.pResource = swapChainResource_[backBufferIndex_].Get();
-	//遷移前の(現在)のResouceState
-	barrier_.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
-	//遷移後のReosuceState
-	barrier_.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-	//TransitionBarrierを張る
-	commandList_->ResourceBarrier(1, &barrier_);
+	frameGraph_.SetImportedResource(backBufferHandle_, swapChainResource_[backBufferIndex_].Get());
+	//PRESENT → RENDER_TARGETなど、クリアの前に必要なバリアをまとめて張る
+	RecordFramePassBarriers(clearPass_, commandList_.Get());
+}
+
+///=============================================================================
+///						フレームのパスの前のバリア
+void DirectXCore::RecordFramePassBarriers(DirectXRenderGraph::PassHandle pass, ID3D12GraphicsCommandList* commandList) {
+	DirectXCommandList directXCommandList(commandList);
+	CaptureCommandList captureCommandList;
+	frameGraph_.RecordPassBarriers(pass, AttachCapture(&directXCommandList, &captureCommandList));
 }
 
 
@@ -425,43 +493,254 @@ void DirectXCore::CreateVirePortAndScissorRect() {
 ///=============================================================================
 ///						コマンドリストの決定
 void DirectXCore::CloseCommandList() {
+	//最後に実行されるコマンドリスト(並列記録時はエピローグ)
+	ID3D12GraphicsCommandList* lastCommandList = isEpilogueActive_ ? epilogueCommandList_.Get() : commandList_.Get();
 
 	//画面に書く処理はすべて終わり。画面に映すので状態を遷移
-	//今回はRenderTargetからPresebtにする
-	barrier_.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-	barrier_.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
-	//TransitionBarrierを張る
-	commandList_->ResourceBarrier(1, &barrier_);
+	//フレームグラフで決めた終わりのバリア(RenderTarget → Present)をまとめて張る
+	DirectXCommandList finalCommandList(lastCommandList);
+	CaptureCommandList captureCommandList;
+	frameGraph_.RecordFinalBarriers(AttachCapture(&finalCommandList, &captureCommandList));
 	//コマンドリストの内容を確定させる。すべてのコマンドを積んでからCloseすること
 	hr_ = commandList_->Close();
 	assert(SUCCEEDED(hr_));
+	if(isEpilogueActive_) {
+		hr_ = epilogueCommandList_->Close();
+		assert(SUCCEEDED(hr_));
+	}
 }
 
 ///=============================================================================
 ///						コマンドのキック
 void DirectXCore::ExecuteCommandList() {
+	//メイン → 並列記録したパス → エピローグの順でまとめて実行する
+	std::vector<ID3D12CommandList*> commandLists;
+	commandLists.reserve(passCommandLists_.size() + 2);
+	commandLists.push_back(commandList_.Get());
+	commandLists.insert(commandLists.end(), passCommandLists_.begin(), passCommandLists_.end());
+	if(isEpilogueActive_) {
+		commandLists.push_back(epilogueCommandList_.Get());
+	}
 	//GPUにコマンドリストの実行を行わせる
-	Microsoft::WRL::ComPtr <ID3D12CommandList> commandLists[] = { commandList_ };
-	commandQueue_->ExecuteCommandLists(1, commandLists->GetAddressOf());
+	commandQueue_->ExecuteCommandLists(static_cast<UINT>( commandLists.size() ), commandLists.data());
+	//取り込み中ならコマンドリストごとの記録を実行順につなげる
+	if(frameCapture_.IsCapturing()) {
+		frameCapture_.EndFrame(std::vector<const void*>(commandLists.begin(), commandLists.end()));
+	}
+	//ステートフィルタの件数を集計する(パスの記録は終わっているのでワーカーは触っていない)
+	{
+		std::lock_guard<std::mutex> lock(renderContextMutex_);
+		stateFilterStats_ = StateFilterStats{};
+		for(const std::unique_ptr<ThreadRenderContext>& context : renderContexts_) {
+			stateFilterStats_.stateSetCount += context->stateFilter.GetStateSetCount();
+			stateFilterStats_.skippedCount += context->stateFilter.GetSkippedCount();
+			context->stateFilter.ResetCounts();
+		}
+	}
+	++frameSerial_;
+	//並列記録の状態を戻す
+	passCommandLists_.clear();
+	isEpilogueActive_ = false;
+	isOverlayPassBegun_ = false;
+	BindCommandList(nullptr);
+	//フレームレートの制限(GPUに投げた後に待つので、待っている間もGPUは動く)
+	//VSync有効時はPresentが制限するので計測だけ行い、二重に制限しない
+	if(isVSyncEnabled_) {
+		framePacer_.MarkFrame();
+	} else {
+		framePacer_.WaitForNextFrame();
+	}
 	//GPUとOSに画面の交換を行うように通知する
-	swapChain_->Present(1, 0);
+	swapChain_->Present(isVSyncEnabled_ ? 1 : 0, 0);
+
+	//GPUがここまでたどり着いついたときに、このフレームのフェンス値を代入するようにSignalを送る
+	commandQueue_->Signal(fence_.Get(), frameInFlight_.Submit());
 
-	fenceValue_++;
-	//GPUがここまでたどり着いついたときに、Fenceの値を指定した値に代入するようにSignalを送る
-	commandQueue_->Signal(fence_.Get(), fenceValue_);
+	//次のフレームスロットへ進め、そのスロットを前回使ったフレームの完了だけを待つ
+	//GPUが今のフレームを処理している間にCPUは次のフレームを記録できる
+	WaitForFenceValue(frameInFlight_.Advance());
+
+	//GPUが使い終えたリング領域を巻き戻して次のフレームで使う
+	FrameRingRegion region = GetFrameRingRegion();
+	uploadAllocator_.Reset(region.cpuAddress, region.gpuAddress, region.size);
+
+	//次フレーム用のコマンドリストを準備
+	ID3D12CommandAllocator* commandAllocator = commandAllocators_[frameInFlight_.GetFrameIndex()].Get();
+	hr_ = commandAllocator->Reset();
+	assert(SUCCEEDED(hr_));
+	hr_ = commandList_->Reset(commandAllocator, nullptr);
+	assert(SUCCEEDED(hr_));
+}
+
+///=============================================================================
+///						描画先の設定
+void DirectXCore::SetupRenderTarget(ID3D12GraphicsCommandList* commandList) {
+	//描画先のRTVとDSVを設定する(クリアはメインのコマンドリストで済んでいる)
+	commandList->OMSetRenderTargets(1, &rtvHandles_[backBufferIndex_], false, &dsvHandle_);
+	// ViewPortとScissorRectの設定
+	commandList->RSSetViewports(1, &viewport_);
+	commandList->RSSetScissorRects(1, &scissorRect_);
+}
+
+///=============================================================================
+///						並列記録したコマンドリストの追加
+void DirectXCore::QueuePassCommandLists(const std::vector<ID3D12CommandList*>& commandLists) {
+	passCommandLists_.insert(passCommandLists_.end(), commandLists.begin(), commandLists.end());
+}
+
+///=============================================================================
+///						エピローグへの切り替え
+void DirectXCore::BeginEpilogueCommandList() {
+	if(isOverlayPassBegun_) {
+		return;
+	}
+	isOverlayPassBegun_ = true;
+	//パスがなければメインのコマンドリストにそのまま積めばよい
+	if(!passCommandLists_.empty()) {
+		//このフレームスロットのアロケータはAdvance時に完了待ち済み
+		ID3D12CommandAllocator* commandAllocator = epilogueAllocators_[frameInFlight_.GetFrameIndex()].Get();
+		hr_ = commandAllocator->Reset();
+		assert(SUCCEEDED(hr_));
+		hr_ = epilogueCommandList_->Reset(commandAllocator, nullptr);
+		assert(SUCCEEDED(hr_));
+		SetupRenderTarget(epilogueCommandList_.Get());
+		//以降このスレッドの記録はエピローグに積む
+		BindCommandList(epilogueCommandList_.Get());
+		isEpilogueActive_ = true;
+	}
+	//オーバーレイ(ImGui)の前のバリアは、オーバーレイを記録するコマンドリストに張る
+	RecordFramePassBarriers(overlayPass_, isEpilogueActive_ ? epilogueCommandList_.Get() : commandList_.Get());
+}
+
+///=============================================================================
+///						描画コマンドの発行先の取得
+BaseCommandList* DirectXCore::GetRenderCommandList() {
+	if(boundRenderCommandList_) {
+		return boundRenderCommandList_;
+	}
+	//スレッドごとのD3D12版を今の記録先に向けて使う
+	ThreadRenderContext* context = GetThreadRenderContext();
+	ID3D12GraphicsCommandList* target = boundCommandList_ ? boundCommandList_ : commandList_.Get();
+	context->directXCommandList.SetCommandList(target);
+	//取り込みはフィルタの後ろに挟み、実際にGPUへ流れるコマンドを記録する
+	BaseCommandList* commandList = AttachCapture(&context->directXCommandList, &context->captureCommandList);
+	if(!isStateFilterEnabled_) {
+		return commandList;
+	}
+	//記録先が変わったか、フレームが進んで記録し直しているなら覚えている状態は使えない
+	if(context->filteredCommandList != target || context->filteredFrameSerial != frameSerial_) {
+		context->stateFilter.Invalidate();
+		context->filteredCommandList = target;
+		context->filteredFrameSerial = frameSerial_;
+	}
+	context->stateFilter.SetTarget(commandList);
+	return &context->stateFilter;
+}
+
+///=============================================================================
+///						スレッドごとの作業領域の取得
+DirectXCore::ThreadRenderContext* DirectXCore::GetThreadRenderContext() {
+	if(!threadRenderContext_) {
+		std::lock_guard<std::mutex> lock(renderContextMutex_);
+		renderContexts_.push_back(std::make_unique<ThreadRenderContext>());
+		threadRenderContext_ = renderContexts_.back().get();
+	}
+	return threadRenderContext_;
+}
+
+///=============================================================================
+///						ステートフィルタの切り替え
+void DirectXCore::SetStateFilterEnabled(bool isEnabled) {
+	isStateFilterEnabled_ = isEnabled;
+	//切り替えの前後でフィルタを通っていない設定があるので、覚えている状態を捨てさせる
+	std::lock_guard<std::mutex> lock(renderContextMutex_);
+	for(const std::unique_ptr<ThreadRenderContext>& context : renderContexts_) {
+		context->filteredCommandList = nullptr;
+	}
+}
+
+///=============================================================================
+///						同じ内容の定数の書き込み
+D3D12_GPU_VIRTUAL_ADDRESS DirectXCore::UploadSharedConstantBuffer(const void* data, size_t size) {
+	//控えに入らない大きさは使い回さない
+	if(size > kSharedUploadMaxSize) {
+		UploadAllocation allocation = AllocateUpload(size);
+		std::memcpy(allocation.cpuAddress, data, size);
+		return allocation.gpuAddress;
+	}
+	ThreadRenderContext* context = GetThreadRenderContext();
+	//このフレームで同じ内容を書いていればそのアドレスを使う
+	for(const SharedUpload& upload : context->sharedUploads) {
+		if(upload.frameSerial == frameSerial_ && upload.size == size && std::memcmp(upload.data, data, size) == 0) {
+			return upload.gpuAddress;
+		}
+	}
+	UploadAllocation allocation = AllocateUpload(size);
+	std::memcpy(allocation.cpuAddress, data, size);
+	//古いものから置き換える
+	SharedUpload& upload = context->sharedUploads[context->nextSharedUpload];
+	context->nextSharedUpload = ( context->nextSharedUpload + 1 ) % kSharedUploadCount;
+	upload.frameSerial = frameSerial_;
+	upload.size = static_cast<uint32_t>( size );
+	std::memcpy(upload.data, data, size);
+	upload.gpuAddress = allocation.gpuAddress;
+	return allocation.gpuAddress;
+}
+
+///=============================================================================
+///						取り込み用の発行先を挟む
+BaseCommandList* DirectXCore::AttachCapture(DirectXCommandList* commandList, CaptureCommandList* captureCommandList) {
+	if(!frameCapture_.IsCapturing()) {
+		return commandList;
+	}
+	//記録はコマンドリストごとに分け、実行時に並べ直す(実行順と同じ型のポインタをキーにする)
+	const ID3D12CommandList* key = commandList->GetCommandList();
+	captureCommandList->SetTarget(commandList, frameCapture_.GetStream(key));
+	return captureCommandList;
+}
+
+///=============================================================================
+///						フェンス値の完了待ち
+void DirectXCore::WaitForFenceValue(uint64_t fenceValue) {
 	//GetCompketedvalueの初期値はFence作成時に渡した初期値
-	if(fence_->GetCompletedValue() < fenceValue_) {
+	if(fence_->GetCompletedValue() < fenceValue) {
 		//指定したSignalにたどり着いていないので、たどり着くまで待つようにイベントを設定する
-		fence_->SetEventOnCompletion(fenceValue_, fenceEvent_);
+		fence_->SetEventOnCompletion(fenceValue, fenceEvent_);
 		//イベントを待つ
 		WaitForSingleObject(fenceEvent_, INFINITE);
 	}
+}
 
-	//次フレーム用のコマンドリストを準備
-	hr_ = commandAllocator_->Reset();
-	assert(SUCCEEDED(hr_));
-	hr_ = commandList_->Reset(commandAllocator_.Get(), nullptr);
-	assert(SUCCEEDED(hr_));
+///=============================================================================
+///						GPUの完全同期
+void DirectXCore::WaitForGpu() {
+	//キューに積まれたすべての処理の後ろにSignalを送り、完了を待つ
+	uint64_t fenceValue = frameInFlight_.IssueFenceValue();
+	commandQueue_->Signal(fence_.Get(), fenceValue);
+	WaitForFenceValue(fenceValue);
+}
+
+///=============================================================================
+///						リング領域からの切り出し
+UploadAllocation DirectXCore::AllocateUpload(size_t size, size_t alignment) {
+	UploadAllocation allocation = uploadAllocator_.Allocate(size, alignment);
+	if(allocation.cpuAddress == nullptr) {
+		//容量不足はkFrameRingRegionSize_を増やして対応する
+		Log("Frame upload region overflow", LogLevel::Error);
+		throw std::runtime_error("Frame upload region overflow");
+	}
+	return allocation;
+}
+
+///=============================================================================
+///						リング領域の取得
+FrameRingRegion DirectXCore::GetFrameRingRegion() const {
+	size_t offset = kFrameRingRegionSize_ * frameInFlight_.GetFrameIndex();
+	FrameRingRegion region{};
+	region.cpuAddress = frameRingData_ + offset;
+	region.gpuAddress = frameRingResource_->GetGPUVirtualAddress() + offset;
+	region.size = kFrameRingRegionSize_;
+	return region;
 }
 
 ///=============================================================================
@@ -512,6 +791,10 @@ void DirectXCore::CreateDXCCompiler() {
 	//現時点でincludeはしないが、includeに対応するために設定を行う
 	hr_ = dxcUtils_->CreateDefaultIncludeHandler(&includeHandler_);
 	assert(SUCCEEDED(hr_));
+	//コンパイル済みシェーダーの保存先
+	shaderCache_.Initialize("resources/shader/cache");
+	//パイプラインステートの保存先
+	pipelineStateCache_.Initialize(device_.Get(), "resources/shader/cache/pipeline.plib");
 }
 
 ///=============================================================================
@@ -591,15 +874,137 @@ Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> DirectXCore::CreateDescriptorHeap(D
 ///=============================================================================
 ///						シェーダーのコンパイル
 IDxcBlob* DirectXCore::CompileShader(const std::wstring& filePath, const wchar_t* profile) {
+	//========================================
+	// キャッシュにあればそれを返す
+	std::vector<std::wstring> arguments = GetShaderCompileArguments();
+	uint64_t key = ShaderCache::ComputeKey(filePath, profile, arguments);
+	std::vector<uint8_t> bytecode;
+	if(key != 0 && shaderCache_.Find(key, bytecode)) {
+		IDxcBlobEncoding* cachedBlob = nullptr;
+		HRESULT hr = dxcUtils_->CreateBlob(bytecode.data(), static_cast<UINT32>( bytecode.size() ), DXC_CP_ACP, &cachedBlob);
+		assert(SUCCEEDED(hr));
+		Log(ConvertString(std::format(L"Shader Cache Hit, path:{},profile:{}", filePath, profile)), LogLevel::Success);
+		return cachedBlob;
+	}
 
-	/// ===hlseファイルを読む=== ///
+	//========================================
+	// コンパイルしてキャッシュに載せる
 	//これからシェーダーをコンパイルする旨をログに出す
 	Log(ConvertString(std::format(L"Begin Compiler,path:{},profile:{}", filePath, profile)), LogLevel::Info);
-	//hlseファイルを読む
-	IDxcBlobEncoding* shaderSource = nullptr;
-	HRESULT hr = dxcUtils_->LoadFile(filePath.c_str(), nullptr, &shaderSource);
+	std::string errorMessage;
+	Microsoft::WRL::ComPtr<IDxcBlob> shaderBlob = CompileShaderWithDxc(dxcUtils_, dxcCompiler_, includeHandler_, filePath, profile, arguments, errorMessage);
+	if(!shaderBlob) {
+		Log(errorMessage, LogLevel::Error);
+		//警告・エラーダメ絶対
+		assert(false);
+		return nullptr;
+	}
+	if(key != 0) {
+		shaderCache_.Store(key, shaderBlob->GetBufferPointer(), shaderBlob->GetBufferSize());
+	}
+	//成功したログを出す
+	Log(ConvertString(std::format(L"Compile Succeeded, path:{},profile:{}", filePath, profile)), LogLevel::Success);
+	//実行用のバイナリを返却
+	return shaderBlob.Detach();
+}
+
+///=============================================================================
+///						シェーダーの並列コンパイル
+void DirectXCore::PrecompileShaders(const std::vector<ShaderCompileDesc>& shaders) {
+	//========================================
+	// キャッシュにないものだけを集める
+	struct PendingShader {
+		const ShaderCompileDesc* desc;
+		uint64_t key;
+		std::string errorMessage;
+	};
+	std::vector<std::wstring> arguments = GetShaderCompileArguments();
+	std::vector<PendingShader> pendingShaders;
+	for(const ShaderCompileDesc& shader : shaders) {
+		uint64_t key = ShaderCache::ComputeKey(shader.filePath, shader.profile, arguments);
+		std::vector<uint8_t> bytecode;
+		//読めないファイルはCompileShaderで止める
+		if(key == 0 || shaderCache_.Find(key, bytecode)) {
+			continue;
+		}
+		pendingShaders.push_back({ &shader, key, {} });
+	}
+	if(pendingShaders.empty()) {
+		Log("All shaders were found in the cache.", LogLevel::Success);
+		return;
+	}
+
+	//========================================
+	// ワーカーごとにDXCを用意し、残っているシェーダーを取り合ってコンパイルする
+	std::atomic<size_t> nextIndex = 0;
+	auto compileWorker = [&]() {
+		Microsoft::WRL::ComPtr<IDxcUtils> dxcUtils;
+		Microsoft::WRL::ComPtr<IDxcCompiler3> dxcCompiler;
+		Microsoft::WRL::ComPtr<IDxcIncludeHandler> includeHandler;
+		bool isReady = SUCCEEDED(DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&dxcUtils))) &&
+			SUCCEEDED(DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&dxcCompiler))) &&
+			SUCCEEDED(dxcUtils->CreateDefaultIncludeHandler(&includeHandler));
+		for(size_t i = nextIndex.fetch_add(1); i < pendingShaders.size(); i = nextIndex.fetch_add(1)) {
+			PendingShader& pending = pendingShaders[i];
+			if(!isReady) {
+				pending.errorMessage = "Failed to create DXC instance.";
+				continue;
+			}
+			Microsoft::WRL::ComPtr<IDxcBlob> shaderBlob = CompileShaderWithDxc(dxcUtils.Get(), dxcCompiler.Get(), includeHandler.Get(),
+				pending.desc->filePath, pending.desc->profile.c_str(), arguments, pending.errorMessage);
+			if(shaderBlob) {
+				shaderCache_.Store(pending.key, shaderBlob->GetBufferPointer(), shaderBlob->GetBufferSize());
+			}
+		}
+	};
+	uint32_t hardwareThreadCount = ( std::max )( 1u, std::thread::hardware_concurrency() );
+	size_t workerCount = ( std::min )( pendingShaders.size(), static_cast<size_t>( hardwareThreadCount ) );
+	std::vector<std::future<void>> workers;
+	//メインスレッドも1つ分を受け持つ
+	for(size_t i = 1; i < workerCount; ++i) {
+		workers.push_back(std::async(std::launch::async, compileWorker));
+	}
+	compileWorker();
+	for(auto& worker : workers) {
+		worker.get();
+	}
+
+	//========================================
+	// 結果のログはメインスレッドでまとめて出す
+	for(const PendingShader& pending : pendingShaders) {
+		if(!pending.errorMessage.empty()) {
+			Log(pending.errorMessage, LogLevel::Error);
+			//警告・エラーダメ絶対
+			assert(false);
+			continue;
+		}
+		Log(ConvertString(std::format(L"Compile Succeeded, path:{},profile:{}", pending.desc->filePath, pending.desc->profile)), LogLevel::Success);
+	}
+}
+
+///=============================================================================
+///						コンパイル引数
+std::vector<std::wstring> DirectXCore::GetShaderCompileArguments() {
+#ifdef _DEBUG
+	return { L"-E", L"main", L"-Zi", L"-Qembed_debug", L"-Od", L"-Zpr" };
+#else
+	return { L"-E", L"main", L"-O3", L"-Zpr" };
+#endif // _DEBUG
+}
+
+///=============================================================================
+///						DXCでのコンパイル
+Microsoft::WRL::ComPtr<IDxcBlob> DirectXCore::CompileShaderWithDxc(IDxcUtils* dxcUtils, IDxcCompiler3* dxcCompiler, IDxcIncludeHandler* includeHandler,
+	const std::wstring& filePath, const wchar_t* profile, const std::vector<std::wstring>& arguments, std::string& errorMessage) {
+
+	/// ===hlseファイルを読む=== ///
+	Microsoft::WRL::ComPtr<IDxcBlobEncoding> shaderSource = nullptr;
+	HRESULT hr = dxcUtils->LoadFile(filePath.c_str(), nullptr, &shaderSource);
 	//読めなかったら止める
-	assert(SUCCEEDED(hr));
+	if(FAILED(hr)) {
+		errorMessage = ConvertString(std::format(L"Failed to load shader, path:{}", filePath));
+		return nullptr;
+	}
 	//読み込んだファイルの内容を設定する
 	DxcBuffer shaderSourceBuffer = {};
 	shaderSourceBuffer.Ptr = shaderSource->GetBufferPointer();
@@ -607,51 +1012,44 @@ IDxcBlob* DirectXCore::CompileShader(const std::wstring& filePath, const wchar_t
 	shaderSourceBuffer.Encoding = DXC_CP_UTF8;//UTF-8の文字コードであることを通知
 
 	/// ===コンパイルする=== ///
-	LPCWSTR arguments[] = {
-	filePath.c_str(),
-	L"-E",L"main",
-	L"-T",profile,
-	L"-Zi",L"-Qembed_debug",
-	L"-Od",
-	L"-Zpr",
-	};
+	std::vector<LPCWSTR> argumentPointers = { filePath.c_str(), L"-T", profile };
+	for(const std::wstring& argument : arguments) {
+		argumentPointers.push_back(argument.c_str());
+	}
 	//実際にShaderをコンパイルする
-	IDxcResult* shaderResult = nullptr;
-	hr = dxcCompiler_->Compile(
+	Microsoft::WRL::ComPtr<IDxcResult> shaderResult = nullptr;
+	hr = dxcCompiler->Compile(
 		&shaderSourceBuffer,
-		arguments,
-		_countof(arguments),
-		includeHandler_,
+		argumentPointers.data(),
+		static_cast<UINT32>( argumentPointers.size() ),
+		includeHandler,
 		IID_PPV_ARGS(&shaderResult)
 	);
 	//コンパイルエラーではなくdxcが起動できないと致命的な状況
-	assert(SUCCEEDED(hr));
+	if(FAILED(hr)) {
+		errorMessage = "Failed to run dxc.";
+		return nullptr;
+	}
 
 	/// ===警告・エラーがでてないか確認する=== ///
-	IDxcBlobUtf8* shaderError = nullptr;
+	Microsoft::WRL::ComPtr<IDxcBlobUtf8> shaderError = nullptr;
 	if(shaderResult->HasOutput(DXC_OUT_ERRORS)) {
 		shaderResult->GetOutput(DXC_OUT_ERRORS, IID_PPV_ARGS(&shaderError), nullptr);
 	}
-	//エラーがある場合はエラーを出力して終了
+	//エラーがある場合はエラーを返して終了
 	if(shaderError != nullptr && shaderError->GetStringLength() != 0) {
-		Log(shaderError->GetStringPointer(), LogLevel::Error);
-		if(shaderResult->HasOutput(DXC_OUT_ERRORS)) {
-			shaderResult->GetOutput(DXC_OUT_ERRORS, IID_PPV_ARGS(&shaderError), nullptr);
-		}
-		//警告・エラーダメ絶対
-		assert(false);
+		errorMessage = shaderError->GetStringPointer();
+		return nullptr;
 	}
 
 	/// ===Compile結果を受け取って返す=== ///
 	//コンパイル結果から実行用のバイナリ部分を取得
-	IDxcBlob* shaderBlob = nullptr;
+	Microsoft::WRL::ComPtr<IDxcBlob> shaderBlob = nullptr;
 	hr = shaderResult->GetOutput(DXC_OUT_OBJECT, IID_PPV_ARGS(&shaderBlob), nullptr);
-	//成功したログを出す
-	Log(ConvertString(std::format(L"Compile Succeeded, path:{},profile:{}", filePath, profile)), LogLevel::Success);
-	//もう使わないリソースを開放
-	shaderSource->Release();
-	shaderResult->Release();
-	//実行用のバイナリを返却
+	if(FAILED(hr) || !shaderBlob) {
+		errorMessage = ConvertString(std::format(L"Failed to get shader object, path:{}", filePath));
+		return nullptr;
+	}
 	return shaderBlob;
 }
 
@@ -811,41 +1209,11 @@ D3D12_GPU_DESCRIPTOR_HANDLE DirectXCore::GetGPUDescriptorHandle(Microsoft::WRL::
 
 
 ///=============================================================================
-///						60FPS固定の処理
-///--------------------------------------------------------------
-///						 InitializeFixFPS
-void DirectXCore::InitializeFixFPS() {
-	//システムタイマーの分解能を上げる
+///						フレームペーサーの初期化
+void DirectXCore::InitializeFramePacer() {
+	//システムタイマーの分解能を上げる(スリープの寝過ごしを1ms程度に抑える)
 	timeBeginPeriod(1);
-	//現在時間を記録する
-	reference_ = std::chrono::steady_clock::now();
-}
-
-///--------------------------------------------------------------
-///						 UpdateFixFPS
-void DirectXCore::UpdateFixFPS() {
-	// 1/60秒ピッタリの時間
-	const std::chrono::microseconds kMinTime(uint64_t(1000000.0f / 60.0f));
-	// 1/60秒よりわずかに短い時間
-	const std::chrono::microseconds kMinCheckTime(uint64_t(1000000.0f / 65.0f));
-
-	//現在時間を取得する
-	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
-	//前回記録からの経過時間を取得する
-	std::chrono::microseconds elapsed =
-		std::chrono::duration_cast<std::chrono::microseconds>( now - reference_ );
-
-	// 1/60秒(よりわずかに短い時間)経っていない場合
-	if(elapsed < kMinCheckTime) {
-		//1/60秒経過するまで軽微なスリープを繰り返す
-		while(std::chrono::steady_clock::now() - reference_ < kMinTime) {
-			//1マイクロ秒スリープ
-			std::this_thread::sleep_for(std::chrono::microseconds(1));
-		}
-	}
-
-	//現在の時間を記録する
-	reference_ = std::chrono::steady_clock::now();
+	framePacer_.Initialize(nullptr, FramePacer::k60Fps);
 }
 
 
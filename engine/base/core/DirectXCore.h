@@ -15,6 +15,11 @@
 #include <wrl.h>
 #include <chrono>
 #include <thread>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstring>
+#include <stdexcept>
 //========================================
 // 自作関数
 #include "WstringUtility.h"
@@ -22,6 +27,16 @@ using namespace WstringUtility;
 #include "Logger.h"
 using namespace Logger;
 #include "WinApp.h"
+#include "FrameInFlight.h"
+#include "LinearUploadAllocator.h"
+#include "ShaderCache.h"
+#include "PipelineStateCache.h"
+#include "DirectXRenderGraph.h"
+#include "FramePacer.h"
+#include "DirectXCommandList.h"
+#include "CaptureCommandList.h"
+#include "FrameCapture.h"
+#include "StateFilterCommandList.h"
 //========================================
 // ReportLiveObj
 #include <dxgidebug.h>
@@ -45,9 +60,61 @@ using namespace Logger;
 #include "imgui_impl_dx12.h"
 #include "imgui_impl_win32.h"
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+///=============================================================================
+///						フレームごとのリング領域
+struct FrameRingRegion {
+	uint8_t* cpuAddress = nullptr;				// 書き込み先
+	D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;	// GPUから見たアドレス
+	size_t size = 0;							// 領域のサイズ
+};
+
+///=============================================================================
+///						まとめてコンパイルするシェーダー
+struct ShaderCompileDesc {
+	std::wstring filePath;	// ファイルパス
+	std::wstring profile;	// プロファイル
+};
+
 ///=============================================================================
 ///						クラス
 class DirectXCore {
+	///--------------------------------------------------------------
+	///							型定義
+public:
+	//========================================
+	// ステートフィルタの件数
+	struct StateFilterStats {
+		uint64_t stateSetCount = 0;	// 受け取った状態設定
+		uint64_t skippedCount = 0;	// 同じ値だったので落とした件数
+	};
+
+private:
+	//========================================
+	// 同じ内容の定数の使い回し用
+	// NOTE:控えは固定長で持ち、書き込みのたびにヒープを確保しない
+	static constexpr uint32_t kSharedUploadCount = 4;
+	static constexpr size_t kSharedUploadMaxSize = 256;
+	struct SharedUpload {
+		uint64_t frameSerial = 0;				// 書いたフレーム(0は未使用)
+		uint32_t size = 0;						// 書いた大きさ
+		alignas(16) uint8_t data[kSharedUploadMaxSize] = {};	// 書いた内容(アップロード領域は読み出しが遅いので控えを持つ)
+		D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;
+	};
+
+	//========================================
+	// スレッドごとの描画コマンド用の作業領域
+	struct ThreadRenderContext {
+		DirectXCommandList directXCommandList;
+		CaptureCommandList captureCommandList;
+		StateFilterCommandList stateFilter;
+		// ステートフィルタが状態を覚えている記録先とフレーム
+		const void* filteredCommandList = nullptr;
+		uint64_t filteredFrameSerial = 0;
+		// 最近書いた共有定数
+		SharedUpload sharedUploads[kSharedUploadCount];
+		uint32_t nextSharedUpload = 0;
+	};
+
 public:
 	///--------------------------------------------------------------
 	///						 メンバ関数
@@ -105,9 +172,15 @@ public:
 
 	/**----------------------------------------------------------------------------
 	 * \brief  CreateCommandAllocator コマンドアロケータの生成
+	 * \note   同時進行フレーム数ぶん生成する
 	 */
 	void CreateCommandAllocator();
 
+	/**----------------------------------------------------------------------------
+	 * \brief  CreateFrameRingBuffer フレームごとの動的データ用リングバッファの生成
+	 */
+	void CreateFrameRingBuffer();
+
 	/**----------------------------------------------------------------------------
 	 * \brief  CreateSwapChain SwapChainの生成
 	 */
@@ -156,11 +229,25 @@ public:
 	 */
 	void SettleCommandList();
 
+	/**----------------------------------------------------------------------------
+	 * \brief  CreateFrameGraph フレームのレンダーグラフの構築
+	 * \note   バックバッファと深度バッファへの読み書きを宣言し、バリアはグラフから張る
+	 */
+	void CreateFrameGraph();
+
 	/**----------------------------------------------------------------------------
 	 * \brief  SetupTransitionBarrier TransitionBarrierの設定
+	 * \note   フレームグラフの先頭パス(クリア)の前のバリアをまとめて張る
 	 */
 	void SetupTransitionBarrier();
 
+	/**----------------------------------------------------------------------------
+	 * \brief  RecordFramePassBarriers フレームグラフのパスの前のバリアを張る
+	 * \param  pass フレームグラフのパス
+	 * \param  commandList そのパスを記録し始めるコマンドリスト
+	 */
+	void RecordFramePassBarriers(DirectXRenderGraph::PassHandle pass, ID3D12GraphicsCommandList* commandList);
+
 	/**----------------------------------------------------------------------------
 	 * \brief  RenderTargetPreference レンダーターゲットの設定
 	 */
@@ -181,6 +268,59 @@ public:
 	 */
 	void ExecuteCommandList();
 
+	/**----------------------------------------------------------------------------
+	 * \brief  SetupRenderTarget 描画先・ビューポート・シザー矩形を設定
+	 * \param  commandList 設定するコマンドリスト
+	 * \note   並列記録用のコマンドリストは状態を引き継がないので記録開始時に呼ぶ
+	 */
+	void SetupRenderTarget(ID3D12GraphicsCommandList* commandList);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  QueuePassCommandLists 並列記録したコマンドリストを提出待ちに追加
+	 * \param  commandLists 実行順に並べたコマンドリスト
+	 * \note   メインのコマンドリストの後ろにまとめて1回で実行される
+	 */
+	void QueuePassCommandLists(const std::vector<ID3D12CommandList*>& commandLists);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  BeginEpilogueCommandList パスの後ろに続けて記録するコマンドリストへ切り替え
+	 * \note   並列記録したパスがある場合のみ切り替わる(ImGuiやPresent前のバリア用)
+	 *         オーバーレイのパスの前のバリアもここで張る。2回目以降の呼び出しは何もしない
+	 */
+	void BeginEpilogueCommandList();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  BindCommandList 呼び出したスレッドの記録先コマンドリストを設定
+	 * \param  commandList 記録先 nullptrでメインのコマンドリストに戻す
+	 */
+	static void BindCommandList(ID3D12GraphicsCommandList* commandList) { boundCommandList_ = commandList; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  BindRenderCommandList 呼び出したスレッドの描画コマンドの発行先を差し替える
+	 * \param  commandList 発行先(NullCommandListなど) nullptrでD3D12に戻す
+	 * \note   GPUに流さずに描画処理を動かしたいとき(計測や記録)に使う
+	 */
+	static void BindRenderCommandList(BaseCommandList* commandList) { boundRenderCommandList_ = commandList; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  RequestFrameCapture 次のフレームの描画コマンドを取り込む
+	 * \note   結果はGetFrameCapture()->GetLastCapture()で実行順に取り出せる。
+	 *         ImGuiの描画は取り込まない。ステートフィルタが有効なら落とした後のコマンドになる
+	 */
+	void RequestFrameCapture() { frameCapture_.Request(); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  WaitForFenceValue 指定したフェンス値の完了を待つ
+	 * \param  fenceValue フェンス値
+	 */
+	void WaitForFenceValue(uint64_t fenceValue);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  WaitForGpu GPUの処理がすべて終わるまで待つ
+	 * \note   リソースを破棄する前(シーン切り替え・終了処理)に呼ぶこと
+	 */
+	void WaitForGpu();
+
 	/**----------------------------------------------------------------------------
 	 * \brief  ReleaseResources リソースの開放
 	 */
@@ -229,6 +369,13 @@ public:
 	 */
 	IDxcBlob* CompileShader(const std::wstring& filePath, const wchar_t* profile);
 
+	/**----------------------------------------------------------------------------
+	 * \brief  PrecompileShaders シェーダーをまとめて並列にコンパイルしてキャッシュに載せる
+	 * \param  shaders シェーダーの一覧
+	 * \note   キャッシュにあるものは飛ばす。この後のCompileShaderはキャッシュから返る
+	 */
+	void PrecompileShaders(const std::vector<ShaderCompileDesc>& shaders);
+
 	/**----------------------------------------------------------------------------
 	 * \brief  CreateBufferResource バッファリソースの生成
 	 * \param  sizeInByte サイズ
@@ -236,6 +383,42 @@ public:
 	 */
 	Microsoft::WRL::ComPtr <ID3D12Resource> CreateBufferResource(size_t sizeInByte);
 
+	/**----------------------------------------------------------------------------
+	 * \brief  AllocateUpload 現在のフレームのリング領域から切り出す
+	 * \param  size サイズ
+	 * \param  alignment アライメント(定数バッファは256)
+	 * \return 確保結果 次に同じフレームスロットが回ってくるまで有効
+	 */
+	UploadAllocation AllocateUpload(size_t size, size_t alignment = LinearUploadAllocator::kConstantBufferAlignment);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  UploadConstantBuffer 定数をリング領域に書き込む
+	 * \param  data 書き込むデータ
+	 * \return CBVとして設定するGPUアドレス
+	 * \note   描画時に呼ぶ。描画パスから並列に呼んでよい
+	 */
+	template<typename T>
+	D3D12_GPU_VIRTUAL_ADDRESS UploadConstantBuffer(const T& data) {
+		UploadAllocation allocation = AllocateUpload(sizeof(T));
+		std::memcpy(allocation.cpuAddress, &data, sizeof(T));
+		return allocation.gpuAddress;
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  UploadSharedConstantBuffer 多くの描画で同じになる定数をリング領域に書き込む
+	 * \param  data 書き込むデータ
+	 * \return CBVとして設定するGPUアドレス
+	 * \note   このフレームで同じスレッドから同じ内容を書いていれば、そのアドレスを返す。
+	 *         アドレスがそろうのでステートフィルタで再設定を落とせる(ライト・カメラ用)。
+	 *         kSharedUploadMaxSizeより大きいものは使い回さず、毎回書き込む
+	 */
+	template<typename T>
+	D3D12_GPU_VIRTUAL_ADDRESS UploadSharedConstantBuffer(const T& data) {
+		static_assert(sizeof(T) <= kSharedUploadMaxSize, "UploadSharedConstantBuffer: use UploadConstantBuffer for large constants");
+		return UploadSharedConstantBuffer(&data, sizeof(T));
+	}
+	D3D12_GPU_VIRTUAL_ADDRESS UploadSharedConstantBuffer(const void* data, size_t size);
+
 	/**----------------------------------------------------------------------------
 	 * \brief  CreateTextureResource テクスチャリソースの生成
 	 * \param  metadata メタデータ
@@ -262,6 +445,20 @@ public:
 	///--------------------------------------------------------------
 	///						 
 private:
+	/**----------------------------------------------------------------------------
+	 * \brief  AttachCapture 取り込み中なら記録付きの発行先を挟む
+	 * \param  commandList D3D12版の発行先
+	 * \param  captureCommandList 挟む記録付きの発行先
+	 * \return 実際に使う発行先
+	 */
+	BaseCommandList* AttachCapture(DirectXCommandList* commandList, CaptureCommandList* captureCommandList);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetThreadRenderContext 呼び出したスレッドの描画コマンド用の作業領域の取得
+	 * \note   初回だけロックして生成する。持ち主はDirectXCore
+	 */
+	ThreadRenderContext* GetThreadRenderContext();
+
 	/// ===CPU=== ///
 	/**----------------------------------------------------------------------------
 	 * \brief  GetCPUDescriptorHandle CPUディスクリプタハンドルの取得
@@ -283,14 +480,30 @@ private:
 	D3D12_GPU_DESCRIPTOR_HANDLE GetGPUDescriptorHandle(Microsoft::WRL::ComPtr <ID3D12DescriptorHeap> descriptorHeap, uint32_t descriptorSize, uint32_t index);
 
 	/**----------------------------------------------------------------------------
-	 * \brief  InitializeFixFPS FPS固定更新の初期化
+	 * \brief  InitializeFramePacer フレームペーサーの初期化
 	 */
-	void InitializeFixFPS();
+	void InitializeFramePacer();
 
 	/**----------------------------------------------------------------------------
-	 * \brief  UpdateFixFPS FPS固定更新
+	 * \brief  GetShaderCompileArguments ビルド構成ごとのコンパイル引数
+	 * \note   Debugは最適化なし+デバッグ情報埋め込み、Releaseは最適化あり
 	 */
-	void UpdateFixFPS();
+	static std::vector<std::wstring> GetShaderCompileArguments();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  CompileShaderWithDxc DXCでコンパイル
+	 * \param  dxcUtils DXCユーティリティ
+	 * \param  dxcCompiler DXCコンパイラ
+	 * \param  includeHandler インクルードハンドラ
+	 * \param  filePath ファイルパス
+	 * \param  profile プロファイル
+	 * \param  arguments コンパイル引数
+	 * \param  errorMessage 失敗時のメッセージ
+	 * \return バイトコード 失敗時はnullptr
+	 * \note   DXCのインスタンスはスレッドごとに用意して渡す
+	 */
+	static Microsoft::WRL::ComPtr<IDxcBlob> CompileShaderWithDxc(IDxcUtils* dxcUtils, IDxcCompiler3* dxcCompiler, IDxcIncludeHandler* includeHandler,
+		const std::wstring& filePath, const wchar_t* profile, const std::vector<std::wstring>& arguments, std::string& errorMessage);
 
 
 	///--------------------------------------------------------------
@@ -324,6 +537,53 @@ public:
 	 */
 	Microsoft::WRL::ComPtr <ID3D12Device> GetDevice() { return device_; }
 
+	/**----------------------------------------------------------------------------
+	 * \brief  GetPipelineStateCache パイプラインステートキャッシュの取得
+	 */
+	PipelineStateCache* GetPipelineStateCache() { return &pipelineStateCache_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFramePacer フレームペーサーの取得
+	 * \note   目標フレームレートの変更やフレーム時間の統計に使う
+	 */
+	FramePacer* GetFramePacer() { return &framePacer_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFrameCapture フレームキャプチャの取得
+	 */
+	FrameCapture* GetFrameCapture() { return &frameCapture_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  SetStateFilterEnabled 同じ値の再設定を落とすかの設定
+	 */
+	void SetStateFilterEnabled(bool isEnabled);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  IsStateFilterEnabled 同じ値の再設定を落としているか
+	 */
+	bool IsStateFilterEnabled() const { return isStateFilterEnabled_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetStateFilterStats 直前のフレームのステートフィルタの件数
+	 */
+	const StateFilterStats& GetStateFilterStats() const { return stateFilterStats_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetDeltaTime 直前のフレームのデルタタイム(秒)
+	 */
+	float GetDeltaTime() const { return framePacer_.GetDeltaTime(); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  SetVSync VSyncの設定
+	 * \note   有効にするとPresentが画面の更新に合わせて制限し、フレームペーサーは計測だけ行う
+	 */
+	void SetVSync(bool isEnabled) { isVSyncEnabled_ = isEnabled; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  IsVSyncEnabled VSyncが有効か
+	 */
+	bool IsVSyncEnabled() const { return isVSyncEnabled_; }
+
 	/**----------------------------------------------------------------------------
 	 * \brief  SetCommandList コマンドリストの設定
 	 * \param  sCommandList
@@ -332,9 +592,16 @@ public:
 
 	/**----------------------------------------------------------------------------
 	 * \brief  GetCommandList コマンドリストの取得
-	 * \return
+	 * \return 呼び出したスレッドに結び付けられた記録先(なければメインのコマンドリスト)
+	 */
+	Microsoft::WRL::ComPtr <ID3D12GraphicsCommandList> GetCommandList() { return boundCommandList_ ? boundCommandList_ : commandList_.Get(); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetRenderCommandList 描画コマンドの発行先の取得
+	 * \return 差し替えられていればその発行先、なければこのスレッドの記録先に流すD3D12版
+	 * \note   描画処理はGetCommandListではなくこちらを使う
 	 */
-	Microsoft::WRL::ComPtr <ID3D12GraphicsCommandList> GetCommandList() { return commandList_.Get(); }
+	BaseCommandList* GetRenderCommandList();
 
 	/**----------------------------------------------------------------------------
 	 * \brief  GetSwapChainDesc スワップチェーンの設定の取得
@@ -351,6 +618,38 @@ public:
 	 */
 	Microsoft::WRL::ComPtr <ID3D12DescriptorHeap> GetRtvDescriptorHeap() { return rtvDescriptorHeap_; }
 
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFenceValue 最後にシグナルしたフェンス値の取得
+	 */
+	uint64_t GetFenceValue() const { return frameInFlight_.GetLastFenceValue(); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetCompletedFenceValue GPUが完了したフェンス値の取得
+	 */
+	uint64_t GetCompletedFenceValue() const { return fence_ ? fence_->GetCompletedValue() : frameInFlight_.GetLastFenceValue(); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFrameIndex 現在記録中のフレームスロット番号の取得
+	 */
+	uint32_t GetFrameIndex() const { return frameInFlight_.GetFrameIndex(); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFrameCount 同時進行フレーム数の取得
+	 */
+	static constexpr uint32_t GetFrameCount() { return kFrameCount_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFrameRingRegion 現在のフレームが書き込めるリング領域の取得
+	 * \note   同じ領域はkFrameCount_フレーム後まで再利用されない
+	 */
+	FrameRingRegion GetFrameRingRegion() const;
+
+	//========================================
+	// 同時進行フレーム数(2～3)
+	static constexpr uint32_t kFrameCount_ = 2;
+	// 1フレームあたりのリング領域サイズ
+	static constexpr size_t kFrameRingRegionSize_ = 4 * 1024 * 1024;
+
 
 
 
@@ -358,8 +657,25 @@ public:
 	///						 メンバ変数
 private:
 	//========================================
-	// 記録時間(FPS固定用)
-	std::chrono::steady_clock::time_point reference_;
+	// フレームレートの制限と計測
+	FramePacer framePacer_;
+	// VSyncで制限するか(有効ならフレームペーサーは計測だけ行う)
+	bool isVSyncEnabled_ = false;
+
+	//========================================
+	// 描画コマンドの取り込み
+	FrameCapture frameCapture_;
+
+	//========================================
+	// スレッドごとの描画コマンド用の作業領域
+	std::mutex renderContextMutex_;
+	std::vector<std::unique_ptr<ThreadRenderContext>> renderContexts_;
+	static thread_local ThreadRenderContext* threadRenderContext_;
+	// 提出したフレームの通し番号(フレームをまたいだ状態の使い回しを防ぐ)
+	uint64_t frameSerial_ = 1;
+	// ステートフィルタ
+	bool isStateFilterEnabled_ = true;
+	StateFilterStats stateFilterStats_;
 
 	//========================================
 	// WindowsAPI
@@ -393,10 +709,25 @@ private:
 	Microsoft::WRL::ComPtr<ID3D12CommandQueue> commandQueue_;
 
 	//========================================
-	// コマンドアロケータを生成する
-	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> commandAllocator_;
+	// コマンドアロケータを生成する(フレームごと)
+	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> commandAllocators_[kFrameCount_];
 	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList_;
 
+	//========================================
+	// 並列記録
+	// スレッドごとの記録先
+	static thread_local ID3D12GraphicsCommandList* boundCommandList_;
+	// スレッドごとの描画コマンドの差し替え先
+	static thread_local BaseCommandList* boundRenderCommandList_;
+	// 提出待ちのパスのコマンドリスト
+	std::vector<ID3D12CommandList*> passCommandLists_;
+	// パスの後ろに続けて記録するコマンドリスト
+	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> epilogueAllocators_[kFrameCount_];
+	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> epilogueCommandList_;
+	bool isEpilogueActive_ = false;
+	// このフレームでオーバーレイを始めたか
+	bool isOverlayPassBegun_ = false;
+
 	//========================================
 	// スワップチェーンを生成する
 	Microsoft::WRL::ComPtr<IDXGISwapChain4> swapChain_;
@@ -405,8 +736,16 @@ private:
 	//========================================
 	// Fenceの生成
 	Microsoft::WRL::ComPtr<ID3D12Fence> fence_;
-	uint64_t fenceValue_ = 0;
 	HANDLE fenceEvent_ = nullptr;  // Initialize to nullptr
+	// フレームごとのフェンス値の管理
+	FrameInFlight frameInFlight_;
+
+	//========================================
+	// フレームごとの動的データ用リングバッファ
+	Microsoft::WRL::ComPtr<ID3D12Resource> frameRingResource_;
+	uint8_t* frameRingData_ = nullptr;
+	// リング領域の線形アロケータ(フレームの頭で巻き戻す)
+	LinearUploadAllocator uploadAllocator_;
 
 	//========================================
 	// 深度バッファ
@@ -433,8 +772,20 @@ private:
 	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandles_[2]{};
 	//これから書き込むバックバッファのインデックスを取得
 	UINT backBufferIndex_ = 0;
-	//TransitionBarrierの設定
-	D3D12_RESOURCE_BARRIER barrier_{};
+
+	//========================================
+	// フレームのレンダーグラフ
+	DirectXRenderGraph frameGraph_;
+	// バックバッファ
+	DirectXRenderGraph::ResourceHandle backBufferHandle_ = RenderGraph::kInvalidHandle;
+	// 深度バッファ
+	DirectXRenderGraph::ResourceHandle depthStencilHandle_ = RenderGraph::kInvalidHandle;
+	// クリア(メインのコマンドリスト)
+	DirectXRenderGraph::PassHandle clearPass_ = RenderGraph::kInvalidHandle;
+	// シーン(並列記録するパス。バリアはメインのコマンドリストの最後に張る)
+	DirectXRenderGraph::PassHandle scenePass_ = RenderGraph::kInvalidHandle;
+	// オーバーレイ(ImGui。エピローグかメインのコマンドリスト)
+	DirectXRenderGraph::PassHandle overlayPass_ = RenderGraph::kInvalidHandle;
 
 	//========================================
 	// SwapChainからResource
@@ -447,6 +798,10 @@ private:
 	IDxcUtils* dxcUtils_ = nullptr;
 	// DXCライブラリ
 	IDxcIncludeHandler* includeHandler_ = nullptr;
+	// コンパイル済みシェーダーのキャッシュ
+	ShaderCache shaderCache_;
+	// パイプラインステートのキャッシュ
+	PipelineStateCache pipelineStateCache_;
 
 	//========================================
 	// ビューポート
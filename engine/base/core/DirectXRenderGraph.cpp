@@ -0,0 +1,180 @@
+/*********************************************************************
+ * \file   DirectXRenderGraph.cpp
+ * \brief  レンダーグラフのコンパイル結果をD3D12のバリアと共有ヒープに落とし込む
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "DirectXRenderGraph.h"
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+///=============================================================================
+///						初期化
+void DirectXRenderGraph::Initialize(ID3D12Device* device) {
+	assert(device);
+	device_ = device;
+}
+
+///=============================================================================
+///						外部のリソースを登録
+DirectXRenderGraph::ResourceHandle DirectXRenderGraph::ImportResource(const std::string& name, ResourceState initialState, ResourceState finalState) {
+	ResourceHandle handle = graph_.ImportResource(name, initialState, finalState);
+	resources_.resize(graph_.GetResourceCount(), nullptr);
+	return handle;
+}
+
+///=============================================================================
+///						外部のリソースの実体の設定
+void DirectXRenderGraph::SetImportedResource(ResourceHandle resource, ID3D12Resource* d3d12Resource) {
+	assert(!graph_.IsTransient(resource));
+	resources_[resource] = d3d12Resource;
+}
+
+///=============================================================================
+///						一時テクスチャの登録
+DirectXRenderGraph::ResourceHandle DirectXRenderGraph::CreateTexture(const std::string& name, const D3D12_RESOURCE_DESC& desc, const D3D12_CLEAR_VALUE* clearValue) {
+	//共有ヒープはRT/DSテクスチャ専用にする(リソースの種類を混ぜられないGPUがあるため)
+	assert(desc.Flags & ( D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL ));
+	D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = device_->GetResourceAllocationInfo(0, 1, &desc);
+	ResourceHandle handle = graph_.CreateTransientResource(name, allocationInfo.SizeInBytes, allocationInfo.Alignment);
+	resources_.resize(graph_.GetResourceCount(), nullptr);
+
+	TransientTexture texture{};
+	texture.handle = handle;
+	texture.desc = desc;
+	texture.hasClearValue = clearValue != nullptr;
+	if(clearValue) {
+		texture.clearValue = *clearValue;
+	}
+	transientTextures_.push_back(texture);
+	return handle;
+}
+
+///=============================================================================
+///						コンパイル
+void DirectXRenderGraph::Compile() {
+	compiled_ = graph_.Compile();
+
+	//========================================
+	// パスからコンパイル結果の位置を引けるようにする
+	compiledPassIndices_.assign(graph_.GetPassCount(), RenderGraph::kInvalidHandle);
+	for(uint32_t i = 0; i < compiled_.passes.size(); ++i) {
+		compiledPassIndices_[compiled_.passes[i].pass] = i;
+	}
+
+	//========================================
+	// 一時テクスチャを共有ヒープ上に作り直す
+	for(TransientTexture& texture : transientTextures_) {
+		texture.resource = nullptr;
+		resources_[texture.handle] = nullptr;
+	}
+	transientHeap_ = nullptr;
+	if(compiled_.transientHeapSize == 0) {
+		return;
+	}
+	D3D12_HEAP_DESC heapDesc{};
+	heapDesc.SizeInBytes = compiled_.transientHeapSize;
+	heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+	heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+	heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+	HRESULT hr = device_->CreateHeap(&heapDesc, IID_PPV_ARGS(&transientHeap_));
+	if(FAILED(hr)) {
+		throw std::runtime_error("ENGINE MESSAGE: RenderGraph Failed to create transient heap :(");
+	}
+	for(const RenderGraph::TransientPlacement& placement : compiled_.placements) {
+		auto it = std::find_if(transientTextures_.begin(), transientTextures_.end(),
+			[&](const TransientTexture& texture) { return texture.handle == placement.resource; });
+		assert(it != transientTextures_.end());
+		hr = device_->CreatePlacedResource(transientHeap_.Get(), placement.heapOffset, &it->desc,
+			ToD3D12State(placement.initialState), it->hasClearValue ? &it->clearValue : nullptr, IID_PPV_ARGS(&it->resource));
+		if(FAILED(hr)) {
+			throw std::runtime_error("ENGINE MESSAGE: RenderGraph Failed to create transient texture :(");
+		}
+		resources_[placement.resource] = it->resource.Get();
+	}
+}
+
+///=============================================================================
+///						パスの前のバリア
+void DirectXRenderGraph::RecordPassBarriers(PassHandle pass, BaseCommandList* commandList) const {
+	uint32_t compiledIndex = compiledPassIndices_[pass];
+	if(compiledIndex == RenderGraph::kInvalidHandle) {
+		return;
+	}
+	const RenderGraph::CompiledPass& compiledPass = compiled_.passes[compiledIndex];
+	//========================================
+	// エイリアシング → 状態遷移の順に1回の呼び出しでまとめて張る
+	std::vector<ResourceBarrierDesc> barriers;
+	barriers.reserve(compiledPass.aliasingBarriers.size() + compiledPass.barriers.size());
+	for(const RenderGraph::AliasingBarrier& aliasing : compiledPass.aliasingBarriers) {
+		ResourceBarrierDesc barrier{};
+		barrier.type = ResourceBarrierDesc::Type::kAliasing;
+		barrier.resourceBefore = resources_[aliasing.before];
+		barrier.resource = resources_[aliasing.after];
+		barriers.push_back(barrier);
+	}
+	for(const RenderGraph::TransitionBarrier& transition : compiledPass.barriers) {
+		barriers.push_back(MakeTransitionBarrier(transition));
+	}
+	if(!barriers.empty()) {
+		commandList->ResourceBarriers(static_cast<uint32_t>( barriers.size() ), barriers.data());
+	}
+}
+
+///=============================================================================
+///						フレームの終わりのバリア
+void DirectXRenderGraph::RecordFinalBarriers(BaseCommandList* commandList) const {
+	std::vector<ResourceBarrierDesc> barriers;
+	barriers.reserve(compiled_.finalBarriers.size());
+	for(const RenderGraph::TransitionBarrier& transition : compiled_.finalBarriers) {
+		barriers.push_back(MakeTransitionBarrier(transition));
+	}
+	if(!barriers.empty()) {
+		commandList->ResourceBarriers(static_cast<uint32_t>( barriers.size() ), barriers.data());
+	}
+}
+
+///=============================================================================
+///						遷移バリアの変換
+ResourceBarrierDesc DirectXRenderGraph::MakeTransitionBarrier(const RenderGraph::TransitionBarrier& transition) const {
+	ResourceBarrierDesc barrier{};
+	barrier.type = ResourceBarrierDesc::Type::kTransition;
+	barrier.resource = resources_[transition.resource];
+	barrier.before = transition.before;
+	barrier.after = transition.after;
+	return barrier;
+}
+
+///=============================================================================
+///						状態の変換
+D3D12_RESOURCE_STATES DirectXRenderGraph::ToD3D12State(ResourceState state) {
+	//========================================
+	// ビットごとに対応するD3D12の状態を合成する
+	D3D12_RESOURCE_STATES d3d12State = D3D12_RESOURCE_STATE_COMMON;
+	if(HasAllStates(state, ResourceState::kRenderTarget)) {
+		d3d12State |= D3D12_RESOURCE_STATE_RENDER_TARGET;
+	}
+	if(HasAllStates(state, ResourceState::kDepthWrite)) {
+		d3d12State |= D3D12_RESOURCE_STATE_DEPTH_WRITE;
+	}
+	if(HasAllStates(state, ResourceState::kDepthRead)) {
+		d3d12State |= D3D12_RESOURCE_STATE_DEPTH_READ;
+	}
+	if(HasAllStates(state, ResourceState::kShaderResource)) {
+		d3d12State |= D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+	}
+	if(HasAllStates(state, ResourceState::kUnorderedAccess)) {
+		d3d12State |= D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+	}
+	if(HasAllStates(state, ResourceState::kCopySource)) {
+		d3d12State |= D3D12_RESOURCE_STATE_COPY_SOURCE;
+	}
+	if(HasAllStates(state, ResourceState::kCopyDest)) {
+		d3d12State |= D3D12_RESOURCE_STATE_COPY_DEST;
+	}
+	//PRESENTはCOMMONと同じ値
+	return d3d12State;
+}
@@ -0,0 +1,144 @@
+/*********************************************************************
+ * \file   DirectXRenderGraph.h
+ * \brief  レンダーグラフのコンパイル結果をD3D12のバリアと共有ヒープに落とし込む
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   一時リソースは1つのヒープにまとめて配置する(RT/DSテクスチャのみ)。
+ *         エイリアシングで有効になったRT/DSは中身が不定なので、最初に使うパスでクリアすること
+ *********************************************************************/
+#pragma once
+#include "RenderGraph.h"
+#include "BaseCommandList.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <vector>
+
+///=============================================================================
+///						D3D12レンダーグラフ
+class DirectXRenderGraph {
+	///--------------------------------------------------------------
+	///							型定義
+public:
+	using ResourceHandle = RenderGraph::ResourceHandle;
+	using PassHandle = RenderGraph::PassHandle;
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  device デバイス
+	 */
+	void Initialize(ID3D12Device* device);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  ImportResource 外部のリソースを登録
+	 * \param  name 名前
+	 * \param  initialState フレーム開始時の状態
+	 * \param  finalState フレーム終了時に戻す状態
+	 * \note   実体はSetImportedResourceで毎フレーム差し替えられる(バックバッファなど)
+	 */
+	ResourceHandle ImportResource(const std::string& name, ResourceState initialState, ResourceState finalState);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  SetImportedResource 外部のリソースの実体の設定
+	 */
+	void SetImportedResource(ResourceHandle resource, ID3D12Resource* d3d12Resource);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  CreateTexture 一時テクスチャの登録
+	 * \param  name 名前
+	 * \param  desc リソースの設定(RTかDSのフラグが必要)
+	 * \param  clearValue 最適化クリア値(不要ならnullptr)
+	 * \note   実体はCompileで共有ヒープ上に作られる
+	 */
+	ResourceHandle CreateTexture(const std::string& name, const D3D12_RESOURCE_DESC& desc, const D3D12_CLEAR_VALUE* clearValue = nullptr);
+
+	/// \brief パスの追加
+	PassHandle AddPass(const std::string& name, bool hasSideEffect = false) { return graph_.AddPass(name, hasSideEffect); }
+
+	/// \brief パスが読むリソースの宣言
+	void Read(PassHandle pass, ResourceHandle resource, ResourceState state) { graph_.Read(pass, resource, state); }
+
+	/// \brief パスが書くリソースの宣言
+	void Write(PassHandle pass, ResourceHandle resource, ResourceState state) { graph_.Write(pass, resource, state); }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Compile グラフのコンパイルと一時リソースの生成
+	 * \note   宣言を変えたら呼び直す。GPUが古い一時リソースを使っていないこと
+	 */
+	void Compile();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  RecordPassBarriers パスの前のバリアをまとめて積む
+	 * \param  pass パス
+	 * \param  commandList 積み先
+	 * \note   除外されたパスなら何もしない
+	 */
+	void RecordPassBarriers(PassHandle pass, BaseCommandList* commandList) const;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  RecordFinalBarriers フレームの終わりのバリアをまとめて積む
+	 */
+	void RecordFinalBarriers(BaseCommandList* commandList) const;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  ToD3D12State 状態の変換
+	 */
+	static D3D12_RESOURCE_STATES ToD3D12State(ResourceState state);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief パスが除外されたか
+	bool IsPassCulled(PassHandle pass) const { return compiledPassIndices_[pass] == RenderGraph::kInvalidHandle; }
+
+	/// \brief リソースの実体の取得
+	ID3D12Resource* GetResource(ResourceHandle resource) const { return resources_[resource]; }
+
+	/// \brief コンパイル結果の取得
+	const RenderGraph::CompiledGraph& GetCompiledGraph() const { return compiled_; }
+
+	/// \brief 宣言の取得
+	const RenderGraph& GetGraph() const { return graph_; }
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+private:
+	/**----------------------------------------------------------------------------
+	 * \brief  MakeTransitionBarrier 遷移バリアを実体のリソースで作る
+	 */
+	ResourceBarrierDesc MakeTransitionBarrier(const RenderGraph::TransitionBarrier& transition) const;
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// デバイス
+	ID3D12Device* device_ = nullptr;
+
+	//========================================
+	// 宣言とコンパイル結果
+	RenderGraph graph_;
+	RenderGraph::CompiledGraph compiled_;
+	// パスからコンパイル結果の位置を引く(除外されたパスはkInvalidHandle)
+	std::vector<uint32_t> compiledPassIndices_;
+
+	//========================================
+	// リソースの実体(ハンドル順)
+	std::vector<ID3D12Resource*> resources_;
+
+	//========================================
+	// 一時テクスチャ
+	struct TransientTexture {
+		ResourceHandle handle;
+		D3D12_RESOURCE_DESC desc;
+		bool hasClearValue;
+		D3D12_CLEAR_VALUE clearValue;
+		Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+	};
+	std::vector<TransientTexture> transientTextures_;
+	// 一時テクスチャを置く共有ヒープ
+	Microsoft::WRL::ComPtr<ID3D12Heap> transientHeap_;
+};
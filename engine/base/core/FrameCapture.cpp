@@ -0,0 +1,55 @@
+/*********************************************************************
+ * \file   FrameCapture.cpp
+ * \brief  1フレーム分の描画コマンドの取り込み(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "FrameCapture.h"
+
+///=============================================================================
+///						フレームの開始
+void FrameCapture::BeginFrame() {
+	if(!isRequested_) {
+		return;
+	}
+	isRequested_ = false;
+	streams_.clear();
+	isCapturing_ = true;
+}
+
+///=============================================================================
+///						記録先の取得
+std::vector<RenderCommand>* FrameCapture::GetStream(const void* commandList) {
+	if(!isCapturing_) {
+		return nullptr;
+	}
+	std::lock_guard<std::mutex> lock(mutex_);
+	std::unique_ptr<std::vector<RenderCommand>>& stream = streams_[commandList];
+	if(!stream) {
+		stream = std::make_unique<std::vector<RenderCommand>>();
+	}
+	return stream.get();
+}
+
+///=============================================================================
+///						フレームの終了
+void FrameCapture::EndFrame(const std::vector<const void*>& executionOrder) {
+	if(!isCapturing_) {
+		return;
+	}
+	isCapturing_ = false;
+
+	//GPUが実行する順に並べ直す(記録のなかったコマンドリストは飛ばす)
+	lastCapture_.clear();
+	for(const void* commandList : executionOrder) {
+		auto it = streams_.find(commandList);
+		if(it == streams_.end()) {
+			continue;
+		}
+		lastCapture_.insert(lastCapture_.end(), it->second->begin(), it->second->end());
+	}
+	streams_.clear();
+	++captureCount_;
+}
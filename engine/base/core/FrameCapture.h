@@ -0,0 +1,75 @@
+/*********************************************************************
+ * \file   FrameCapture.h
+ * \brief  1フレーム分の描画コマンドの取り込み(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   要求された次のフレームだけ、コマンドリストごとに記録先を用意する。
+ *         パスは別スレッドで記録されるので、記録先の払い出しだけ排他する。
+ *         フレームの終わりに実行順に連結して1本のコマンド列にする
+ *********************************************************************/
+#pragma once
+#include "RenderCommand.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+///=============================================================================
+///						フレームキャプチャ
+class FrameCapture {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/// \brief 次のフレームの取り込みを要求
+	void Request() { isRequested_ = true; }
+
+	/// \brief フレームの開始(要求があれば取り込みを始める)
+	void BeginFrame();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetStream コマンドリストの記録先の取得
+	 * \param  commandList コマンドリストの識別子(D3D12のコマンドリストのポインタ)
+	 * \return 取り込み中でなければnullptr
+	 * \note   どのスレッドから呼んでもよい
+	 */
+	std::vector<RenderCommand>* GetStream(const void* commandList);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  EndFrame フレームの終了(取り込んだ記録を実行順に連結する)
+	 * \param  executionOrder 実行したコマンドリストの並び
+	 */
+	void EndFrame(const std::vector<const void*>& executionOrder);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 取り込み中か
+	bool IsCapturing() const { return isCapturing_; }
+
+	/// \brief 最後に取り込んだフレームのコマンド列
+	const std::vector<RenderCommand>& GetLastCapture() const { return lastCapture_; }
+
+	/// \brief これまでに取り込んだフレーム数(新しい取り込みの検出用)
+	uint64_t GetCaptureCount() const { return captureCount_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 状態
+	bool isRequested_ = false;
+	std::atomic<bool> isCapturing_ = false;
+
+	//========================================
+	// コマンドリストごとの記録先(要素のアドレスが動かないように個別に確保)
+	std::mutex mutex_;
+	std::unordered_map<const void*, std::unique_ptr<std::vector<RenderCommand>>> streams_;
+
+	//========================================
+	// 結果
+	std::vector<RenderCommand> lastCapture_;
+	uint64_t captureCount_ = 0;
+};
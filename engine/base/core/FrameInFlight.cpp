@@ -0,0 +1,39 @@
+/*********************************************************************
+ * \file   FrameInFlight.cpp
+ * \brief  複数フレーム同時進行(Frames in flight)のフェンス管理(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "FrameInFlight.h"
+#include <cassert>
+
+///=============================================================================
+///						初期化
+void FrameInFlight::Initialize(uint32_t frameCount) {
+	assert(frameCount >= 1 && frameCount <= kMaxFrameCount);
+	frameCount_ = frameCount;
+	frameIndex_ = 0;
+	lastFenceValue_ = 0;
+	frameFenceValues_.fill(0);
+}
+
+///=============================================================================
+///						現在のフレームを提出
+uint64_t FrameInFlight::Submit() {
+	//========================================
+	// スロットに提出時のフェンス値を記録
+	uint64_t fenceValue = IssueFenceValue();
+	frameFenceValues_[frameIndex_] = fenceValue;
+	return fenceValue;
+}
+
+///=============================================================================
+///						次のフレームスロットへ
+uint64_t FrameInFlight::Advance() {
+	frameIndex_ = ( frameIndex_ + 1 ) % frameCount_;
+	//========================================
+	// frameCount_フレーム前にこのスロットで提出した処理の完了を待つ
+	return frameFenceValues_[frameIndex_];
+}
@@ -0,0 +1,92 @@
+/*********************************************************************
+ * \file   FrameInFlight.h
+ * \brief  複数フレーム同時進行(Frames in flight)のフェンス管理(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   GPUの完了フェンス値を外から与えるだけで動くので、
+ *         実機なしでGPUタイムラインを模擬して検証できる
+ *********************************************************************/
+#pragma once
+#include <array>
+#include <cstdint>
+
+class FrameInFlight {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  frameCount 同時に進行させるフレーム数(1～kMaxFrameCount)
+	 */
+	void Initialize(uint32_t frameCount);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  IssueFenceValue 新しいフェンス値を発行
+	 * \return キューにシグナルするフェンス値
+	 * \note   フレーム以外の待機(GPUの完全同期など)にも使う
+	 */
+	uint64_t IssueFenceValue() { return ++lastFenceValue_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Submit 現在のフレームを提出
+	 * \return キューにシグナルするフェンス値
+	 */
+	uint64_t Submit();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Advance 次のフレームスロットへ進める
+	 * \return スロットを再利用する前に完了を待つべきフェンス値(0なら待機不要)
+	 */
+	uint64_t Advance();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  IsFrameReusable 現在のスロットが再利用可能か
+	 * \param  completedFenceValue GPUが完了したフェンス値
+	 */
+	bool IsFrameReusable(uint64_t completedFenceValue) const {
+		return completedFenceValue >= frameFenceValues_[frameIndex_];
+	}
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFrameIndex 現在のフレームスロット番号の取得
+	 */
+	uint32_t GetFrameIndex() const { return frameIndex_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFrameCount 同時進行フレーム数の取得
+	 */
+	uint32_t GetFrameCount() const { return frameCount_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetLastFenceValue 最後に発行したフェンス値の取得
+	 */
+	uint64_t GetLastFenceValue() const { return lastFenceValue_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetFrameFenceValue スロットが最後に提出されたフェンス値の取得
+	 * \param  frameIndex スロット番号
+	 */
+	uint64_t GetFrameFenceValue(uint32_t frameIndex) const { return frameFenceValues_[frameIndex]; }
+
+	//========================================
+	// 同時進行フレーム数の上限
+	static constexpr uint32_t kMaxFrameCount = 3;
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 同時進行フレーム数
+	uint32_t frameCount_ = 1;
+	// 現在のフレームスロット
+	uint32_t frameIndex_ = 0;
+	//========================================
+	// 最後に発行したフェンス値
+	uint64_t lastFenceValue_ = 0;
+	// スロットごとの提出フェンス値
+	std::array<uint64_t, kMaxFrameCount> frameFenceValues_{};
+};
@@ -0,0 +1,138 @@
+/*********************************************************************
+ * \file   FramePacer.cpp
+ * \brief  フレームレートの制限と計測(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "FramePacer.h"
+#include <algorithm>
+#include <thread>
+
+///=============================================================================
+///						steady_clockによる時計
+FrameClock::Duration SteadyFrameClock::Now() {
+	return std::chrono::duration_cast<Duration>( std::chrono::steady_clock::now().time_since_epoch() );
+}
+
+void SteadyFrameClock::Sleep(Duration duration) {
+	std::this_thread::sleep_for(duration);
+}
+
+void SteadyFrameClock::Spin() {
+	std::this_thread::yield();
+}
+
+///=============================================================================
+///						初期化
+void FramePacer::Initialize(FrameClock* clock, uint32_t targetFrameRate) {
+	clock_ = clock ? clock : &steadyClock_;
+	lastFrameTime_ = clock_->Now();
+	deltaTime_ = 0.0f;
+	ResetStats();
+	SetTargetFrameRate(targetFrameRate);
+}
+
+///=============================================================================
+///						目標フレームレートの設定
+void FramePacer::SetTargetFrameRate(uint32_t targetFrameRate) {
+	targetFrameRate_ = targetFrameRate;
+	framePeriod_ = targetFrameRate == kUncapped ? Duration::zero() : Duration(std::chrono::seconds(1)) / targetFrameRate;
+	//締め切りは直前のフレームから数え直す
+	nextDeadline_ = lastFrameTime_ + framePeriod_;
+}
+
+///=============================================================================
+///						待ってからフレームを区切る
+void FramePacer::WaitForNextFrame() {
+	if(framePeriod_ == Duration::zero()) {
+		MarkFrame();
+		return;
+	}
+	Duration now = clock_->Now();
+	//========================================
+	// 1フレーム以上遅れていたら締め切りを今に合わせる(取り戻そうと連続で走らせない)
+	if(now - nextDeadline_ > framePeriod_) {
+		nextDeadline_ = now;
+	}
+
+	//========================================
+	// 締め切りの手前まではスリープ
+	// 寝過ごし量を見込んで早めに起き、実際の寝過ごし量で見込みを直す
+	while(nextDeadline_ - now > spinMargin_ + sleepError_) {
+		Duration request = nextDeadline_ - now - spinMargin_ - sleepError_;
+		clock_->Sleep(request);
+		Duration woke = clock_->Now();
+		Duration oversleep = ( std::max )( woke - now - request, Duration::zero() );
+		//寝過ごしが増えたらすぐ追従し、減ったらゆっくり戻す
+		if(oversleep > sleepError_) {
+			sleepError_ = oversleep;
+		} else {
+			sleepError_ += ( oversleep - sleepError_ ) / 16;
+		}
+		sleepError_ = ( std::min )( sleepError_, framePeriod_ );
+		now = woke;
+	}
+
+	//========================================
+	// 残りはスピンで詰める
+	while(now < nextDeadline_) {
+		clock_->Spin();
+		now = clock_->Now();
+	}
+
+	//========================================
+	// 次の締め切りは今回の締め切りから数える(起床のずれを積み重ねない)
+	nextDeadline_ += framePeriod_;
+	RecordFrame(now);
+}
+
+///=============================================================================
+///						待たずにフレームを区切る
+void FramePacer::MarkFrame() {
+	Duration now = clock_->Now();
+	nextDeadline_ = now + framePeriod_;
+	RecordFrame(now);
+}
+
+///=============================================================================
+///						統計のリセット
+void FramePacer::ResetStats() {
+	stats_ = FrameStats{};
+	frameSamples_.fill(0.0f);
+	sampleIndex_ = 0;
+	sampleCount_ = 0;
+}
+
+///=============================================================================
+///						フレーム時間の記録
+void FramePacer::RecordFrame(Duration now) {
+	float frameSeconds = std::chrono::duration<float>( now - lastFrameTime_ ).count();
+	lastFrameTime_ = now;
+	deltaTime_ = ( std::min )( frameSeconds, kMaxDeltaTime );
+
+	//========================================
+	// 直近のフレーム時間をリングに貯める
+	float frameMs = frameSeconds * 1000.0f;
+	frameSamples_[sampleIndex_] = frameMs;
+	sampleIndex_ = ( sampleIndex_ + 1 ) % kStatsSampleCount;
+	sampleCount_ = ( std::min )( sampleCount_ + 1, kStatsSampleCount );
+
+	//========================================
+	// 統計の更新
+	float sum = 0.0f;
+	float minMs = frameMs;
+	float maxMs = frameMs;
+	for(uint32_t i = 0; i < sampleCount_; ++i) {
+		sum += frameSamples_[i];
+		minMs = ( std::min )( minMs, frameSamples_[i] );
+		maxMs = ( std::max )( maxMs, frameSamples_[i] );
+	}
+	stats_.lastFrameMs = frameMs;
+	stats_.averageFrameMs = sum / static_cast<float>( sampleCount_ );
+	stats_.minFrameMs = minMs;
+	stats_.maxFrameMs = maxMs;
+	stats_.averageFps = stats_.averageFrameMs > 0.0f ? 1000.0f / stats_.averageFrameMs : 0.0f;
+	++stats_.frameCount;
+}
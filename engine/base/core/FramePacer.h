@@ -0,0 +1,168 @@
+/*********************************************************************
+ * \file   FramePacer.h
+ * \brief  フレームレートの制限と計測(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   締め切りの少し手前まではOSのスリープで待ち、残りを短いスピンで詰める。
+ *         スリープの寝過ごし量を毎回計測して次のスリープを短くする。
+ *         時計は差し替えられるので、偽の時計で実機なしに挙動を確かめられる
+ *********************************************************************/
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+///=============================================================================
+///						時計
+class FrameClock {
+	///--------------------------------------------------------------
+	///							型定義
+public:
+	using Duration = std::chrono::nanoseconds;
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	virtual ~FrameClock() = default;
+
+	/// \brief 現在時刻(単調増加)
+	virtual Duration Now() = 0;
+
+	/// \brief 指定時間スリープ(寝過ごしてよい)
+	virtual void Sleep(Duration duration) = 0;
+
+	/// \brief スピン待ちの1回分(他スレッドに譲る程度)
+	virtual void Spin() {}
+};
+
+///=============================================================================
+///						steady_clockによる時計
+class SteadyFrameClock : public FrameClock {
+public:
+	Duration Now() override;
+	void Sleep(Duration duration) override;
+	void Spin() override;
+};
+
+///=============================================================================
+///						フレームペーサー
+class FramePacer {
+	///--------------------------------------------------------------
+	///							型定義
+public:
+	using Duration = FrameClock::Duration;
+
+	//========================================
+	// フレーム時間の統計(直近kStatsSampleCountフレーム)
+	struct FrameStats {
+		float lastFrameMs = 0.0f;		// 直前のフレーム時間
+		float averageFrameMs = 0.0f;	// 平均フレーム時間
+		float minFrameMs = 0.0f;		// 最短フレーム時間
+		float maxFrameMs = 0.0f;		// 最長フレーム時間
+		float averageFps = 0.0f;		// 平均FPS
+		uint64_t frameCount = 0;		// 計測したフレーム数(累計)
+	};
+
+	//========================================
+	// よく使う目標フレームレート
+	static constexpr uint32_t kUncapped = 0;
+	static constexpr uint32_t k60Fps = 60;
+	static constexpr uint32_t k120Fps = 120;
+	static constexpr uint32_t k144Fps = 144;
+
+	//========================================
+	// 統計を取るフレーム数
+	static constexpr uint32_t kStatsSampleCount = 120;
+	// デルタタイムの上限(ブレークポイントやウィンドウ移動で止まったときの暴走防止)
+	static constexpr float kMaxDeltaTime = 0.1f;
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  clock 時計(nullptrならsteady_clock)。寿命は呼び出し側が持つ
+	 * \param  targetFrameRate 目標フレームレート(kUncappedで制限なし)
+	 */
+	void Initialize(FrameClock* clock = nullptr, uint32_t targetFrameRate = k60Fps);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  WaitForNextFrame 目標フレームレートに合わせて待ってからフレームを区切る
+	 * \note   1フレームに1回、提出の直前に呼ぶ
+	 */
+	void WaitForNextFrame();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  MarkFrame 待たずにフレームを区切る
+	 * \note   VSyncなどほかの仕組みで制限しているときに計測だけ行う
+	 */
+	void MarkFrame();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  ResetStats 統計のリセット
+	 */
+	void ResetStats();
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 目標フレームレートの設定(kUncappedで制限なし)
+	void SetTargetFrameRate(uint32_t targetFrameRate);
+
+	/// \brief 目標フレームレートの取得
+	uint32_t GetTargetFrameRate() const { return targetFrameRate_; }
+
+	/// \brief 直前のフレームのデルタタイム(秒、kMaxDeltaTimeで頭打ち)
+	float GetDeltaTime() const { return deltaTime_; }
+
+	/// \brief フレーム時間の統計の取得
+	const FrameStats& GetStats() const { return stats_; }
+
+	/// \brief 推定しているスリープの寝過ごし量
+	Duration GetSleepErrorEstimate() const { return sleepError_; }
+
+	/// \brief スピン待ちに残す時間の設定
+	void SetSpinMargin(Duration spinMargin) { spinMargin_ = spinMargin; }
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+private:
+	/**----------------------------------------------------------------------------
+	 * \brief  RecordFrame フレーム時間を記録してデルタタイムと統計を更新
+	 */
+	void RecordFrame(Duration now);
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 時計
+	SteadyFrameClock steadyClock_;
+	FrameClock* clock_ = nullptr;
+
+	//========================================
+	// 目標
+	uint32_t targetFrameRate_ = k60Fps;
+	// 1フレームの時間(0なら制限なし)
+	Duration framePeriod_{};
+	// 次のフレームの締め切り
+	Duration nextDeadline_{};
+	// 直前にフレームを区切った時刻
+	Duration lastFrameTime_{};
+
+	//========================================
+	// 待ち方
+	// スピン待ちに残す時間
+	Duration spinMargin_ = std::chrono::microseconds(200);
+	// 計測したスリープの寝過ごし量(次のスリープをこの分だけ短くする)
+	Duration sleepError_ = std::chrono::milliseconds(1);
+
+	//========================================
+	// 計測
+	float deltaTime_ = 0.0f;
+	FrameStats stats_;
+	std::array<float, kStatsSampleCount> frameSamples_{};
+	uint32_t sampleIndex_ = 0;
+	uint32_t sampleCount_ = 0;
+};
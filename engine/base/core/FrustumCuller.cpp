@@ -0,0 +1,191 @@
+/*********************************************************************
+ * \file   FrustumCuller.cpp
+ * \brief  視錐台カリング(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "FrustumCuller.h"
+#include "MathSimd.h"
+#include <cmath>
+
+namespace {
+	/// \brief 行列の列(行ベクトル形式なのでクリップ座標の各成分に対応する)
+	Vector4 Column(const Matrix4x4& matrix, int column) {
+		return { matrix.m[0][column], matrix.m[1][column], matrix.m[2][column], matrix.m[3][column] };
+	}
+
+	Vector4 Add(const Vector4& a, const Vector4& b) {
+		return { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w };
+	}
+
+	Vector4 Sub(const Vector4& a, const Vector4& b) {
+		return { a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w };
+	}
+}
+
+///=============================================================================
+///						ビュープロジェクション行列から視錐台を作る
+Frustum Frustum::FromViewProjection(const Matrix4x4& viewProjection) {
+	//クリップ座標が -w <= x <= w, -w <= y <= w, 0 <= z <= w を満たす範囲
+	Vector4 x = Column(viewProjection, 0);
+	Vector4 y = Column(viewProjection, 1);
+	Vector4 z = Column(viewProjection, 2);
+	Vector4 w = Column(viewProjection, 3);
+	Frustum frustum;
+	frustum.planes[kLeft] = Add(w, x);
+	frustum.planes[kRight] = Sub(w, x);
+	frustum.planes[kBottom] = Add(w, y);
+	frustum.planes[kTop] = Sub(w, y);
+	frustum.planes[kNear] = z;
+	frustum.planes[kFar] = Sub(w, z);
+	return frustum;
+}
+
+///=============================================================================
+///						AABBとの判定
+bool Frustum::Intersects(const AABB& aabb) const {
+	Vector3 center = GetCenter(aabb);
+	Vector3 extent = GetExtent(aabb);
+	for(const Vector4& plane : planes) {
+		//中心の距離が、法線方向へのAABBの厚みの半分より外なら完全に外側
+		float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+		float radius = std::fabs(plane.x) * extent.x + std::fabs(plane.y) * extent.y + std::fabs(plane.z) * extent.z;
+		if(distance + radius < 0.0f) {
+			return false;
+		}
+	}
+	return true;
+}
+
+///=============================================================================
+///						空にする
+void FrustumCuller::Clear() {
+	centerX_.clear();
+	centerY_.clear();
+	centerZ_.clear();
+	extentX_.clear();
+	extentY_.clear();
+	extentZ_.clear();
+	count_ = 0;
+	visibleIndices_.clear();
+}
+
+///=============================================================================
+///						容量の確保
+void FrustumCuller::Reserve(size_t count) {
+	//詰め物の分も確保しておく
+	size_t padded = ( count + 3 ) & ~size_t(3);
+	centerX_.reserve(padded);
+	centerY_.reserve(padded);
+	centerZ_.reserve(padded);
+	extentX_.reserve(padded);
+	extentY_.reserve(padded);
+	extentZ_.reserve(padded);
+	visibleIndices_.reserve(count);
+}
+
+///=============================================================================
+///						AABBの追加
+void FrustumCuller::Push(const AABB& worldBounds) {
+	Vector3 center = GetCenter(worldBounds);
+	Vector3 extent = GetExtent(worldBounds);
+	centerX_.push_back(center.x);
+	centerY_.push_back(center.y);
+	centerZ_.push_back(center.z);
+	extentX_.push_back(extent.x);
+	extentY_.push_back(extent.y);
+	extentZ_.push_back(extent.z);
+	++count_;
+}
+
+///=============================================================================
+///						カリング
+void FrustumCuller::Cull(const Frustum& frustum) {
+	visibleIndices_.clear();
+	if(count_ == 0) {
+		return;
+	}
+	//========================================
+	// 4つずつ読めるよう詰め物をする(結果には含めない)
+	size_t padded = ( count_ + 3 ) & ~size_t(3);
+	centerX_.resize(padded, 0.0f);
+	centerY_.resize(padded, 0.0f);
+	centerZ_.resize(padded, 0.0f);
+	extentX_.resize(padded, 0.0f);
+	extentY_.resize(padded, 0.0f);
+	extentZ_.resize(padded, 0.0f);
+
+#ifdef MATH_SIMD_SSE
+	//========================================
+	// 平面の成分を4レーンに広げておく
+	__m128 planeX[Frustum::kPlaneCount];
+	__m128 planeY[Frustum::kPlaneCount];
+	__m128 planeZ[Frustum::kPlaneCount];
+	__m128 planeW[Frustum::kPlaneCount];
+	__m128 absX[Frustum::kPlaneCount];
+	__m128 absY[Frustum::kPlaneCount];
+	__m128 absZ[Frustum::kPlaneCount];
+	for(uint32_t p = 0; p < Frustum::kPlaneCount; ++p) {
+		const Vector4& plane = frustum.planes[p];
+		planeX[p] = _mm_set1_ps(plane.x);
+		planeY[p] = _mm_set1_ps(plane.y);
+		planeZ[p] = _mm_set1_ps(plane.z);
+		planeW[p] = _mm_set1_ps(plane.w);
+		absX[p] = _mm_set1_ps(std::fabs(plane.x));
+		absY[p] = _mm_set1_ps(std::fabs(plane.y));
+		absZ[p] = _mm_set1_ps(std::fabs(plane.z));
+	}
+	const __m128 zero = _mm_setzero_ps();
+
+	//========================================
+	// 4つのAABBを6平面と比べ、どれかの平面の外側ならそのレーンを落とす
+	for(size_t i = 0; i < padded; i += 4) {
+		__m128 centerX = _mm_loadu_ps(&centerX_[i]);
+		__m128 centerY = _mm_loadu_ps(&centerY_[i]);
+		__m128 centerZ = _mm_loadu_ps(&centerZ_[i]);
+		__m128 extentX = _mm_loadu_ps(&extentX_[i]);
+		__m128 extentY = _mm_loadu_ps(&extentY_[i]);
+		__m128 extentZ = _mm_loadu_ps(&extentZ_[i]);
+		__m128 outside = zero;
+		for(uint32_t p = 0; p < Frustum::kPlaneCount; ++p) {
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(planeX[p], centerX), _mm_mul_ps(planeY[p], centerY)),
+				_mm_add_ps(_mm_mul_ps(planeZ[p], centerZ), planeW[p]));
+			__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absX[p], extentX), _mm_mul_ps(absY[p], extentY)), _mm_mul_ps(absZ[p], extentZ));
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+		}
+		int outsideMask = _mm_movemask_ps(outside);
+		if(outsideMask == 0xF) {
+			continue;
+		}
+		for(int lane = 0; lane < 4; ++lane) {
+			size_t index = i + lane;
+			if(!( outsideMask & ( 1 << lane ) ) && index < count_) {
+				visibleIndices_.push_back(static_cast<uint32_t>( index ));
+			}
+		}
+	}
+#else
+	//========================================
+	// SSEがない環境では1つずつ判定する
+	for(size_t i = 0; i < count_; ++i) {
+		AABB aabb = {
+			{ centerX_[i] - extentX_[i], centerY_[i] - extentY_[i], centerZ_[i] - extentZ_[i] },
+			{ centerX_[i] + extentX_[i], centerY_[i] + extentY_[i], centerZ_[i] + extentZ_[i] },
+		};
+		if(frustum.Intersects(aabb)) {
+			visibleIndices_.push_back(static_cast<uint32_t>( i ));
+		}
+	}
+#endif
+
+	//========================================
+	// 詰め物を外す(続けてPushできるように)
+	centerX_.resize(count_);
+	centerY_.resize(count_);
+	centerZ_.resize(count_);
+	extentX_.resize(count_);
+	extentY_.resize(count_);
+	extentZ_.resize(count_);
+}
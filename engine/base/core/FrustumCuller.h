@@ -0,0 +1,101 @@
+/*********************************************************************
+ * \file   FrustumCuller.h
+ * \brief  視錐台カリング(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   ビュープロジェクション行列から6平面を取り出し、ワールド空間のAABBを
+ *         SoA(成分ごとの配列)に並べて4つずつSSEで平面と比較する
+ *********************************************************************/
+#pragma once
+#include "BoundingVolume.h"
+#include "Matrix4x4.h"
+#include "Vector4.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///=============================================================================
+///						視錐台
+struct Frustum {
+	//========================================
+	// 平面の番号
+	enum Plane : uint32_t {
+		kLeft,
+		kRight,
+		kBottom,
+		kTop,
+		kNear,
+		kFar,
+		kPlaneCount,
+	};
+
+	// 平面(x, y, z: 内向きの法線  w: 距離)。ax + by + cz + d >= 0 が内側
+	// NOTE:AABBとの判定は両辺に同じ長さが掛かるだけなので正規化しない
+	Vector4 planes[kPlaneCount];
+
+	/**----------------------------------------------------------------------------
+	 * \brief  FromViewProjection ビュープロジェクション行列から視錐台を作る
+	 * \param  viewProjection 行ベクトル(v * M)のビュープロジェクション行列
+	 * \return 視錐台(ワールド空間)
+	 * \note   D3Dの深度(0～1)を前提にする
+	 */
+	static Frustum FromViewProjection(const Matrix4x4& viewProjection);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Intersects AABBが視錐台に掛かるか(1つずつ判定する版)
+	 * \param  aabb ワールド空間のAABB
+	 * \return いずれかの平面の完全に外側ならfalse
+	 * \note   角付近は外でもtrueになることがある(描画は壊れない)
+	 */
+	bool Intersects(const AABB& aabb) const;
+};
+
+///=============================================================================
+///						まとめて判定するカリング
+class FrustumCuller {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/// \brief 空にする(確保したメモリは残す)
+	void Clear();
+
+	/// \brief 容量の確保
+	void Reserve(size_t count);
+
+	/// \brief ワールド空間のAABBの追加(添え字は追加順)
+	void Push(const AABB& worldBounds);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Cull 視錐台に掛かるものを残す
+	 * \param  frustum 視錐台
+	 * \note   結果はGetVisibleIndicesで取る(添え字の昇順)
+	 */
+	void Cull(const Frustum& frustum);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 見えている添え字の取得(Cullの後)
+	const std::vector<uint32_t>& GetVisibleIndices() const { return visibleIndices_; }
+
+	/// \brief 追加した数の取得
+	size_t GetSize() const { return count_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// AABBの中心と半分の大きさ(SoA。4の倍数まで詰め物をする)
+	std::vector<float> centerX_;
+	std::vector<float> centerY_;
+	std::vector<float> centerZ_;
+	std::vector<float> extentX_;
+	std::vector<float> extentY_;
+	std::vector<float> extentZ_;
+	// 追加した数
+	size_t count_ = 0;
+	//========================================
+	// 結果
+	std::vector<uint32_t> visibleIndices_;
+};
@@ -0,0 +1,381 @@
+/*********************************************************************
+ * \file   LightCluster.cpp
+ * \brief  点光源・スポットライトのクラスタへの割り当て(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "LightCluster.h"
+#include "MathSimd.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <future>
+
+namespace {
+	/// \brief 行列の列(行ベクトル形式なのでクリップ座標の各成分に対応する)
+	Vector4 Column(const Matrix4x4& matrix, int column) {
+		return { matrix.m[0][column], matrix.m[1][column], matrix.m[2][column], matrix.m[3][column] };
+	}
+
+	/// \brief クリップ座標の成分 - value * w = 0 の平面(法線を正規化する)
+	void MakeBoundaryPlane(const Vector4& axis, const Vector4& w, float value, float& a, float& b, float& c, float& d) {
+		a = axis.x - value * w.x;
+		b = axis.y - value * w.y;
+		c = axis.z - value * w.z;
+		d = axis.w - value * w.w;
+		float inverseLength = 1.0f / std::sqrt(a * a + b * b + c * c);
+		a *= inverseLength;
+		b *= inverseLength;
+		c *= inverseLength;
+		d *= inverseLength;
+	}
+}
+
+///=============================================================================
+///						ライトの割り当て
+void LightCluster::Build(std::span<const PunctualLight> lights, const Matrix4x4& view, const Matrix4x4& projection,
+	float nearClip, float farClip, uint32_t threadCount) {
+	assert(nearClip > 0.0f && farClip > nearClip);
+	//========================================
+	// 奥行きの区切り(ニアからファーまでを対数で等分する)
+	nearClip_ = nearClip;
+	farClip_ = farClip;
+	sliceScale_ = static_cast<float>( kCountZ ) / std::log(farClip / nearClip);
+	for(uint32_t k = 0; k <= kCountZ; ++k) {
+		sliceDepths_[k] = nearClip * std::pow(farClip / nearClip, static_cast<float>( k ) / kCountZ);
+	}
+	viewZ_ = Column(view, 2);
+
+	//========================================
+	// タイルの境界の平面(NDCを等分した値 u で clip.x - u * clip.w = 0)
+	Vector4 clipX = Column(projection, 0);
+	Vector4 clipY = Column(projection, 1);
+	Vector4 clipW = Column(projection, 3);
+	for(uint32_t k = 0; k <= kCountX; ++k) {
+		float u = -1.0f + 2.0f * static_cast<float>( k ) / kCountX;
+		MakeBoundaryPlane(clipX, clipW, u, columnA_[k], columnB_[k], columnC_[k], columnD_[k]);
+	}
+	for(uint32_t k = 0; k <= kCountY; ++k) {
+		float v = -1.0f + 2.0f * static_cast<float>( k ) / kCountY;
+		MakeBoundaryPlane(clipY, clipW, v, rowA_[k], rowB_[k], rowC_[k], rowD_[k]);
+	}
+
+	//========================================
+	// ライトを包む球をビュー空間に移してSoAに並べる
+	lightCount_ = static_cast<uint32_t>( lights.size() );
+	size_t paddedCount = ( lights.size() + 3 ) & ~size_t(3);
+	centerX_.assign(paddedCount, 0.0f);
+	centerY_.assign(paddedCount, 0.0f);
+	centerZ_.assign(paddedCount, 0.0f);
+	radius_.assign(paddedCount, 0.0f);
+	bounds_.resize(paddedCount);
+	for(size_t i = 0; i < lights.size(); ++i) {
+		Vector4 sphere = GetBoundingSphere(lights[i]);
+		centerX_[i] = sphere.x * view.m[0][0] + sphere.y * view.m[1][0] + sphere.z * view.m[2][0] + view.m[3][0];
+		centerY_[i] = sphere.x * view.m[0][1] + sphere.y * view.m[1][1] + sphere.z * view.m[2][1] + view.m[3][1];
+		centerZ_[i] = sphere.x * view.m[0][2] + sphere.y * view.m[1][2] + sphere.z * view.m[2][2] + view.m[3][2];
+		radius_[i] = sphere.w;
+	}
+	ComputeBounds(0, lights.size());
+
+	//========================================
+	// 奥行きの区切りごとに割り当てる(区切りどうしは書き込み先が重ならないので並列にできる)
+	ranges_.resize(kClusterCount);
+	size_t useThreadCount = lights.size() < kMinLightCountForThreads ? 1 : ( std::min )( static_cast<size_t>( ( std::max )( threadCount, 1u ) ), size_t(kCountZ) );
+	if(useThreadCount == 1) {
+		AssignSlices(0, kCountZ);
+	} else {
+		uint32_t chunk = static_cast<uint32_t>( ( kCountZ + useThreadCount - 1 ) / useThreadCount );
+		std::vector<std::future<void>> futures;
+		futures.reserve(useThreadCount - 1);
+		uint32_t zBegin = 0;
+		for(; zBegin + chunk < kCountZ; zBegin += chunk) {
+			futures.push_back(std::async(std::launch::async, &LightCluster::AssignSlices, this, zBegin, zBegin + chunk));
+		}
+		//最後の区間は呼び出したスレッドで処理する
+		AssignSlices(zBegin, kCountZ);
+		for(std::future<void>& future : futures) {
+			future.get();
+		}
+	}
+
+	//========================================
+	// 区切りごとの結果を1つの配列につなげる
+	size_t totalCount = 0;
+	for(uint32_t z = 0; z < kCountZ; ++z) {
+		totalCount += sliceIndices_[z].size();
+	}
+	lightIndices_.resize(totalCount);
+	maxLightsPerCluster_ = 0;
+	droppedCount_ = 0;
+	uint32_t sliceOffset = 0;
+	for(uint32_t z = 0; z < kCountZ; ++z) {
+		const std::vector<uint32_t>& indices = sliceIndices_[z];
+		if(!indices.empty()) {
+			std::memcpy(&lightIndices_[sliceOffset], indices.data(), sizeof(uint32_t) * indices.size());
+		}
+		Range* sliceRanges = &ranges_[GetClusterIndex(0, 0, z)];
+		for(uint32_t c = 0; c < kCountX * kCountY; ++c) {
+			sliceRanges[c].offset += sliceOffset;
+		}
+		sliceOffset += static_cast<uint32_t>( indices.size() );
+		maxLightsPerCluster_ = ( std::max )( maxLightsPerCluster_, sliceMaxLights_[z] );
+		droppedCount_ += sliceDropped_[z];
+	}
+}
+
+///=============================================================================
+///						1つのクラスタとの判定
+bool LightCluster::Intersects(const Vector3& viewCenter, float radius, uint32_t x, uint32_t y, uint32_t z) const {
+	assert(x < kCountX && y < kCountY && z < kCountZ);
+	//奥行きはBuildと同じ区切り方で比べる
+	float zMin = viewCenter.z - radius;
+	float zMax = viewCenter.z + radius;
+	if(zMax < nearClip_ || zMin > farClip_) {
+		return false;
+	}
+	uint32_t minZ = zMin <= nearClip_ ? 0 : ( std::min )( static_cast<uint32_t>( std::log(zMin / nearClip_) * sliceScale_ ), kCountZ - 1 );
+	uint32_t maxZ = zMax >= farClip_ ? kCountZ - 1 : ( std::min )( static_cast<uint32_t>( std::log(zMax / nearClip_) * sliceScale_ ), kCountZ - 1 );
+	if(z < minZ || z > maxZ) {
+		return false;
+	}
+	//列の左右の境界
+	auto distance = [&](const float* a, const float* b, const float* c, const float* d, uint32_t k) {
+		return a[k] * viewCenter.x + b[k] * viewCenter.y + c[k] * viewCenter.z + d[k];
+	};
+	if(distance(columnA_, columnB_, columnC_, columnD_, x) < -radius || distance(columnA_, columnB_, columnC_, columnD_, x + 1) > radius) {
+		return false;
+	}
+	//行の上下の境界(平面は画面の下から並べている)
+	uint32_t row = kCountY - 1 - y;
+	if(distance(rowA_, rowB_, rowC_, rowD_, row) < -radius || distance(rowA_, rowB_, rowC_, rowD_, row + 1) > radius) {
+		return false;
+	}
+	return true;
+}
+
+///=============================================================================
+///						シェーダーに渡す情報
+LightClusterForGpu LightCluster::MakeGpuParams(float screenWidth, float screenHeight) const {
+	LightClusterForGpu params;
+	params.viewZ = viewZ_;
+	params.countX = kCountX;
+	params.countY = kCountY;
+	params.countZ = kCountZ;
+	params.lightCount = lightCount_;
+	params.tileScaleX = static_cast<float>( kCountX ) / screenWidth;
+	params.tileScaleY = static_cast<float>( kCountY ) / screenHeight;
+	// floor(log(z / near) * scale) = floor(log(z) * scale - log(near) * scale)
+	params.sliceScale = sliceScale_;
+	params.sliceBias = -std::log(nearClip_) * sliceScale_;
+	return params;
+}
+
+///=============================================================================
+///						ライトを包む球
+Vector4 LightCluster::GetBoundingSphere(const PunctualLight& light) {
+	//========================================
+	// 60度より狭いスポットライトは、頂点と縁を通る球のほうが小さい
+	// NOTE:中心を軸上の radius / (2cosθ) に置くと、頂点と縁までの距離がどちらもその値になる
+	if(light.type == PunctualLightType::kSpot && light.cosAngle > 0.5f) {
+		float radius = light.radius / ( 2.0f * light.cosAngle );
+		Vector3 center = light.position + light.direction * radius;
+		return { center.x, center.y, center.z, radius };
+	}
+	return { light.position.x, light.position.y, light.position.z, light.radius };
+}
+
+///=============================================================================
+///						ライトが掛かる範囲
+void LightCluster::ComputeBounds(size_t begin, size_t end) {
+	size_t index = begin;
+#ifdef MATH_SIMD_SSE
+	//========================================
+	// 4つのライトを同時に、境界の平面の完全に右(上)・完全に左(下)にある数を数える
+	for(; index + 4 <= end; index += 4) {
+		__m128 x = _mm_loadu_ps(&centerX_[index]);
+		__m128 y = _mm_loadu_ps(&centerY_[index]);
+		__m128 z = _mm_loadu_ps(&centerZ_[index]);
+		__m128 radius = _mm_loadu_ps(&radius_[index]);
+		__m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+		auto count = [&](const float* a, const float* b, const float* c, const float* d, uint32_t planeCount, __m128i& positive, __m128i& negative) {
+			positive = _mm_setzero_si128();
+			negative = _mm_setzero_si128();
+			for(uint32_t k = 0; k < planeCount; ++k) {
+				__m128 distance = MathSimd::MultiplyAdd(x, _mm_set1_ps(a[k]),
+					MathSimd::MultiplyAdd(y, _mm_set1_ps(b[k]), MathSimd::MultiplyAdd(z, _mm_set1_ps(c[k]), _mm_set1_ps(d[k]))));
+				//比較結果は真で-1なので引くと数えられる
+				positive = _mm_sub_epi32(positive, _mm_castps_si128(_mm_cmpgt_ps(distance, radius)));
+				negative = _mm_sub_epi32(negative, _mm_castps_si128(_mm_cmplt_ps(distance, negativeRadius)));
+			}
+		};
+		__m128i rightX, leftX, rightY, leftY;
+		count(columnA_, columnB_, columnC_, columnD_, kCountX + 1, rightX, leftX);
+		count(rowA_, rowB_, rowC_, rowD_, kCountY + 1, rightY, leftY);
+		alignas(16) uint32_t counts[4][4];
+		_mm_store_si128(reinterpret_cast<__m128i*>( counts[0] ), rightX);
+		_mm_store_si128(reinterpret_cast<__m128i*>( counts[1] ), leftX);
+		_mm_store_si128(reinterpret_cast<__m128i*>( counts[2] ), rightY);
+		_mm_store_si128(reinterpret_cast<__m128i*>( counts[3] ), leftY);
+		for(size_t lane = 0; lane < 4; ++lane) {
+			FinishBounds(index + lane, counts[0][lane], counts[1][lane], counts[2][lane], counts[3][lane]);
+		}
+	}
+#endif
+	//========================================
+	// 端数
+	for(; index < end; ++index) {
+		ComputeBoundsOne(index);
+	}
+}
+
+///=============================================================================
+///						1つのライトの範囲
+void LightCluster::ComputeBoundsOne(size_t index) {
+	float x = centerX_[index];
+	float y = centerY_[index];
+	float z = centerZ_[index];
+	float radius = radius_[index];
+	uint32_t counts[4] = {};
+	for(uint32_t k = 0; k <= kCountX; ++k) {
+		float distance = columnA_[k] * x + columnB_[k] * y + columnC_[k] * z + columnD_[k];
+		counts[0] += distance > radius;
+		counts[1] += distance < -radius;
+	}
+	for(uint32_t k = 0; k <= kCountY; ++k) {
+		float distance = rowA_[k] * x + rowB_[k] * y + rowC_[k] * z + rowD_[k];
+		counts[2] += distance > radius;
+		counts[3] += distance < -radius;
+	}
+	FinishBounds(index, counts[0], counts[1], counts[2], counts[3]);
+}
+
+///=============================================================================
+///						比較の数から範囲を決める
+void LightCluster::FinishBounds(size_t index, uint32_t rightX, uint32_t leftX, uint32_t rightY, uint32_t leftY) {
+	Bounds& bounds = bounds_[index];
+	//見えないもの
+	bounds = { 0, 0, 0, 0, 1, 0 };
+	if(index >= lightCount_) {
+		return;
+	}
+	//========================================
+	// 奥行き
+	float zMin = centerZ_[index] - radius_[index];
+	float zMax = centerZ_[index] + radius_[index];
+	if(zMax < nearClip_ || zMin > farClip_) {
+		return;
+	}
+	uint32_t minZ = zMin <= nearClip_ ? 0 : ( std::min )( static_cast<uint32_t>( std::log(zMin / nearClip_) * sliceScale_ ), kCountZ - 1 );
+	uint32_t maxZ = zMax >= farClip_ ? kCountZ - 1 : ( std::min )( static_cast<uint32_t>( std::log(zMax / nearClip_) * sliceScale_ ), kCountZ - 1 );
+
+	//========================================
+	// カメラの後ろまで掛かる球は、境界の平面との比較が番号順に並ばないので列と行を1つずつ調べる
+	if(zMin <= 0.0f) {
+		float x = centerX_[index];
+		float y = centerY_[index];
+		float z = centerZ_[index];
+		float radius = radius_[index];
+		auto scan = [&](const float* a, const float* b, const float* c, const float* d, uint32_t count, uint32_t& first, uint32_t& last) {
+			first = count;
+			last = 0;
+			for(uint32_t k = 0; k < count; ++k) {
+				//左の境界の完全に左、右の境界の完全に右でなければ掛かる
+				if(a[k] * x + b[k] * y + c[k] * z + d[k] >= -radius && a[k + 1] * x + b[k + 1] * y + c[k + 1] * z + d[k + 1] <= radius) {
+					first = ( std::min )( first, k );
+					last = k;
+				}
+			}
+			return first < count;
+		};
+		uint32_t minX, maxX, minRow, maxRow;
+		if(!scan(columnA_, columnB_, columnC_, columnD_, kCountX, minX, maxX) || !scan(rowA_, rowB_, rowC_, rowD_, kCountY, minRow, maxRow)) {
+			return;
+		}
+		bounds = {
+			static_cast<uint8_t>( minX ), static_cast<uint8_t>( maxX ),
+			static_cast<uint8_t>( kCountY - 1 - maxRow ), static_cast<uint8_t>( kCountY - 1 - minRow ),
+			static_cast<uint8_t>( minZ ), static_cast<uint8_t>( maxZ ),
+		};
+		return;
+	}
+
+	//========================================
+	// カメラの前にある球では、完全に右にある境界は先頭から、完全に左にある境界は末尾から続く
+	// NOTE:すべての境界の右(左)なら視錐台の外
+	if(rightX == kCountX + 1 || leftX == kCountX + 1 || rightY == kCountY + 1 || leftY == kCountY + 1) {
+		return;
+	}
+	uint32_t minX = rightX > 0 ? rightX - 1 : 0;
+	uint32_t maxX = ( std::min )( kCountX - leftX, kCountX - 1 );
+	uint32_t minRow = rightY > 0 ? rightY - 1 : 0;
+	uint32_t maxRow = ( std::min )( kCountY - leftY, kCountY - 1 );
+	if(minX > maxX || minRow > maxRow) {
+		return;
+	}
+	//行は画面の上から数える
+	bounds = {
+		static_cast<uint8_t>( minX ), static_cast<uint8_t>( maxX ),
+		static_cast<uint8_t>( kCountY - 1 - maxRow ), static_cast<uint8_t>( kCountY - 1 - minRow ),
+		static_cast<uint8_t>( minZ ), static_cast<uint8_t>( maxZ ),
+	};
+}
+
+///=============================================================================
+///						奥行きの区切りへの割り当て
+void LightCluster::AssignSlices(uint32_t zBegin, uint32_t zEnd) {
+	constexpr uint32_t kTileCount = kCountX * kCountY;
+	for(uint32_t z = zBegin; z < zEnd; ++z) {
+		//========================================
+		// タイルごとの数を数える
+		uint32_t counts[kTileCount] = {};
+		for(uint32_t i = 0; i < lightCount_; ++i) {
+			const Bounds& bounds = bounds_[i];
+			if(z < bounds.minZ || z > bounds.maxZ) {
+				continue;
+			}
+			for(uint32_t y = bounds.minY; y <= bounds.maxY; ++y) {
+				for(uint32_t x = bounds.minX; x <= bounds.maxX; ++x) {
+					++counts[x + kCountX * y];
+				}
+			}
+		}
+
+		//========================================
+		// 区切りの中での並び(上限を超えた分は落とす)
+		Range* sliceRanges = &ranges_[GetClusterIndex(0, 0, z)];
+		uint32_t total = 0;
+		sliceMaxLights_[z] = 0;
+		sliceDropped_[z] = 0;
+		for(uint32_t tile = 0; tile < kTileCount; ++tile) {
+			uint32_t count = ( std::min )( counts[tile], kMaxLightsPerCluster );
+			sliceDropped_[z] += counts[tile] - count;
+			sliceMaxLights_[z] = ( std::max )( sliceMaxLights_[z], count );
+			sliceRanges[tile] = { total, count };
+			total += count;
+		}
+
+		//========================================
+		// ライトの番号を詰める
+		std::vector<uint32_t>& indices = sliceIndices_[z];
+		indices.resize(total);
+		uint32_t filled[kTileCount] = {};
+		for(uint32_t i = 0; i < lightCount_; ++i) {
+			const Bounds& bounds = bounds_[i];
+			if(z < bounds.minZ || z > bounds.maxZ) {
+				continue;
+			}
+			for(uint32_t y = bounds.minY; y <= bounds.maxY; ++y) {
+				for(uint32_t x = bounds.minX; x <= bounds.maxX; ++x) {
+					uint32_t tile = x + kCountX * y;
+					if(filled[tile] < sliceRanges[tile].count) {
+						indices[sliceRanges[tile].offset + filled[tile]++] = i;
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,180 @@
+/*********************************************************************
+ * \file   LightCluster.h
+ * \brief  点光源・スポットライトのクラスタへの割り当て(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   視錐台を画面のタイルと対数で区切った奥行きで分けたクラスタ(フロクセル)ごとに、
+ *         掛かるライトの番号を並べる。ピクセルシェーダーは自分のクラスタのライトだけを回す。
+ *         ライトを包む球とタイルの境界の平面を4つずつSSEで比較し、奥行きの区切りごとに並列で割り当てる
+ *********************************************************************/
+#pragma once
+#include "PunctualLight.h"
+#include "Matrix4x4.h"
+#include "Vector4.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+///=============================================================================
+///						シェーダーに渡すクラスタの情報
+struct LightClusterForGpu {
+	Vector4 viewZ;			// ワールド座標からビュー空間の奥行きを求める係数(ビュー行列の2列目)
+	uint32_t countX;
+	uint32_t countY;
+	uint32_t countZ;
+	uint32_t lightCount;
+	float tileScaleX;		// ピクセル座標からタイルの番号へ
+	float tileScaleY;
+	float sliceScale;		// 奥行きの対数から区切りの番号へ
+	float sliceBias;
+};
+
+///=============================================================================
+///						クラスタへの割り当て
+class LightCluster {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	//========================================
+	// クラスタの分け方
+	static constexpr uint32_t kCountX = 16;
+	static constexpr uint32_t kCountY = 9;
+	static constexpr uint32_t kCountZ = 24;
+	static constexpr uint32_t kClusterCount = kCountX * kCountY * kCountZ;
+	/// \brief 1つのクラスタに入れるライトの上限(超えた分は落として数える)
+	static constexpr uint32_t kMaxLightsPerCluster = 32;
+	/// \brief スレッドを増やす最小のライト数(これより少なければ呼び出したスレッドだけで行う)
+	static constexpr size_t kMinLightCountForThreads = 128;
+
+	/// \brief クラスタごとのライトの範囲(GetLightIndicesの [offset, offset + count))
+	struct Range {
+		uint32_t offset;
+		uint32_t count;
+	};
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Build ライトをクラスタに割り当てる
+	 * \param  lights ライト(ワールド空間)
+	 * \param  view ビュー行列
+	 * \param  projection 透視投影行列(行ベクトル形式。D3Dの深度)
+	 * \param  nearClip ニアクリップ
+	 * \param  farClip ファークリップ
+	 * \param  threadCount 使うスレッド数の上限(1なら呼び出したスレッドだけで行う)
+	 */
+	void Build(std::span<const PunctualLight> lights, const Matrix4x4& view, const Matrix4x4& projection,
+		float nearClip, float farClip, uint32_t threadCount = 1);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Intersects 球が1つのクラスタに掛かるか(1つずつ判定する版。検証用)
+	 * \param  viewCenter 球の中心(ビュー空間)
+	 * \param  radius 球の半径
+	 * \param  x タイルの列
+	 * \param  y タイルの行(画面の上から)
+	 * \param  z 奥行きの区切り
+	 * \note   Buildで作った平面を使う。Buildの割り当てはこの判定が真のものをすべて含む
+	 */
+	bool Intersects(const Vector3& viewCenter, float radius, uint32_t x, uint32_t y, uint32_t z) const;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  MakeGpuParams シェーダーに渡す情報を作る
+	 * \param  screenWidth 画面の幅(ピクセル)
+	 * \param  screenHeight 画面の高さ(ピクセル)
+	 */
+	LightClusterForGpu MakeGpuParams(float screenWidth, float screenHeight) const;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetBoundingSphere ライトが照らす範囲を包む球
+	 * \param  light ライト
+	 * \return xyz: 中心(ワールド空間)  w: 半径
+	 * \note   スポットライトは角度が60度より狭ければ円錐を包む小さい球にする
+	 */
+	static Vector4 GetBoundingSphere(const PunctualLight& light);
+
+	/// \brief クラスタの番号
+	static constexpr uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) {
+		return x + kCountX * ( y + kCountY * z );
+	}
+
+	///--------------------------------------------------------------
+	///							内部処理
+private:
+	/// \brief ライトが掛かるタイル・区切りの範囲を求める([begin, end)のライト)
+	void ComputeBounds(size_t begin, size_t end);
+
+	/// \brief 1つのライトの範囲を求める(端数・SIMDがない環境用)
+	void ComputeBoundsOne(size_t index);
+
+	/// \brief 平面との比較の数からライトの範囲を決める
+	void FinishBounds(size_t index, uint32_t rightX, uint32_t leftX, uint32_t rightY, uint32_t leftY);
+
+	/// \brief [zBegin, zEnd)の区切りにライトを割り当てる
+	void AssignSlices(uint32_t zBegin, uint32_t zEnd);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief クラスタごとのライトの範囲の取得(GetClusterIndexの順)
+	const std::vector<Range>& GetRanges() const { return ranges_; }
+
+	/// \brief クラスタごとに並べたライトの番号の取得
+	const std::vector<uint32_t>& GetLightIndices() const { return lightIndices_; }
+
+	/// \brief 割り当てたライトの数の取得
+	uint32_t GetLightCount() const { return lightCount_; }
+
+	/// \brief 1つのクラスタに入ったライトの最大数の取得
+	uint32_t GetMaxLightsPerCluster() const { return maxLightsPerCluster_; }
+
+	/// \brief 上限を超えて落とした割り当ての数の取得
+	uint32_t GetDroppedCount() const { return droppedCount_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// タイルの境界の平面(ビュー空間。ax + by + cz + d が正なら境界より列・行の番号が大きい側)
+	// NOTE:列は kCountX + 1 枚、行は画面の下から kCountY + 1 枚。法線は正規化する
+	float columnA_[kCountX + 1] = {};
+	float columnB_[kCountX + 1] = {};
+	float columnC_[kCountX + 1] = {};
+	float columnD_[kCountX + 1] = {};
+	float rowA_[kCountY + 1] = {};
+	float rowB_[kCountY + 1] = {};
+	float rowC_[kCountY + 1] = {};
+	float rowD_[kCountY + 1] = {};
+	//========================================
+	// 奥行きの区切り
+	float nearClip_ = 0.1f;
+	float farClip_ = 100.0f;
+	float sliceScale_ = 0.0f;	// kCountZ / log(far / near)
+	float sliceDepths_[kCountZ + 1] = {};
+	Vector4 viewZ_ = {};
+
+	//========================================
+	// ライトを包む球(ビュー空間。SoA。4の倍数まで詰め物をする)
+	std::vector<float> centerX_;
+	std::vector<float> centerY_;
+	std::vector<float> centerZ_;
+	std::vector<float> radius_;
+	// ライトが掛かる範囲(見えないものは minZ > maxZ)
+	struct Bounds {
+		uint8_t minX, maxX;
+		uint8_t minY, maxY;
+		uint8_t minZ, maxZ;
+	};
+	std::vector<Bounds> bounds_;
+	uint32_t lightCount_ = 0;
+
+	//========================================
+	// 結果
+	std::vector<Range> ranges_;
+	std::vector<uint32_t> lightIndices_;
+	// 区切りごとの作業領域(並列に書くので分けておく)
+	std::vector<uint32_t> sliceIndices_[kCountZ];
+	uint32_t sliceMaxLights_[kCountZ] = {};
+	uint32_t sliceDropped_[kCountZ] = {};
+	uint32_t maxLightsPerCluster_ = 0;
+	uint32_t droppedCount_ = 0;
+};
@@ -0,0 +1,48 @@
+/*********************************************************************
+ * \file   LinearUploadAllocator.cpp
+ * \brief  フレーム単位で使い捨てるアップロード領域の線形アロケータ(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "LinearUploadAllocator.h"
+#include <algorithm>
+#include <cassert>
+
+///=============================================================================
+///						領域の設定
+void LinearUploadAllocator::Reset(uint8_t* cpuBase, uint64_t gpuBase, size_t capacity) {
+	//========================================
+	// 前のフレームの使用量を記録してから巻き戻す
+	peakUsedSize_ = ( std::max )( peakUsedSize_, usedSize_.load() );
+	cpuBase_ = cpuBase;
+	gpuBase_ = gpuBase;
+	capacity_ = capacity;
+	usedSize_ = 0;
+}
+
+///=============================================================================
+///						領域の切り出し
+UploadAllocation LinearUploadAllocator::Allocate(size_t size, size_t alignment) {
+	assert(alignment != 0 && ( alignment & ( alignment - 1 ) ) == 0);
+	//========================================
+	// 他のスレッドと競合したらやり直す
+	size_t offset = usedSize_.load();
+	size_t alignedOffset = 0;
+	do {
+		alignedOffset = ( offset + alignment - 1 ) & ~( alignment - 1 );
+		if(alignedOffset + size > capacity_) {
+			++overflowCount_;
+			return {};
+		}
+	} while(!usedSize_.compare_exchange_weak(offset, alignedOffset + size));
+
+	//========================================
+	// 確保結果
+	UploadAllocation allocation{};
+	allocation.cpuAddress = cpuBase_ + alignedOffset;
+	allocation.gpuAddress = gpuBase_ + alignedOffset;
+	allocation.size = size;
+	return allocation;
+}
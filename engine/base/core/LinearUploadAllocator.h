@@ -0,0 +1,80 @@
+/*********************************************************************
+ * \file   LinearUploadAllocator.h
+ * \brief  フレーム単位で使い捨てるアップロード領域の線形アロケータ(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   先頭から詰めて切り出し、フレームの頭でまとめて巻き戻す。
+ *         描画パスが並列に記録されるので確保はロックフリーで行う
+ *********************************************************************/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///=============================================================================
+///						確保結果
+struct UploadAllocation {
+	void* cpuAddress = nullptr;		// 書き込み先
+	uint64_t gpuAddress = 0;		// GPUから見たアドレス(D3D12_GPU_VIRTUAL_ADDRESS)
+	size_t size = 0;				// 確保したサイズ
+};
+
+///=============================================================================
+///						線形アップロードアロケータ
+class LinearUploadAllocator {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Reset 領域を設定して先頭から使い直す
+	 * \param  cpuBase 書き込み先の先頭
+	 * \param  gpuBase GPUから見た先頭アドレス
+	 * \param  capacity 領域のサイズ
+	 * \note   フレームの頭(その領域をGPUが使い終えた後)で呼ぶ
+	 */
+	void Reset(uint8_t* cpuBase, uint64_t gpuBase, size_t capacity);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Allocate 領域の切り出し
+	 * \param  size サイズ
+	 * \param  alignment アライメント(2のべき乗)
+	 * \return 確保結果 足りなければcpuAddressがnullptr
+	 * \note   複数スレッドから同時に呼んでよい
+	 */
+	UploadAllocation Allocate(size_t size, size_t alignment = kConstantBufferAlignment);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 使用済みサイズの取得
+	size_t GetUsedSize() const { return usedSize_.load(); }
+
+	/// \brief 1フレームでの使用サイズの最大値の取得
+	size_t GetPeakUsedSize() const { return peakUsedSize_; }
+
+	/// \brief 領域のサイズの取得
+	size_t GetCapacity() const { return capacity_; }
+
+	/// \brief 容量不足で確保に失敗した回数の取得
+	uint32_t GetOverflowCount() const { return overflowCount_.load(); }
+
+	//========================================
+	// 定数バッファのアライメント(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT)
+	static constexpr size_t kConstantBufferAlignment = 256;
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 領域
+	uint8_t* cpuBase_ = nullptr;
+	uint64_t gpuBase_ = 0;
+	size_t capacity_ = 0;
+
+	//========================================
+	// 使用状況
+	std::atomic<size_t> usedSize_ = 0;
+	size_t peakUsedSize_ = 0;
+	std::atomic<uint32_t> overflowCount_ = 0;
+};
@@ -0,0 +1,140 @@
+/*********************************************************************
+ * \file   NullCommandList.cpp
+ * \brief  GPUを使わない描画コマンドの発行先(記録用)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "NullCommandList.h"
+
+namespace {
+	/// \brief ポインタを記録用の値に
+	uint64_t ToValue(const void* pointer) {
+		return static_cast<uint64_t>( reinterpret_cast<uintptr_t>( pointer ) );
+	}
+}
+
+///=============================================================================
+///						ディスクリプタヒープ
+void NullCommandList::SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) {
+	RenderCommand command;
+	command.type = RenderCommandType::kSetDescriptorHeaps;
+	command.value = heapCount > 0 ? ToValue(heaps[0]) : 0;
+	command.args[0] = heapCount;
+	output_->push_back(command);
+}
+
+///=============================================================================
+///						ルートシグネチャ・PSO
+void NullCommandList::SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) {
+	RenderCommand command;
+	command.type = RenderCommandType::kSetGraphicsRootSignature;
+	command.value = ToValue(rootSignature);
+	output_->push_back(command);
+}
+
+void NullCommandList::SetPipelineState(ID3D12PipelineState* pipelineState) {
+	RenderCommand command;
+	command.type = RenderCommandType::kSetPipelineState;
+	command.value = ToValue(pipelineState);
+	output_->push_back(command);
+}
+
+///=============================================================================
+///						入力アセンブラ
+void NullCommandList::IASetPrimitiveTopology(PrimitiveTopology topology) {
+	RenderCommand command;
+	command.type = RenderCommandType::kIASetPrimitiveTopology;
+	command.args[0] = static_cast<uint32_t>( topology );
+	output_->push_back(command);
+}
+
+void NullCommandList::IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) {
+	//スロットごとに1件ずつ記録する
+	for(uint32_t i = 0; i < viewCount; ++i) {
+		RenderCommand command;
+		command.type = RenderCommandType::kIASetVertexBuffer;
+		command.index = startSlot + i;
+		command.value = views[i].bufferLocation;
+		command.args[0] = views[i].sizeInBytes;
+		command.args[1] = views[i].strideInBytes;
+		output_->push_back(command);
+	}
+}
+
+void NullCommandList::IASetIndexBuffer(const IndexBufferView& view) {
+	RenderCommand command;
+	command.type = RenderCommandType::kIASetIndexBuffer;
+	command.value = view.bufferLocation;
+	command.args[0] = view.sizeInBytes;
+	command.args[1] = static_cast<uint32_t>( view.format );
+	output_->push_back(command);
+}
+
+///=============================================================================
+///						ルートパラメータ
+void NullCommandList::SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	RenderCommand command;
+	command.type = RenderCommandType::kSetGraphicsRootConstantBufferView;
+	command.index = rootParameterIndex;
+	command.value = gpuAddress;
+	output_->push_back(command);
+}
+
+void NullCommandList::SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	RenderCommand command;
+	command.type = RenderCommandType::kSetGraphicsRootShaderResourceView;
+	command.index = rootParameterIndex;
+	command.value = gpuAddress;
+	output_->push_back(command);
+}
+
+void NullCommandList::SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) {
+	RenderCommand command;
+	command.type = RenderCommandType::kSetGraphicsRootDescriptorTable;
+	command.index = rootParameterIndex;
+	command.value = gpuDescriptor;
+	output_->push_back(command);
+}
+
+///=============================================================================
+///						描画
+void NullCommandList::DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) {
+	RenderCommand command;
+	command.type = RenderCommandType::kDrawInstanced;
+	command.args[0] = vertexCountPerInstance;
+	command.args[1] = instanceCount;
+	command.args[2] = startVertexLocation;
+	command.args[3] = startInstanceLocation;
+	output_->push_back(command);
+}
+
+void NullCommandList::DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) {
+	RenderCommand command;
+	command.type = RenderCommandType::kDrawIndexedInstanced;
+	command.args[0] = indexCountPerInstance;
+	command.args[1] = instanceCount;
+	command.args[2] = startIndexLocation;
+	command.args[3] = static_cast<uint32_t>( baseVertexLocation );
+	command.args[4] = startInstanceLocation;
+	output_->push_back(command);
+}
+
+///=============================================================================
+///						リソースバリア
+void NullCommandList::ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) {
+	for(uint32_t i = 0; i < barrierCount; ++i) {
+		RenderCommand command;
+		command.value = ToValue(barriers[i].resource);
+		if(barriers[i].type == ResourceBarrierDesc::Type::kAliasing) {
+			command.type = RenderCommandType::kAliasingBarrier;
+			command.other = ToValue(barriers[i].resourceBefore);
+		} else {
+			command.type = RenderCommandType::kTransitionBarrier;
+			command.args[0] = static_cast<uint32_t>( barriers[i].before );
+			command.args[1] = static_cast<uint32_t>( barriers[i].after );
+		}
+		output_->push_back(command);
+	}
+}
@@ -0,0 +1,59 @@
+/*********************************************************************
+ * \file   NullCommandList.h
+ * \brief  GPUを使わない描画コマンドの発行先(記録用)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   すべての呼び出しを受け付けてRenderCommandの列として貯めるだけなので、
+ *         描画処理をGPUなし(サーバーやCI)で動かして中身を確かめられる。
+ *         1つのインスタンスは1スレッドから使う(パスごとに用意する)
+ *********************************************************************/
+#pragma once
+#include "BaseCommandList.h"
+#include "RenderCommand.h"
+#include <utility>
+#include <vector>
+
+///=============================================================================
+///						Nullコマンドリスト
+class NullCommandList : public BaseCommandList {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	void SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) override;
+	void SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) override;
+	void SetPipelineState(ID3D12PipelineState* pipelineState) override;
+	void IASetPrimitiveTopology(PrimitiveTopology topology) override;
+	void IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) override;
+	void IASetIndexBuffer(const IndexBufferView& view) override;
+	void SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) override;
+	void DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) override;
+	void DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) override;
+	void ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) override;
+
+	/// \brief 記録のクリア(確保したメモリは残す)
+	void Clear() { output_->clear(); }
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 記録したコマンドの取得
+	const std::vector<RenderCommand>& GetCommands() const { return *output_; }
+
+	/// \brief 記録したコマンドの取り出し(記録は空になる)
+	std::vector<RenderCommand> TakeCommands() { return std::move(*output_); }
+
+	/// \brief 記録先の設定(nullptrで内部の配列に戻す)
+	void SetOutput(std::vector<RenderCommand>* output) { output_ = output ? output : &commands_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 記録したコマンド
+	std::vector<RenderCommand> commands_;
+	// 記録先(既定はcommands_)
+	std::vector<RenderCommand>* output_ = &commands_;
+};
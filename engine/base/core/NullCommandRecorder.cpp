@@ -0,0 +1,65 @@
+/*********************************************************************
+ * \file   NullCommandRecorder.cpp
+ * \brief  GPUを使わないコマンド記録先(検証用)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "NullCommandRecorder.h"
+
+///=============================================================================
+///						フレームの記録開始
+void NullCommandRecorder::BeginFrame(uint32_t passCount) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	events_.push_back({ Event::Type::BeginFrame, passCount, std::this_thread::get_id() });
+}
+
+///=============================================================================
+///						パスの記録開始
+void NullCommandRecorder::BeginPass(uint32_t passIndex) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	events_.push_back({ Event::Type::BeginPass, passIndex, std::this_thread::get_id() });
+}
+
+///=============================================================================
+///						パスの記録終了
+void NullCommandRecorder::EndPass(uint32_t passIndex) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	events_.push_back({ Event::Type::EndPass, passIndex, std::this_thread::get_id() });
+}
+
+///=============================================================================
+///						提出
+void NullCommandRecorder::Submit(const std::vector<uint32_t>& passOrder) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	events_.push_back({ Event::Type::Submit, static_cast<uint32_t>( passOrder.size() ), std::this_thread::get_id() });
+	lastSubmitOrder_ = passOrder;
+	++submitCount_;
+}
+
+///=============================================================================
+///						記録のクリア
+void NullCommandRecorder::Clear() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	events_.clear();
+	lastSubmitOrder_.clear();
+	submitCount_ = 0;
+}
+
+///=============================================================================
+///						入出力関数
+std::vector<NullCommandRecorder::Event> NullCommandRecorder::GetEvents() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return events_;
+}
+
+std::vector<uint32_t> NullCommandRecorder::GetLastSubmitOrder() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return lastSubmitOrder_;
+}
+
+uint32_t NullCommandRecorder::GetSubmitCount() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return submitCount_;
+}
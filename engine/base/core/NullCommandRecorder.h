@@ -0,0 +1,66 @@
+/*********************************************************************
+ * \file   NullCommandRecorder.h
+ * \brief  GPUを使わないコマンド記録先(検証用)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   呼び出し順とスレッドを記録するだけなので、
+ *         並列記録と提出順の確認をD3D12なしで行える
+ *********************************************************************/
+#pragma once
+#include "BaseCommandRecorder.h"
+#include <mutex>
+#include <thread>
+
+///=============================================================================
+///						Nullコマンド記録
+class NullCommandRecorder : public BaseCommandRecorder {
+	///--------------------------------------------------------------
+	///							構造体
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Event 記録された呼び出し
+	 */
+	struct Event {
+		enum class Type { BeginFrame, BeginPass, EndPass, Submit };
+		Type type;
+		uint32_t value;				// パス番号またはパス数
+		std::thread::id threadId;	// 呼び出したスレッド
+	};
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	void BeginFrame(uint32_t passCount) override;
+	void BeginPass(uint32_t passIndex) override;
+	void EndPass(uint32_t passIndex) override;
+	void Submit(const std::vector<uint32_t>& passOrder) override;
+
+	/// \brief 記録のクリア
+	void Clear();
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 記録された呼び出しの取得
+	std::vector<Event> GetEvents() const;
+
+	/// \brief 最後に提出されたパスの並びの取得
+	std::vector<uint32_t> GetLastSubmitOrder() const;
+
+	/// \brief 提出回数の取得
+	uint32_t GetSubmitCount() const;
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 複数スレッドから呼ばれるので保護する
+	mutable std::mutex mutex_;
+	// 呼び出しの記録
+	std::vector<Event> events_;
+	// 最後に提出された並び
+	std::vector<uint32_t> lastSubmitOrder_;
+	// 提出回数
+	uint32_t submitCount_ = 0;
+};
@@ -0,0 +1,153 @@
+/*********************************************************************
+ * \file   ParallelPassRecorder.cpp
+ * \brief  描画パスのコマンドをワーカースレッドで並列に記録する
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "ParallelPassRecorder.h"
+#include <cassert>
+#include <numeric>
+
+///=============================================================================
+///						デストラクタ
+ParallelPassRecorder::~ParallelPassRecorder() {
+	Finalize();
+}
+
+///=============================================================================
+///						初期化
+void ParallelPassRecorder::Initialize(BaseCommandRecorder* recorder, uint32_t workerCount) {
+	assert(recorder);
+	assert(workers_.empty());
+	recorder_ = recorder;
+	isExit_ = false;
+	//========================================
+	// ワーカースレッドの起動
+	for(uint32_t i = 0; i < workerCount; ++i) {
+		workers_.emplace_back(&ParallelPassRecorder::WorkerMain, this);
+	}
+}
+
+///=============================================================================
+///						終了処理
+void ParallelPassRecorder::Finalize() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		isExit_ = true;
+	}
+	startCondition_.notify_all();
+	for(auto& worker : workers_) {
+		worker.join();
+	}
+	workers_.clear();
+}
+
+///=============================================================================
+///						パスの追加
+void ParallelPassRecorder::AddPass(const std::string& name, std::function<void()> record) {
+	passes_.push_back({ name, std::move(record) });
+}
+
+///=============================================================================
+///						記録と提出
+void ParallelPassRecorder::Execute() {
+	if(passes_.empty()) {
+		return;
+	}
+	uint32_t passCount = static_cast<uint32_t>( passes_.size() );
+	//========================================
+	// 記録先の準備はメインスレッドで行う
+	recorder_->BeginFrame(passCount);
+
+	//========================================
+	// ワーカーに記録開始を通知
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		finishedPassCount_ = 0;
+		exception_ = nullptr;
+		// パス数を先に確定させてから番号を配り始める
+		passCount_ = passCount;
+		nextPassIndex_ = 0;
+		++generation_;
+	}
+	startCondition_.notify_all();
+
+	//========================================
+	// メインスレッドも記録に参加
+	while(RecordNextPass()) {
+	}
+
+	//========================================
+	// 全パスの記録完了を待つ
+	std::exception_ptr exception;
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		doneCondition_.wait(lock, [&] { return finishedPassCount_ == passCount; });
+		exception = exception_;
+	}
+	passes_.clear();
+	if(exception) {
+		std::rethrow_exception(exception);
+	}
+
+	//========================================
+	// 登録順で提出
+	std::vector<uint32_t> passOrder(passCount);
+	std::iota(passOrder.begin(), passOrder.end(), 0u);
+	recorder_->Submit(passOrder);
+}
+
+///=============================================================================
+///						ワーカースレッドの処理
+void ParallelPassRecorder::WorkerMain() {
+	uint64_t seenGeneration = 0;
+	while(true) {
+		//========================================
+		// 新しい記録要求を待つ
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			startCondition_.wait(lock, [&] { return isExit_ || generation_ != seenGeneration; });
+			if(isExit_) {
+				return;
+			}
+			seenGeneration = generation_;
+		}
+		//========================================
+		// 残っているパスを記録
+		while(RecordNextPass()) {
+		}
+	}
+}
+
+///=============================================================================
+///						パスを1つ記録
+bool ParallelPassRecorder::RecordNextPass() {
+	//========================================
+	// パス番号の取得
+	uint32_t passIndex = nextPassIndex_.fetch_add(1);
+	if(passIndex >= passCount_) {
+		return false;
+	}
+	//========================================
+	// 記録
+	try {
+		recorder_->BeginPass(passIndex);
+		passes_[passIndex].record();
+		recorder_->EndPass(passIndex);
+	} catch(...) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if(!exception_) {
+			exception_ = std::current_exception();
+		}
+	}
+	//========================================
+	// 完了の通知
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		++finishedPassCount_;
+	}
+	doneCondition_.notify_one();
+	return true;
+}
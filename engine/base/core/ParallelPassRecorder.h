@@ -0,0 +1,117 @@
+/*********************************************************************
+ * \file   ParallelPassRecorder.h
+ * \brief  描画パスのコマンドをワーカースレッドで並列に記録する
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   記録は並列、提出は登録順でまとめて1回
+ *********************************************************************/
+#pragma once
+#include "BaseCommandRecorder.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+///=============================================================================
+///						並列パス記録
+class ParallelPassRecorder {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/// \brief デストラクタ
+	~ParallelPassRecorder();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  recorder コマンド記録先
+	 * \param  workerCount ワーカースレッド数(0ならメインスレッドのみで記録)
+	 */
+	void Initialize(BaseCommandRecorder* recorder, uint32_t workerCount);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Finalize 終了処理(ワーカースレッドの停止)
+	 */
+	void Finalize();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  AddPass パスの追加
+	 * \param  name パス名
+	 * \param  record 記録処理 コマンドリストは呼び出したスレッドに結び付けられている
+	 * \note   登録した順番がGPUでの実行順になる
+	 */
+	void AddPass(const std::string& name, std::function<void()> record);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Execute 登録したパスを並列に記録して提出
+	 * \note   記録中の例外はメインスレッドで再送出する。登録したパスはクリアされる
+	 */
+	void Execute();
+
+	///--------------------------------------------------------------
+	///							静的メンバ関数
+private:
+	/**----------------------------------------------------------------------------
+	 * \brief  WorkerMain ワーカースレッドの処理
+	 */
+	void WorkerMain();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  RecordNextPass 未記録のパスを1つ取得して記録
+	 * \return 記録したらtrue
+	 */
+	bool RecordNextPass();
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief ワーカースレッド数の取得
+	uint32_t GetWorkerCount() const { return static_cast<uint32_t>( workers_.size() ); }
+
+	/// \brief 登録中のパス数の取得
+	uint32_t GetPassCount() const { return static_cast<uint32_t>( passes_.size() ); }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// パス
+	struct Pass {
+		std::string name;
+		std::function<void()> record;
+	};
+
+	//========================================
+	// コマンド記録先
+	BaseCommandRecorder* recorder_ = nullptr;
+	// 登録されたパス
+	std::vector<Pass> passes_;
+
+	//========================================
+	// ワーカースレッド
+	std::vector<std::thread> workers_;
+	std::mutex mutex_;
+	// 記録開始の通知
+	std::condition_variable startCondition_;
+	// 記録完了の通知
+	std::condition_variable doneCondition_;
+	// 記録要求の世代(ワーカーが新しい要求を見分けるため)
+	uint64_t generation_ = 0;
+	// 終了要求
+	bool isExit_ = false;
+
+	//========================================
+	// 記録状況
+	// 次に記録するパス番号
+	std::atomic<uint32_t> nextPassIndex_ = 0;
+	// 今回の記録対象パス数
+	std::atomic<uint32_t> passCount_ = 0;
+	// 記録を終えたパス数(mutex_で保護)
+	uint32_t finishedPassCount_ = 0;
+	// 記録中に発生した例外(mutex_で保護)
+	std::exception_ptr exception_;
+};
@@ -0,0 +1,257 @@
+/*********************************************************************
+ * \file   PipelineStateCache.cpp
+ * \brief  パイプラインステートのキャッシュとディスク上のパイプラインライブラリ
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "PipelineStateCache.h"
+#include "Logger.h"
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace Logger;
+
+namespace {
+	//========================================
+	// FNV-1a
+	constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+	constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+	void HashBytes(uint64_t& hash, const void* data, size_t size) {
+		const uint8_t* bytes = static_cast<const uint8_t*>( data );
+		for(size_t i = 0; i < size; ++i) {
+			hash ^= bytes[i];
+			hash *= kFnvPrime;
+		}
+	}
+
+	template<typename T>
+	void HashValue(uint64_t& hash, const T& value) {
+		HashBytes(hash, &value, sizeof(T));
+	}
+
+	void HashShader(uint64_t& hash, const D3D12_SHADER_BYTECODE& shader) {
+		HashValue(hash, shader.BytecodeLength);
+		if(shader.pShaderBytecode) {
+			HashBytes(hash, shader.pShaderBytecode, shader.BytecodeLength);
+		}
+	}
+
+	void HashStencilOp(uint64_t& hash, const D3D12_DEPTH_STENCILOP_DESC& op) {
+		HashValue(hash, op.StencilFailOp);
+		HashValue(hash, op.StencilDepthFailOp);
+		HashValue(hash, op.StencilPassOp);
+		HashValue(hash, op.StencilFunc);
+	}
+
+	/// \brief ライブラリ内の名前
+	std::wstring MakePipelineName(uint64_t key) {
+		return std::format(L"{:016x}", key);
+	}
+}
+
+///=============================================================================
+///						初期化
+void PipelineStateCache::Initialize(ID3D12Device* device, const std::filesystem::path& libraryPath) {
+	device_ = device;
+	libraryPath_ = libraryPath;
+
+	//========================================
+	// パイプラインライブラリはID3D12Device1から
+	Microsoft::WRL::ComPtr<ID3D12Device1> device1;
+	if(FAILED(device_.As(&device1))) {
+		Log("Pipeline library is not supported. PSOs are compiled every launch.", LogLevel::Warning);
+		return;
+	}
+
+	//========================================
+	// 前回保存したライブラリを読む
+	std::ifstream file(libraryPath_, std::ios::binary);
+	if(file) {
+		libraryData_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	if(!libraryData_.empty()) {
+		HRESULT hr = device1->CreatePipelineLibrary(libraryData_.data(), libraryData_.size(), IID_PPV_ARGS(&pipelineLibrary_));
+		if(SUCCEEDED(hr)) {
+			Log("Pipeline library loaded successfully :)", LogLevel::Success);
+			return;
+		}
+		//ドライバやGPUが変わった場合は使えないので作り直す
+		Log("Pipeline library is out of date. Rebuilding.", LogLevel::Warning);
+		libraryData_.clear();
+	}
+	HRESULT hr = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&pipelineLibrary_));
+	if(FAILED(hr)) {
+		Log("Failed to create pipeline library.", LogLevel::Warning);
+		pipelineLibrary_ = nullptr;
+	}
+}
+
+///=============================================================================
+///						終了処理
+void PipelineStateCache::Finalize() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	//========================================
+	// 増えていればライブラリを保存
+	if(pipelineLibrary_ && isDirty_) {
+		std::vector<uint8_t> serialized(pipelineLibrary_->GetSerializedSize());
+		if(SUCCEEDED(pipelineLibrary_->Serialize(serialized.data(), serialized.size()))) {
+			std::error_code errorCode;
+			std::filesystem::create_directories(libraryPath_.parent_path(), errorCode);
+			//書きかけのファイルを読まないよう、一時ファイルに書いてから置き換える
+			std::filesystem::path temporaryPath = libraryPath_;
+			temporaryPath += ".tmp";
+			bool isWritten = false;
+			{
+				std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+				file.write(reinterpret_cast<const char*>( serialized.data() ), static_cast<std::streamsize>( serialized.size() ));
+				isWritten = static_cast<bool>( file );
+			}
+			if(isWritten) {
+				std::filesystem::rename(temporaryPath, libraryPath_, errorCode);
+			}
+			if(!isWritten || errorCode) {
+				std::filesystem::remove(temporaryPath, errorCode);
+				Log("Failed to save pipeline library.", LogLevel::Warning);
+			}
+		}
+		isDirty_ = false;
+	}
+	//========================================
+	// 解放
+	pipelineStates_.clear();
+	pipelineLibrary_ = nullptr;
+	libraryData_.clear();
+	device_ = nullptr;
+}
+
+///=============================================================================
+///						PSOの取得
+Microsoft::WRL::ComPtr<ID3D12PipelineState> PipelineStateCache::GetOrCreate(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+	uint64_t key = ComputeKey(desc);
+	//同じ設定でもルートシグネチャが違えば別のPSO
+	uint64_t memoryKey = key;
+	HashValue(memoryKey, desc.pRootSignature);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	//========================================
+	// メモリ上のキャッシュ
+	auto it = pipelineStates_.find(memoryKey);
+	if(it != pipelineStates_.end()) {
+		++hitCount_;
+		return it->second;
+	}
+
+	//========================================
+	// パイプラインライブラリ
+	Microsoft::WRL::ComPtr<ID3D12PipelineState> pipelineState;
+	std::wstring name = MakePipelineName(key);
+	if(pipelineLibrary_ && SUCCEEDED(pipelineLibrary_->LoadGraphicsPipeline(name.c_str(), &desc, IID_PPV_ARGS(&pipelineState)))) {
+		++loadedCount_;
+		pipelineStates_.emplace(memoryKey, pipelineState);
+		return pipelineState;
+	}
+
+	//========================================
+	// 生成してライブラリに格納
+	HRESULT hr = device_->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&pipelineState));
+	if(FAILED(hr)) {
+		Log("Failed to create graphics pipeline state.", LogLevel::Error);
+		return nullptr;
+	}
+	++createdCount_;
+	//同名が既にある(ルートシグネチャだけ違う)場合は格納できないが、このPSOは使える
+	if(pipelineLibrary_ && SUCCEEDED(pipelineLibrary_->StorePipeline(name.c_str(), pipelineState.Get()))) {
+		isDirty_ = true;
+	}
+	pipelineStates_.emplace(memoryKey, pipelineState);
+	return pipelineState;
+}
+
+///=============================================================================
+///						PSOの事前生成
+void PipelineStateCache::Precompile(const std::vector<D3D12_GRAPHICS_PIPELINE_STATE_DESC>& descs) {
+	for(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc : descs) {
+		GetOrCreate(desc);
+	}
+}
+
+///=============================================================================
+///						キーの計算
+uint64_t PipelineStateCache::ComputeKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+	uint64_t hash = kFnvOffsetBasis;
+	//========================================
+	// シェーダー
+	HashShader(hash, desc.VS);
+	HashShader(hash, desc.PS);
+	HashShader(hash, desc.DS);
+	HashShader(hash, desc.HS);
+	HashShader(hash, desc.GS);
+
+	//========================================
+	// ブレンド
+	HashValue(hash, desc.BlendState.AlphaToCoverageEnable);
+	HashValue(hash, desc.BlendState.IndependentBlendEnable);
+	//UINT8の書き込みマスクの後ろに詰め物があるので個別に
+	for(const D3D12_RENDER_TARGET_BLEND_DESC& renderTarget : desc.BlendState.RenderTarget) {
+		HashValue(hash, renderTarget.BlendEnable);
+		HashValue(hash, renderTarget.LogicOpEnable);
+		HashValue(hash, renderTarget.SrcBlend);
+		HashValue(hash, renderTarget.DestBlend);
+		HashValue(hash, renderTarget.BlendOp);
+		HashValue(hash, renderTarget.SrcBlendAlpha);
+		HashValue(hash, renderTarget.DestBlendAlpha);
+		HashValue(hash, renderTarget.BlendOpAlpha);
+		HashValue(hash, renderTarget.LogicOp);
+		HashValue(hash, renderTarget.RenderTargetWriteMask);
+	}
+	HashValue(hash, desc.SampleMask);
+
+	//========================================
+	// ラスタライザ
+	HashValue(hash, desc.RasterizerState);
+
+	//========================================
+	// 深度ステンシル(UINT8のマスクの後ろに詰め物があるので個別に)
+	HashValue(hash, desc.DepthStencilState.DepthEnable);
+	HashValue(hash, desc.DepthStencilState.DepthWriteMask);
+	HashValue(hash, desc.DepthStencilState.DepthFunc);
+	HashValue(hash, desc.DepthStencilState.StencilEnable);
+	HashValue(hash, desc.DepthStencilState.StencilReadMask);
+	HashValue(hash, desc.DepthStencilState.StencilWriteMask);
+	HashStencilOp(hash, desc.DepthStencilState.FrontFace);
+	HashStencilOp(hash, desc.DepthStencilState.BackFace);
+
+	//========================================
+	// 入力レイアウト
+	HashValue(hash, desc.InputLayout.NumElements);
+	for(UINT i = 0; i < desc.InputLayout.NumElements; ++i) {
+		const D3D12_INPUT_ELEMENT_DESC& element = desc.InputLayout.pInputElementDescs[i];
+		HashBytes(hash, element.SemanticName, std::strlen(element.SemanticName) + 1);
+		HashValue(hash, element.SemanticIndex);
+		HashValue(hash, element.Format);
+		HashValue(hash, element.InputSlot);
+		HashValue(hash, element.AlignedByteOffset);
+		HashValue(hash, element.InputSlotClass);
+		HashValue(hash, element.InstanceDataStepRate);
+	}
+
+	//========================================
+	// フォーマットなど
+	HashValue(hash, desc.IBStripCutValue);
+	HashValue(hash, desc.PrimitiveTopologyType);
+	HashValue(hash, desc.NumRenderTargets);
+	for(UINT i = 0; i < desc.NumRenderTargets; ++i) {
+		HashValue(hash, desc.RTVFormats[i]);
+	}
+	HashValue(hash, desc.DSVFormat);
+	HashValue(hash, desc.SampleDesc);
+	HashValue(hash, desc.NodeMask);
+	HashValue(hash, desc.Flags);
+	return hash;
+}
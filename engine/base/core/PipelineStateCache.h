@@ -0,0 +1,102 @@
+/*********************************************************************
+ * \file   PipelineStateCache.h
+ * \brief  パイプラインステートのキャッシュとディスク上のパイプラインライブラリ
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   PSOは設定内容(ブレンド・深度・ラスタライザ・シェーダー・フォーマット等)の
+ *         ハッシュをキーに必要になった時点で生成し、終了時にライブラリとして保存する。
+ *         次回起動時はライブラリから読み込むのでドライバでのコンパイルを省ける
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <d3d12.h>
+#include <wrl/client.h>
+
+///=============================================================================
+///						パイプラインステートキャッシュ
+class PipelineStateCache {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  device デバイス
+	 * \param  libraryPath パイプラインライブラリの保存先
+	 * \note   ライブラリが読めない(ドライバ更新など)ときは空のライブラリから作り直す
+	 */
+	void Initialize(ID3D12Device* device, const std::filesystem::path& libraryPath);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Finalize 終了処理
+	 * \note   新しいPSOが増えていればライブラリを保存する。デバイスの解放前に呼ぶ
+	 */
+	void Finalize();
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetOrCreate PSOの取得(なければ生成)
+	 * \param  desc パイプラインの設定
+	 * \return PSO 生成に失敗したらnullptr
+	 * \note   複数スレッドから呼んでよい
+	 */
+	Microsoft::WRL::ComPtr<ID3D12PipelineState> GetOrCreate(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Precompile PSOを先に作っておく
+	 * \param  descs パイプラインの設定の一覧
+	 * \note   シーンの初期化中に呼び、描画中の生成による引っかかりを避ける
+	 */
+	void Precompile(const std::vector<D3D12_GRAPHICS_PIPELINE_STATE_DESC>& descs);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  ComputeKey キーの計算
+	 * \param  desc パイプラインの設定
+	 * \return キー
+	 * \note   ルートシグネチャは実行ごとにアドレスが変わるので含めない
+	 */
+	static uint64_t ComputeKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief メモリ上のキャッシュにあった回数の取得
+	uint32_t GetHitCount() const { return hitCount_; }
+
+	/// \brief ライブラリから読み込んだ回数の取得
+	uint32_t GetLoadedCount() const { return loadedCount_; }
+
+	/// \brief ドライバでコンパイルした回数の取得
+	uint32_t GetCreatedCount() const { return createdCount_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// デバイス
+	Microsoft::WRL::ComPtr<ID3D12Device> device_;
+
+	//========================================
+	// パイプラインライブラリ
+	Microsoft::WRL::ComPtr<ID3D12PipelineLibrary> pipelineLibrary_;
+	// ライブラリの元データ(ライブラリが生きている間は保持する必要がある)
+	std::vector<uint8_t> libraryData_;
+	// 保存先
+	std::filesystem::path libraryPath_;
+	// 新しいPSOを格納したか
+	bool isDirty_ = false;
+
+	//========================================
+	// 生成済みのPSO(キーとルートシグネチャで引く)
+	std::unordered_map<uint64_t, Microsoft::WRL::ComPtr<ID3D12PipelineState>> pipelineStates_;
+	std::mutex mutex_;
+
+	//========================================
+	// 統計
+	uint32_t hitCount_ = 0;
+	uint32_t loadedCount_ = 0;
+	uint32_t createdCount_ = 0;
+};
@@ -0,0 +1,30 @@
+/*********************************************************************
+ * \file   RenderCommand.cpp
+ * \brief  記録した描画コマンド1件分(D3D12非依存の固定長レコード)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "RenderCommand.h"
+
+///=============================================================================
+///						コマンド名の取得
+const char* GetRenderCommandName(RenderCommandType type) {
+	switch(type) {
+	case RenderCommandType::kSetDescriptorHeaps:					return "SetDescriptorHeaps";
+	case RenderCommandType::kSetGraphicsRootSignature:				return "SetGraphicsRootSignature";
+	case RenderCommandType::kSetPipelineState:						return "SetPipelineState";
+	case RenderCommandType::kIASetPrimitiveTopology:				return "IASetPrimitiveTopology";
+	case RenderCommandType::kIASetVertexBuffer:						return "IASetVertexBuffer";
+	case RenderCommandType::kIASetIndexBuffer:						return "IASetIndexBuffer";
+	case RenderCommandType::kSetGraphicsRootConstantBufferView:		return "SetGraphicsRootConstantBufferView";
+	case RenderCommandType::kSetGraphicsRootShaderResourceView:		return "SetGraphicsRootShaderResourceView";
+	case RenderCommandType::kSetGraphicsRootDescriptorTable:		return "SetGraphicsRootDescriptorTable";
+	case RenderCommandType::kDrawInstanced:							return "DrawInstanced";
+	case RenderCommandType::kDrawIndexedInstanced:					return "DrawIndexedInstanced";
+	case RenderCommandType::kTransitionBarrier:						return "TransitionBarrier";
+	case RenderCommandType::kAliasingBarrier:						return "AliasingBarrier";
+	default:														return "Unknown";
+	}
+}
@@ -0,0 +1,54 @@
+/*********************************************************************
+ * \file   RenderCommand.h
+ * \brief  記録した描画コマンド1件分(D3D12非依存の固定長レコード)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   Null版の発行先が呼び出しをこの形で貯める。固定長なので
+ *         そのまま配列で保存・比較できる
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+
+///=============================================================================
+///						コマンドの種類
+enum class RenderCommandType : uint32_t {
+	kSetDescriptorHeaps,			// value: 先頭のヒープ   args[0]: ヒープ数
+	kSetGraphicsRootSignature,		// value: ルートシグネチャ
+	kSetPipelineState,				// value: PSO
+	kIASetPrimitiveTopology,		// args[0]: PrimitiveTopology
+	kIASetVertexBuffer,				// index: スロット   value: GPUアドレス   args[0]: サイズ   args[1]: ストライド
+	kIASetIndexBuffer,				// value: GPUアドレス   args[0]: サイズ   args[1]: IndexFormat
+	kSetGraphicsRootConstantBufferView,	// index: ルートパラメータ   value: GPUアドレス
+	kSetGraphicsRootShaderResourceView,	// index: ルートパラメータ   value: GPUアドレス
+	kSetGraphicsRootDescriptorTable,	// index: ルートパラメータ   value: GPUディスクリプタ
+	kDrawInstanced,					// args: 頂点数, インスタンス数, 開始頂点, 開始インスタンス
+	kDrawIndexedInstanced,			// args: インデックス数, インスタンス数, 開始インデックス, ベース頂点(int32), 開始インスタンス
+	kTransitionBarrier,				// value: リソース   args[0]: 遷移前(ResourceState)   args[1]: 遷移後
+	kAliasingBarrier,				// value: これから使うリソース   other: それまで使っていたリソース
+	kCount,
+};
+
+///=============================================================================
+///						記録した描画コマンド
+struct RenderCommand {
+	RenderCommandType type = RenderCommandType::kCount;
+	uint32_t index = 0;			// スロットやルートパラメータ番号
+	uint64_t value = 0;			// アドレス・ハンドル・オブジェクトのポインタ値
+	uint64_t other = 0;			// 2つめのオブジェクト(エイリアシングバリア)
+	uint32_t args[5] = {};		// 個数などの引数
+	uint32_t reserved = 0;		// 詰め物(ファイルにそのまま書くため明示する)
+};
+static_assert(sizeof(RenderCommand) == 48, "RenderCommand is written to capture files as is");
+
+/**----------------------------------------------------------------------------
+ * \brief  GetRenderCommandName コマンド名の取得
+ */
+const char* GetRenderCommandName(RenderCommandType type);
+
+/**----------------------------------------------------------------------------
+ * \brief  IsDrawCommand 描画コールか
+ */
+inline bool IsDrawCommand(RenderCommandType type) {
+	return type == RenderCommandType::kDrawInstanced || type == RenderCommandType::kDrawIndexedInstanced;
+}
@@ -0,0 +1,240 @@
+/*********************************************************************
+ * \file   RenderCommandAnalyzer.cpp
+ * \brief  取り込んだ描画コマンド列の分析(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "RenderCommandAnalyzer.h"
+#include <algorithm>
+#include <format>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+	//========================================
+	// バインド中の値(未設定を区別する)
+	struct BoundValue {
+		bool isSet = false;
+		uint64_t value = 0;
+		uint64_t other = 0;
+
+		/// \brief 設定して、同じ値の再設定だったかを返す
+		bool Set(uint64_t newValue, uint64_t newOther = 0) {
+			bool isRedundant = isSet && value == newValue && other == newOther;
+			isSet = true;
+			value = newValue;
+			other = newOther;
+			return isRedundant;
+		}
+	};
+
+	//========================================
+	// インスタンス化の判定キー
+	using InstancingKey = std::array<uint64_t, 9>;
+
+	/// \brief 値を混ぜる(FNV-1a)
+	uint64_t HashCombine(uint64_t hash, uint64_t value) {
+		for(int i = 0; i < 8; ++i) {
+			hash ^= ( value >> ( i * 8 ) ) & 0xff;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	/// \brief 2つの32bit値を1つに
+	uint64_t Pack(uint32_t low, uint32_t high) {
+		return static_cast<uint64_t>( low ) | ( static_cast<uint64_t>( high ) << 32 );
+	}
+}
+
+///=============================================================================
+///						無駄な再設定の合計
+uint32_t RenderCommandReport::GetRedundantCount() const {
+	uint32_t total = 0;
+	for(uint32_t count : redundantCounts) {
+		total += count;
+	}
+	return total;
+}
+
+///=============================================================================
+///						分析
+RenderCommandReport RenderCommandAnalyzer::Analyze(const std::vector<RenderCommand>& commands) {
+	RenderCommandReport report;
+	report.commandCount = commands.size();
+
+	//========================================
+	// バインド中の状態
+	BoundValue heaps;
+	BoundValue rootSignature;
+	BoundValue pipelineState;
+	BoundValue topology;
+	BoundValue indexBuffer;
+	std::map<uint32_t, BoundValue> vertexBuffers;
+	std::map<uint32_t, BoundValue> rootConstantBuffers;
+	std::map<uint32_t, BoundValue> rootShaderResources;
+	std::map<uint32_t, BoundValue> rootTables;
+
+	std::unordered_set<uint64_t> usedTables;
+	std::unordered_map<uint64_t, RenderCommandReport::PipelineStats> pipelines;
+	std::map<InstancingKey, RenderCommandReport::InstancingCandidate> candidates;
+
+	for(const RenderCommand& command : commands) {
+		size_t typeIndex = static_cast<size_t>( command.type );
+		if(typeIndex >= report.commandCounts.size()) {
+			continue;
+		}
+		++report.commandCounts[typeIndex];
+
+		bool isRedundant = false;
+		switch(command.type) {
+		case RenderCommandType::kSetDescriptorHeaps:
+			isRedundant = heaps.Set(command.value, command.args[0]);
+			break;
+		case RenderCommandType::kSetGraphicsRootSignature:
+			isRedundant = rootSignature.Set(command.value);
+			//別のルートシグネチャに変わるとルート引数はすべて設定し直しになる
+			if(!isRedundant) {
+				rootConstantBuffers.clear();
+				rootShaderResources.clear();
+				rootTables.clear();
+			}
+			break;
+		case RenderCommandType::kSetPipelineState:
+			isRedundant = pipelineState.Set(command.value);
+			break;
+		case RenderCommandType::kIASetPrimitiveTopology:
+			isRedundant = topology.Set(command.args[0]);
+			break;
+		case RenderCommandType::kIASetVertexBuffer:
+			isRedundant = vertexBuffers[command.index].Set(command.value, Pack(command.args[0], command.args[1]));
+			break;
+		case RenderCommandType::kIASetIndexBuffer:
+			isRedundant = indexBuffer.Set(command.value, Pack(command.args[0], command.args[1]));
+			break;
+		case RenderCommandType::kSetGraphicsRootConstantBufferView:
+			isRedundant = rootConstantBuffers[command.index].Set(command.value);
+			break;
+		case RenderCommandType::kSetGraphicsRootShaderResourceView:
+			isRedundant = rootShaderResources[command.index].Set(command.value);
+			break;
+		case RenderCommandType::kSetGraphicsRootDescriptorTable:
+			isRedundant = rootTables[command.index].Set(command.value);
+			if(!isRedundant) {
+				++report.descriptorTableChanges;
+			}
+			usedTables.insert(command.value);
+			break;
+		case RenderCommandType::kTransitionBarrier:
+		case RenderCommandType::kAliasingBarrier:
+			++report.barrierCount;
+			break;
+		case RenderCommandType::kDrawInstanced:
+		case RenderCommandType::kDrawIndexedInstanced:
+		{
+			bool isIndexed = command.type == RenderCommandType::kDrawIndexedInstanced;
+			uint32_t instanceCount = command.args[1];
+			++report.drawCount;
+			report.instanceCount += instanceCount;
+
+			RenderCommandReport::PipelineStats& stats = pipelines[pipelineState.value];
+			stats.pipelineState = pipelineState.value;
+			++stats.drawCount;
+			stats.instanceCount += instanceCount;
+
+			//1インスタンスずつの描画だけがインスタンス化の対象
+			if(instanceCount != 1) {
+				break;
+			}
+			uint64_t tableHash = 14695981039346656037ull;
+			for(const auto& [index, table] : rootTables) {
+				tableHash = HashCombine(HashCombine(tableHash, index), table.value);
+			}
+			const BoundValue& vertexBuffer = vertexBuffers[0];
+			InstancingKey key = {
+				typeIndex,
+				pipelineState.value,
+				rootSignature.value,
+				topology.value,
+				vertexBuffer.value,
+				isIndexed ? indexBuffer.value : 0,
+				tableHash,
+				Pack(command.args[0], command.args[2]),
+				isIndexed ? command.args[3] : 0,
+			};
+			RenderCommandReport::InstancingCandidate& candidate = candidates[key];
+			candidate.pipelineState = pipelineState.value;
+			candidate.vertexBuffer = vertexBuffer.value;
+			candidate.elementCount = command.args[0];
+			++candidate.drawCount;
+			break;
+		}
+		default:
+			break;
+		}
+		if(isRedundant) {
+			++report.redundantCounts[typeIndex];
+		}
+	}
+	report.uniqueDescriptorTables = static_cast<uint32_t>( usedTables.size() );
+
+	//========================================
+	// PSOは描画数の多い順
+	report.pipelines.reserve(pipelines.size());
+	for(const auto& [pipeline, stats] : pipelines) {
+		report.pipelines.push_back(stats);
+	}
+	std::sort(report.pipelines.begin(), report.pipelines.end(), [](const auto& lhs, const auto& rhs) {
+		return lhs.drawCount != rhs.drawCount ? lhs.drawCount > rhs.drawCount : lhs.pipelineState < rhs.pipelineState;
+	});
+
+	//========================================
+	// 2つ以上まとめられるものだけを候補にする
+	for(const auto& [key, candidate] : candidates) {
+		if(candidate.drawCount < 2) {
+			continue;
+		}
+		report.instancingCandidates.push_back(candidate);
+		report.mergeableDrawCount += candidate.drawCount - 1;
+	}
+	std::sort(report.instancingCandidates.begin(), report.instancingCandidates.end(), [](const auto& lhs, const auto& rhs) {
+		return lhs.drawCount > rhs.drawCount;
+	});
+	return report;
+}
+
+///=============================================================================
+///						文字列化
+std::string RenderCommandAnalyzer::Format(const RenderCommandReport& report, size_t maxRows) {
+	std::string text;
+	text += std::format("Commands: {}  Draws: {}  Instances: {}  Barriers: {}\n",
+		report.commandCount, report.drawCount, report.instanceCount, report.barrierCount);
+	text += std::format("Redundant state sets: {}\n", report.GetRedundantCount());
+	for(size_t i = 0; i < report.commandCounts.size(); ++i) {
+		if(report.commandCounts[i] == 0) {
+			continue;
+		}
+		text += std::format("  {:<36}{:>7}  redundant {:>6}\n",
+			GetRenderCommandName(static_cast<RenderCommandType>( i )), report.commandCounts[i], report.redundantCounts[i]);
+	}
+	text += std::format("Descriptor table changes: {}  unique tables: {}\n",
+		report.descriptorTableChanges, report.uniqueDescriptorTables);
+
+	text += std::format("Draws per PSO ({} PSOs)\n", report.pipelines.size());
+	for(size_t i = 0; i < ( std::min )( maxRows, report.pipelines.size() ); ++i) {
+		const RenderCommandReport::PipelineStats& stats = report.pipelines[i];
+		text += std::format("  PSO {:#014x}  draws {:>6}  instances {:>8}\n", stats.pipelineState, stats.drawCount, stats.instanceCount);
+	}
+
+	text += std::format("Instancing candidates: {}  mergeable draws: {}\n",
+		report.instancingCandidates.size(), report.mergeableDrawCount);
+	for(size_t i = 0; i < ( std::min )( maxRows, report.instancingCandidates.size() ); ++i) {
+		const RenderCommandReport::InstancingCandidate& candidate = report.instancingCandidates[i];
+		text += std::format("  PSO {:#014x}  VB {:#014x}  elements {:>6}  draws {:>5}\n",
+			candidate.pipelineState, candidate.vertexBuffer, candidate.elementCount, candidate.drawCount);
+	}
+	return text;
+}
@@ -0,0 +1,74 @@
+/*********************************************************************
+ * \file   RenderCommandAnalyzer.h
+ * \brief  取り込んだ描画コマンド列の分析(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   コマンド列を先頭から辿ってバインド中の状態を追い、
+ *         同じ値の再設定(無駄なステート変更)、PSOごとの描画数、
+ *         ディスクリプタテーブルの切り替え回数、インスタンス化できそうな描画を数える
+ *********************************************************************/
+#pragma once
+#include "RenderCommand.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///=============================================================================
+///						分析結果
+struct RenderCommandReport {
+	//========================================
+	// PSOごとの描画数
+	struct PipelineStats {
+		uint64_t pipelineState = 0;	// PSO(ポインタ値)
+		uint32_t drawCount = 0;		// 描画コール数
+		uint64_t instanceCount = 0;	// インスタンス数の合計
+	};
+
+	//========================================
+	// インスタンス化の候補
+	// PSO・頂点/インデックスバッファ・ディスクリプタテーブル・描画範囲が同じで、
+	// 1インスタンスずつ描いている描画のまとまり(ルート定数バッファだけが違う)
+	struct InstancingCandidate {
+		uint64_t pipelineState = 0;	// PSO(ポインタ値)
+		uint64_t vertexBuffer = 0;	// スロット0の頂点バッファ(GPUアドレス)
+		uint32_t elementCount = 0;	// 頂点数(インデックス描画ならインデックス数)
+		uint32_t drawCount = 0;		// まとめられる描画コール数
+	};
+
+	size_t commandCount = 0;
+	std::array<uint32_t, static_cast<size_t>( RenderCommandType::kCount )> commandCounts{};		// 種類ごとの件数
+	std::array<uint32_t, static_cast<size_t>( RenderCommandType::kCount )> redundantCounts{};	// 種類ごとの無駄な再設定の件数
+	uint32_t drawCount = 0;					// 描画コール数
+	uint64_t instanceCount = 0;				// インスタンス数の合計
+	uint32_t barrierCount = 0;				// バリア数
+	uint32_t descriptorTableChanges = 0;	// ディスクリプタテーブルを別の値に切り替えた回数
+	uint32_t uniqueDescriptorTables = 0;	// 使われたディスクリプタテーブルの種類数
+	std::vector<PipelineStats> pipelines;					// 描画数の多い順
+	std::vector<InstancingCandidate> instancingCandidates;	// まとめられる描画の多い順
+	uint32_t mergeableDrawCount = 0;		// インスタンス化で減らせる描画コール数
+
+	/// \brief 無駄な再設定の合計
+	uint32_t GetRedundantCount() const;
+};
+
+///=============================================================================
+///						描画コマンドの分析
+namespace RenderCommandAnalyzer {
+	/**----------------------------------------------------------------------------
+	 * \brief  Analyze コマンド列の分析
+	 * \param  commands 実行順に並んだコマンド列
+	 * \return 分析結果
+	 * \note   ルートシグネチャが別のものに切り替わるとルート引数は未設定に戻る(D3D12と同じ)
+	 */
+	RenderCommandReport Analyze(const std::vector<RenderCommand>& commands);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Format 分析結果を文字列に
+	 * \param  report 分析結果
+	 * \param  maxRows PSO・候補の一覧に載せる最大行数
+	 * \return 複数行の文字列
+	 */
+	std::string Format(const RenderCommandReport& report, size_t maxRows = 8);
+}
@@ -0,0 +1,147 @@
+/*********************************************************************
+ * \file   RenderCommandLog.cpp
+ * \brief  描画コマンド列の保存・読み込み・再生(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "RenderCommandLog.h"
+#include <cstring>
+#include <fstream>
+
+namespace {
+	//========================================
+	// ファイルヘッダー
+	struct LogHeader {
+		char magic[4] = { 'M', 'R', 'C', 'L' };
+		uint32_t version = 2;
+		uint64_t commandCount = 0;
+	};
+	const LogHeader kHeader{};
+
+	/// \brief 記録した値をポインタに戻す
+	template<class T>
+	T* ToPointer(uint64_t value) {
+		return reinterpret_cast<T*>( static_cast<uintptr_t>( value ) );
+	}
+}
+
+///=============================================================================
+///						保存
+bool RenderCommandLog::Save(const std::filesystem::path& path, const std::vector<RenderCommand>& commands) {
+	std::error_code errorCode;
+	if(path.has_parent_path()) {
+		std::filesystem::create_directories(path.parent_path(), errorCode);
+	}
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if(!file) {
+		return false;
+	}
+	LogHeader header = kHeader;
+	header.commandCount = commands.size();
+	file.write(reinterpret_cast<const char*>( &header ), sizeof(header));
+	file.write(reinterpret_cast<const char*>( commands.data() ), static_cast<std::streamsize>( commands.size() * sizeof(RenderCommand) ));
+	return static_cast<bool>( file );
+}
+
+///=============================================================================
+///						読み込み
+bool RenderCommandLog::Load(const std::filesystem::path& path, std::vector<RenderCommand>& commands) {
+	std::ifstream file(path, std::ios::binary);
+	if(!file) {
+		return false;
+	}
+	LogHeader header;
+	file.read(reinterpret_cast<char*>( &header ), sizeof(header));
+	if(!file || std::memcmp(header.magic, kHeader.magic, sizeof(header.magic)) != 0 || header.version != kHeader.version) {
+		return false;
+	}
+	//壊れたファイルで巨大な確保をしないよう、残りのサイズと突き合わせる
+	std::error_code errorCode;
+	uint64_t fileSize = std::filesystem::file_size(path, errorCode);
+	if(errorCode || header.commandCount > ( fileSize - sizeof(header) ) / sizeof(RenderCommand)) {
+		return false;
+	}
+	std::vector<RenderCommand> loaded(static_cast<size_t>( header.commandCount ));
+	file.read(reinterpret_cast<char*>( loaded.data() ), static_cast<std::streamsize>( loaded.size() * sizeof(RenderCommand) ));
+	if(!file) {
+		return false;
+	}
+	for(const RenderCommand& command : loaded) {
+		if(command.type >= RenderCommandType::kCount) {
+			return false;
+		}
+	}
+	commands = std::move(loaded);
+	return true;
+}
+
+///=============================================================================
+///						再生
+void RenderCommandLog::Replay(const std::vector<RenderCommand>& commands, BaseCommandList* commandList) {
+	for(const RenderCommand& command : commands) {
+		switch(command.type) {
+		case RenderCommandType::kSetDescriptorHeaps:
+		{
+			ID3D12DescriptorHeap* heap = ToPointer<ID3D12DescriptorHeap>(command.value);
+			commandList->SetDescriptorHeaps(command.args[0] > 0 ? 1 : 0, &heap);
+			break;
+		}
+		case RenderCommandType::kSetGraphicsRootSignature:
+			commandList->SetGraphicsRootSignature(ToPointer<ID3D12RootSignature>(command.value));
+			break;
+		case RenderCommandType::kSetPipelineState:
+			commandList->SetPipelineState(ToPointer<ID3D12PipelineState>(command.value));
+			break;
+		case RenderCommandType::kIASetPrimitiveTopology:
+			commandList->IASetPrimitiveTopology(static_cast<PrimitiveTopology>( command.args[0] ));
+			break;
+		case RenderCommandType::kIASetVertexBuffer:
+		{
+			VertexBufferView view{ command.value, command.args[0], command.args[1] };
+			commandList->IASetVertexBuffers(command.index, 1, &view);
+			break;
+		}
+		case RenderCommandType::kIASetIndexBuffer:
+			commandList->IASetIndexBuffer(IndexBufferView{ command.value, command.args[0], static_cast<IndexFormat>( command.args[1] ) });
+			break;
+		case RenderCommandType::kSetGraphicsRootConstantBufferView:
+			commandList->SetGraphicsRootConstantBufferView(command.index, command.value);
+			break;
+		case RenderCommandType::kSetGraphicsRootShaderResourceView:
+			commandList->SetGraphicsRootShaderResourceView(command.index, command.value);
+			break;
+		case RenderCommandType::kSetGraphicsRootDescriptorTable:
+			commandList->SetGraphicsRootDescriptorTable(command.index, command.value);
+			break;
+		case RenderCommandType::kDrawInstanced:
+			commandList->DrawInstanced(command.args[0], command.args[1], command.args[2], command.args[3]);
+			break;
+		case RenderCommandType::kDrawIndexedInstanced:
+			commandList->DrawIndexedInstanced(command.args[0], command.args[1], command.args[2], static_cast<int32_t>( command.args[3] ), command.args[4]);
+			break;
+		case RenderCommandType::kTransitionBarrier:
+		{
+			ResourceBarrierDesc barrier;
+			barrier.type = ResourceBarrierDesc::Type::kTransition;
+			barrier.resource = ToPointer<ID3D12Resource>(command.value);
+			barrier.before = static_cast<ResourceState>( command.args[0] );
+			barrier.after = static_cast<ResourceState>( command.args[1] );
+			commandList->ResourceBarriers(1, &barrier);
+			break;
+		}
+		case RenderCommandType::kAliasingBarrier:
+		{
+			ResourceBarrierDesc barrier;
+			barrier.type = ResourceBarrierDesc::Type::kAliasing;
+			barrier.resource = ToPointer<ID3D12Resource>(command.value);
+			barrier.resourceBefore = ToPointer<ID3D12Resource>(command.other);
+			commandList->ResourceBarriers(1, &barrier);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
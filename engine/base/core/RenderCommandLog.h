@@ -0,0 +1,43 @@
+/*********************************************************************
+ * \file   RenderCommandLog.h
+ * \brief  描画コマンド列の保存・読み込み・再生(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   ファイルはヘッダーのあとにRenderCommandをそのまま並べた形式。
+ *         記録されたポインタ値は取り込んだプロセスでしか意味を持たないので、
+ *         再生はNull版などGPUを使わない発行先に対して行う(CPU側の計測用)
+ *********************************************************************/
+#pragma once
+#include "BaseCommandList.h"
+#include "RenderCommand.h"
+#include <filesystem>
+#include <vector>
+
+///=============================================================================
+///						描画コマンドのログ
+namespace RenderCommandLog {
+	/**----------------------------------------------------------------------------
+	 * \brief  Save コマンド列の保存
+	 * \param  path 保存先
+	 * \param  commands コマンド列
+	 * \return 書き込めたか
+	 */
+	bool Save(const std::filesystem::path& path, const std::vector<RenderCommand>& commands);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Load コマンド列の読み込み
+	 * \param  path 読み込むファイル
+	 * \param  commands 読み込んだコマンド列
+	 * \return 読み込めたか(形式やバージョンが違う場合もfalse)
+	 */
+	bool Load(const std::filesystem::path& path, std::vector<RenderCommand>& commands);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Replay コマンド列の再生
+	 * \param  commands コマンド列
+	 * \param  commandList 再生先
+	 * \note   ディスクリプタヒープは先頭の1つだけを記録しているので1つとして再生する
+	 */
+	void Replay(const std::vector<RenderCommand>& commands, BaseCommandList* commandList);
+}
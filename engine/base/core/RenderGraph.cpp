@@ -0,0 +1,324 @@
+/*********************************************************************
+ * \file   RenderGraph.cpp
+ * \brief  描画パスの依存関係からバリアとメモリの割り当てを決めるレンダーグラフ(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "RenderGraph.h"
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <queue>
+
+namespace {
+	/// \brief アライメントに切り上げ
+	uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+		return ( value + alignment - 1 ) & ~( alignment - 1 );
+	}
+}
+
+///=============================================================================
+///						外部のリソースを登録
+RenderGraph::ResourceHandle RenderGraph::ImportResource(const std::string& name, ResourceState initialState, ResourceState finalState) {
+	Resource resource;
+	resource.name = name;
+	resource.initialState = initialState;
+	resource.finalState = finalState;
+	resources_.push_back(resource);
+	return static_cast<ResourceHandle>( resources_.size() - 1 );
+}
+
+///=============================================================================
+///						一時リソースを登録
+RenderGraph::ResourceHandle RenderGraph::CreateTransientResource(const std::string& name, uint64_t size, uint64_t alignment) {
+	assert(alignment != 0 && ( alignment & ( alignment - 1 ) ) == 0);
+	Resource resource;
+	resource.name = name;
+	resource.isTransient = true;
+	resource.size = size;
+	resource.alignment = alignment;
+	resources_.push_back(resource);
+	return static_cast<ResourceHandle>( resources_.size() - 1 );
+}
+
+///=============================================================================
+///						パスの追加
+RenderGraph::PassHandle RenderGraph::AddPass(const std::string& name, bool hasSideEffect) {
+	Pass pass;
+	pass.name = name;
+	pass.hasSideEffect = hasSideEffect;
+	passes_.push_back(pass);
+	return static_cast<PassHandle>( passes_.size() - 1 );
+}
+
+///=============================================================================
+///						読み取りの宣言
+void RenderGraph::Read(PassHandle pass, ResourceHandle resource, ResourceState state) {
+	assert(pass < passes_.size() && resource < resources_.size());
+	passes_[pass].accesses.push_back({ resource, state, false });
+}
+
+///=============================================================================
+///						書き込みの宣言
+void RenderGraph::Write(PassHandle pass, ResourceHandle resource, ResourceState state) {
+	assert(pass < passes_.size() && resource < resources_.size());
+	passes_[pass].accesses.push_back({ resource, state, true });
+}
+
+///=============================================================================
+///						宣言の破棄
+void RenderGraph::Clear() {
+	resources_.clear();
+	passes_.clear();
+}
+
+///=============================================================================
+///						同じリソースへのアクセスをまとめる
+std::vector<RenderGraph::Access> RenderGraph::MergeAccesses(const std::vector<Access>& accesses) {
+	std::vector<Access> merged;
+	for(const Access& access : accesses) {
+		auto it = std::find_if(merged.begin(), merged.end(), [&](const Access& m) { return m.resource == access.resource; });
+		if(it == merged.end()) {
+			merged.push_back(access);
+			continue;
+		}
+		//========================================
+		// 書き込みがあれば書き込みの状態、読み取り同士なら状態を合成
+		if(access.isWrite && it->isWrite) {
+			//深度の書き込みと読み取りの組み合わせ以外で、異なる状態への書き込みは宣言ミス
+			assert(it->state == access.state);
+		} else if(access.isWrite) {
+			it->state = access.state;
+			it->isWrite = true;
+		} else if(!it->isWrite) {
+			it->state = it->state | access.state;
+		}
+	}
+	return merged;
+}
+
+///=============================================================================
+///						コンパイル
+RenderGraph::CompiledGraph RenderGraph::Compile() const {
+	CompiledGraph compiled;
+	const uint32_t passCount = static_cast<uint32_t>( passes_.size() );
+	const uint32_t resourceCount = static_cast<uint32_t>( resources_.size() );
+
+	std::vector<std::vector<Access>> passAccesses(passCount);
+	for(uint32_t i = 0; i < passCount; ++i) {
+		passAccesses[i] = MergeAccesses(passes_[i].accesses);
+	}
+
+	//========================================
+	// 1.除外:後ろから辿り、出力(外部リソース)か副作用に繋がるパスだけを残す
+	std::vector<bool> isNeeded(resourceCount, false);
+	for(uint32_t r = 0; r < resourceCount; ++r) {
+		isNeeded[r] = !resources_[r].isTransient;
+	}
+	std::vector<bool> isLive(passCount, false);
+	for(uint32_t i = passCount; i-- > 0;) {
+		bool isLivePass = passes_[i].hasSideEffect;
+		for(const Access& access : passAccesses[i]) {
+			if(access.isWrite && isNeeded[access.resource]) {
+				isLivePass = true;
+			}
+		}
+		if(!isLivePass) {
+			compiled.culledPasses.push_back(i);
+			continue;
+		}
+		isLive[i] = true;
+		//描画先への書き込みは前の内容に重ねるので、書き込むリソースも前のパスの出力が必要
+		for(const Access& access : passAccesses[i]) {
+			isNeeded[access.resource] = true;
+		}
+	}
+	std::reverse(compiled.culledPasses.begin(), compiled.culledPasses.end());
+
+	//========================================
+	// 2.実行順:読み書きの依存関係で並べる(依存のないパス同士は宣言順)
+	std::vector<std::vector<uint32_t>> successors(passCount);
+	std::vector<uint32_t> predecessorCount(passCount, 0);
+	{
+		std::vector<uint32_t> lastWriter(resourceCount, kInvalidHandle);
+		std::vector<std::vector<uint32_t>> readersSinceWrite(resourceCount);
+		auto addEdge = [&](uint32_t from, uint32_t to) {
+			if(from == kInvalidHandle || from == to) {
+				return;
+			}
+			if(std::find(successors[from].begin(), successors[from].end(), to) == successors[from].end()) {
+				successors[from].push_back(to);
+				++predecessorCount[to];
+			}
+		};
+		for(uint32_t i = 0; i < passCount; ++i) {
+			if(!isLive[i]) {
+				continue;
+			}
+			for(const Access& access : passAccesses[i]) {
+				addEdge(lastWriter[access.resource], i);
+				if(access.isWrite) {
+					for(uint32_t reader : readersSinceWrite[access.resource]) {
+						addEdge(reader, i);
+					}
+					readersSinceWrite[access.resource].clear();
+					lastWriter[access.resource] = i;
+				} else {
+					readersSinceWrite[access.resource].push_back(i);
+				}
+			}
+		}
+	}
+	std::vector<uint32_t> order;
+	{
+		std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ready;
+		for(uint32_t i = 0; i < passCount; ++i) {
+			if(isLive[i] && predecessorCount[i] == 0) {
+				ready.push(i);
+			}
+		}
+		while(!ready.empty()) {
+			uint32_t pass = ready.top();
+			ready.pop();
+			order.push_back(pass);
+			for(uint32_t next : successors[pass]) {
+				if(--predecessorCount[next] == 0) {
+					ready.push(next);
+				}
+			}
+		}
+	}
+
+	//========================================
+	// 3.バリア:パスの前に必要な遷移をまとめ、同じ状態・読み取り同士の遷移は省く
+	const uint32_t kUnused = kInvalidHandle;
+	std::vector<ResourceState> currentStates(resourceCount, ResourceState::kCommon);
+	std::vector<bool> isInitialized(resourceCount, false);
+	std::vector<ResourceState> transientFirstStates(resourceCount, ResourceState::kCommon);
+	std::vector<uint32_t> firstUse(resourceCount, kUnused);
+	std::vector<uint32_t> lastUse(resourceCount, kUnused);
+	for(uint32_t r = 0; r < resourceCount; ++r) {
+		if(!resources_[r].isTransient) {
+			currentStates[r] = resources_[r].initialState;
+			isInitialized[r] = true;
+		}
+	}
+	for(uint32_t position = 0; position < order.size(); ++position) {
+		CompiledPass compiledPass;
+		compiledPass.pass = order[position];
+		for(const Access& access : passAccesses[order[position]]) {
+			ResourceHandle r = access.resource;
+			if(firstUse[r] == kUnused) {
+				firstUse[r] = position;
+			}
+			lastUse[r] = position;
+			//一時リソースの最初の遷移はフレームの終わりの状態が決まってから入れる
+			if(!isInitialized[r]) {
+				currentStates[r] = access.state;
+				transientFirstStates[r] = access.state;
+				isInitialized[r] = true;
+				continue;
+			}
+			ResourceState before = currentStates[r];
+			ResourceState after = access.state;
+			if(before == after) {
+				continue;
+			}
+			if(!access.isWrite && IsReadOnlyState(before) && IsReadOnlyState(after)) {
+				//既に読める状態なら遷移不要。足りなければ読み取り状態を合成して往復を避ける
+				if(HasAllStates(before, after)) {
+					continue;
+				}
+				after = before | after;
+			}
+			compiledPass.barriers.push_back({ r, before, after });
+			currentStates[r] = after;
+		}
+		compiled.passes.push_back(std::move(compiledPass));
+	}
+	//========================================
+	// フレームの終わり:外部は指定の状態へ戻す
+	// 一時リソースは最後の状態のまま次のフレームを迎えるので、最初に使うパスの先頭で遷移する
+	// (エイリアシングで有効になった後でないと遷移できないため、フレームの終わりではなくこちらで行う)
+	for(uint32_t r = 0; r < resourceCount; ++r) {
+		if(!isInitialized[r]) {
+			continue;
+		}
+		if(resources_[r].isTransient) {
+			if(currentStates[r] != transientFirstStates[r]) {
+				auto& barriers = compiled.passes[firstUse[r]].barriers;
+				barriers.insert(barriers.begin(), { r, currentStates[r], transientFirstStates[r] });
+			}
+			continue;
+		}
+		if(currentStates[r] != resources_[r].finalState) {
+			compiled.finalBarriers.push_back({ r, currentStates[r], resources_[r].finalState });
+		}
+	}
+
+	//========================================
+	// 4.メモリ共有:寿命の重ならない一時リソースを共有ヒープの同じ場所に置く
+	struct Allocation {
+		ResourceHandle resource;
+		uint64_t offset;
+		uint64_t size;
+	};
+	std::vector<ResourceHandle> transients;
+	for(uint32_t r = 0; r < resourceCount; ++r) {
+		if(resources_[r].isTransient && firstUse[r] != kUnused) {
+			transients.push_back(r);
+		}
+	}
+	//大きいものから置くと隙間が少ない
+	std::stable_sort(transients.begin(), transients.end(), [&](ResourceHandle a, ResourceHandle b) {
+		return resources_[a].size > resources_[b].size;
+	});
+	auto isLifetimeOverlapped = [&](ResourceHandle a, ResourceHandle b) {
+		return firstUse[a] <= lastUse[b] && firstUse[b] <= lastUse[a];
+	};
+	std::vector<Allocation> allocations;
+	for(ResourceHandle r : transients) {
+		//寿命が重なるものを位置順に並べ、入る隙間を先頭から探す
+		std::vector<Allocation> overlapped;
+		for(const Allocation& allocation : allocations) {
+			if(isLifetimeOverlapped(r, allocation.resource)) {
+				overlapped.push_back(allocation);
+			}
+		}
+		std::sort(overlapped.begin(), overlapped.end(), [](const Allocation& a, const Allocation& b) { return a.offset < b.offset; });
+		uint64_t offset = 0;
+		for(const Allocation& allocation : overlapped) {
+			if(offset + resources_[r].size <= allocation.offset) {
+				break;
+			}
+			offset = ( std::max )( offset, AlignUp(allocation.offset + allocation.size, resources_[r].alignment) );
+		}
+		allocations.push_back({ r, offset, resources_[r].size });
+		compiled.transientHeapSize = ( std::max )( compiled.transientHeapSize, offset + resources_[r].size );
+	}
+	//========================================
+	// 同じメモリを前に使っていたリソースがあれば、最初に使うパスの前でエイリアシングバリアを張る
+	for(const Allocation& allocation : allocations) {
+		ResourceHandle r = allocation.resource;
+		compiled.placements.push_back({ r, allocation.offset, currentStates[r] });
+		ResourceHandle previous = kInvalidHandle;
+		for(const Allocation& other : allocations) {
+			bool isMemoryOverlapped = other.offset < allocation.offset + allocation.size && allocation.offset < other.offset + other.size;
+			if(other.resource == r || !isMemoryOverlapped || lastUse[other.resource] >= firstUse[r]) {
+				continue;
+			}
+			if(previous == kInvalidHandle || lastUse[other.resource] > lastUse[previous]) {
+				previous = other.resource;
+			}
+		}
+		if(previous != kInvalidHandle) {
+			compiled.passes[firstUse[r]].aliasingBarriers.push_back({ previous, r });
+		}
+	}
+	std::sort(compiled.placements.begin(), compiled.placements.end(), [](const TransientPlacement& a, const TransientPlacement& b) {
+		return a.resource < b.resource;
+	});
+	return compiled;
+}
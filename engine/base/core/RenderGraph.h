@@ -0,0 +1,209 @@
+/*********************************************************************
+ * \file   RenderGraph.h
+ * \brief  描画パスの依存関係からバリアとメモリの割り当てを決めるレンダーグラフ(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   パスはリソースの読み書きを宣言するだけでよい。Compileで
+ *         ・誰も使わないパスの除外
+ *         ・依存関係に沿った実行順の決定
+ *         ・パスごとにまとめたバリアの配置
+ *         ・寿命の重ならない一時リソースのメモリ共有
+ *         を行う。GPUへの発行はDirectXRenderGraphが担当する
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///=============================================================================
+///						リソースの状態(ビットフラグ)
+enum class ResourceState : uint32_t {
+	kCommon = 0,
+	kRenderTarget = 1u << 0,
+	kDepthWrite = 1u << 1,
+	kDepthRead = 1u << 2,
+	kShaderResource = 1u << 3,
+	kUnorderedAccess = 1u << 4,
+	kCopySource = 1u << 5,
+	kCopyDest = 1u << 6,
+	kPresent = 1u << 7,
+};
+
+inline ResourceState operator|(ResourceState lhs, ResourceState rhs) {
+	return static_cast<ResourceState>( static_cast<uint32_t>( lhs ) | static_cast<uint32_t>( rhs ) );
+}
+
+inline bool HasAllStates(ResourceState states, ResourceState required) {
+	return ( static_cast<uint32_t>( states ) & static_cast<uint32_t>( required ) ) == static_cast<uint32_t>( required );
+}
+
+/// \brief 読み取り専用の状態か(読み取り同士は1つの状態にまとめられる)
+inline bool IsReadOnlyState(ResourceState state) {
+	constexpr uint32_t kReadOnlyMask = static_cast<uint32_t>( ResourceState::kDepthRead ) |
+		static_cast<uint32_t>( ResourceState::kShaderResource ) |
+		static_cast<uint32_t>( ResourceState::kCopySource );
+	uint32_t bits = static_cast<uint32_t>( state );
+	return bits != 0 && ( bits & ~kReadOnlyMask ) == 0;
+}
+
+///=============================================================================
+///						レンダーグラフ
+class RenderGraph {
+	///--------------------------------------------------------------
+	///							型定義
+public:
+	using ResourceHandle = uint32_t;
+	using PassHandle = uint32_t;
+	static constexpr uint32_t kInvalidHandle = 0xFFFFFFFF;
+
+	//========================================
+	// 状態遷移バリア
+	struct TransitionBarrier {
+		ResourceHandle resource;
+		ResourceState before;
+		ResourceState after;
+	};
+
+	//========================================
+	// エイリアシングバリア(同じメモリを使うリソースの切り替え)
+	struct AliasingBarrier {
+		ResourceHandle before;	// それまでメモリを使っていたリソース
+		ResourceHandle after;	// これから使うリソース
+	};
+
+	//========================================
+	// 実行するパス
+	struct CompiledPass {
+		PassHandle pass;								// 宣言時のパス
+		std::vector<AliasingBarrier> aliasingBarriers;	// パスの前に張るエイリアシングバリア
+		std::vector<TransitionBarrier> barriers;		// パスの前にまとめて張る遷移バリア
+	};
+
+	//========================================
+	// 一時リソースの配置
+	struct TransientPlacement {
+		ResourceHandle resource;
+		uint64_t heapOffset;		// 共有ヒープ内の位置
+		ResourceState initialState;	// 生成時の状態(フレームの終わりの状態。最初に使うパスで遷移する)
+	};
+
+	//========================================
+	// コンパイル結果
+	struct CompiledGraph {
+		std::vector<CompiledPass> passes;				// 実行順のパス
+		std::vector<TransitionBarrier> finalBarriers;	// 最後にまとめて張る遷移バリア
+		std::vector<TransientPlacement> placements;		// 一時リソースの配置
+		uint64_t transientHeapSize = 0;					// 共有ヒープに必要なサイズ
+		std::vector<PassHandle> culledPasses;			// 除外したパス
+	};
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  ImportResource 外部のリソースを登録
+	 * \param  name 名前
+	 * \param  initialState フレーム開始時の状態
+	 * \param  finalState フレーム終了時に戻す状態
+	 * \return ハンドル
+	 * \note   外部のリソースへの書き込みはグラフの出力とみなし、そのパスは除外しない
+	 */
+	ResourceHandle ImportResource(const std::string& name, ResourceState initialState, ResourceState finalState);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  CreateTransientResource フレーム内だけで使うリソースを登録
+	 * \param  name 名前
+	 * \param  size 必要なメモリサイズ
+	 * \param  alignment 配置アライメント(2のべき乗)
+	 * \return ハンドル
+	 */
+	ResourceHandle CreateTransientResource(const std::string& name, uint64_t size, uint64_t alignment);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  AddPass パスの追加
+	 * \param  name 名前
+	 * \param  hasSideEffect 出力がなくても除外しない(ImGuiなど)
+	 * \return ハンドル
+	 */
+	PassHandle AddPass(const std::string& name, bool hasSideEffect = false);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Read パスが読むリソースの宣言
+	 */
+	void Read(PassHandle pass, ResourceHandle resource, ResourceState state);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Write パスが書くリソースの宣言
+	 */
+	void Write(PassHandle pass, ResourceHandle resource, ResourceState state);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Compile 実行順・バリア・メモリ配置を決める
+	 * \return コンパイル結果
+	 */
+	CompiledGraph Compile() const;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Clear 宣言をすべて破棄
+	 */
+	void Clear();
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief パス名の取得
+	const std::string& GetPassName(PassHandle pass) const { return passes_[pass].name; }
+
+	/// \brief リソース名の取得
+	const std::string& GetResourceName(ResourceHandle resource) const { return resources_[resource].name; }
+
+	/// \brief 一時リソースか
+	bool IsTransient(ResourceHandle resource) const { return resources_[resource].isTransient; }
+
+	/// \brief パス数の取得
+	uint32_t GetPassCount() const { return static_cast<uint32_t>( passes_.size() ); }
+
+	/// \brief リソース数の取得
+	uint32_t GetResourceCount() const { return static_cast<uint32_t>( resources_.size() ); }
+
+	///--------------------------------------------------------------
+	///							静的メンバ関数
+private:
+	//========================================
+	// パス内のアクセス
+	struct Access {
+		ResourceHandle resource;
+		ResourceState state;
+		bool isWrite;
+	};
+
+	/**----------------------------------------------------------------------------
+	 * \brief  MergeAccesses 同じリソースへのアクセスを1つの状態にまとめる
+	 */
+	static std::vector<Access> MergeAccesses(const std::vector<Access>& accesses);
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// リソース
+	struct Resource {
+		std::string name;
+		bool isTransient = false;
+		ResourceState initialState = ResourceState::kCommon;
+		ResourceState finalState = ResourceState::kCommon;
+		uint64_t size = 0;
+		uint64_t alignment = 1;
+	};
+	std::vector<Resource> resources_;
+
+	//========================================
+	// パス
+	struct Pass {
+		std::string name;
+		bool hasSideEffect = false;
+		std::vector<Access> accesses;
+	};
+	std::vector<Pass> passes_;
+};
@@ -0,0 +1,109 @@
+/*********************************************************************
+ * \file   RenderQueue.cpp
+ * \brief  64bitのソートキーで並べ替える描画キュー(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "RenderQueue.h"
+#include <algorithm>
+#include <array>
+
+namespace {
+	/// \brief 下位bitsビットだけ残す
+	uint64_t Field(uint32_t value, uint32_t bits) {
+		return static_cast<uint64_t>( value ) & ( ( 1ull << bits ) - 1 );
+	}
+}
+
+///=============================================================================
+///						深度の量子化
+uint32_t RenderSortKey::QuantizeDepth(float viewDepth, float farClip) {
+	constexpr uint32_t kMaxDepth = ( 1u << kDepthBits ) - 1;
+	if(!( farClip > 0.0f ) || !( viewDepth > 0.0f )) {
+		return 0;
+	}
+	float normalized = ( std::min )( viewDepth / farClip, 1.0f );
+	return static_cast<uint32_t>( normalized * static_cast<float>( kMaxDepth ) );
+}
+
+///=============================================================================
+///						ソートキーの作成
+uint64_t RenderSortKey::Make(const RenderSortKeyDesc& desc) {
+	uint64_t key = Field(static_cast<uint32_t>( desc.pass ), kPassBits);
+	if(desc.pass == RenderQueuePass::kOpaque) {
+		//ステートでまとめ、その中で手前から奥へ
+		key = ( key << kPipelineBits ) | Field(desc.pipeline, kPipelineBits);
+		key = ( key << kMaterialBits ) | Field(desc.material, kMaterialBits);
+		key = ( key << kTextureBits ) | Field(desc.texture, kTextureBits);
+		key = ( key << kVariantBits ) | Field(desc.variant, kVariantBits);
+		key = ( key << kDepthBits ) | Field(desc.depth, kDepthBits);
+	} else {
+		//混ぜ合わせの結果が正しくなるよう深度を優先し、奥から手前へ(深度を反転)
+		key = ( key << kDepthBits ) | Field(~desc.depth, kDepthBits);
+		key = ( key << kPipelineBits ) | Field(desc.pipeline, kPipelineBits);
+		key = ( key << kMaterialBits ) | Field(desc.material, kMaterialBits);
+		key = ( key << kTextureBits ) | Field(desc.texture, kTextureBits);
+		key = ( key << kVariantBits ) | Field(desc.variant, kVariantBits);
+	}
+	return key;
+}
+
+///=============================================================================
+///						基数ソート
+RenderPacket* RadixSortRenderPackets(RenderPacket* packets, RenderPacket* scratch, size_t count) {
+	constexpr uint32_t kDigitCount = 8;
+	constexpr uint32_t kRadix = 256;
+	if(count == 0) {
+		return packets;
+	}
+	//========================================
+	// 全桁のヒストグラムを1回の走査で作る
+	std::array<std::array<uint32_t, kRadix>, kDigitCount> histograms{};
+	for(size_t i = 0; i < count; ++i) {
+		uint64_t key = packets[i].key;
+		for(uint32_t digit = 0; digit < kDigitCount; ++digit) {
+			++histograms[digit][( key >> ( digit * 8 ) ) & 0xff];
+		}
+	}
+
+	//========================================
+	// 下の桁から安定に振り分ける
+	RenderPacket* source = packets;
+	RenderPacket* destination = scratch;
+	for(uint32_t digit = 0; digit < kDigitCount; ++digit) {
+		std::array<uint32_t, kRadix>& histogram = histograms[digit];
+		//全パケットが同じ値の桁は並びが変わらないので飛ばす
+		uint32_t firstKey = static_cast<uint32_t>( ( source[0].key >> ( digit * 8 ) ) & 0xff );
+		if(histogram[firstKey] == count) {
+			continue;
+		}
+		//書き込み位置(累積和)
+		uint32_t offset = 0;
+		for(uint32_t& bucket : histogram) {
+			uint32_t bucketCount = bucket;
+			bucket = offset;
+			offset += bucketCount;
+		}
+		for(size_t i = 0; i < count; ++i) {
+			destination[histogram[( source[i].key >> ( digit * 8 ) ) & 0xff]++] = source[i];
+		}
+		std::swap(source, destination);
+	}
+	return source;
+}
+
+///=============================================================================
+///						並べ替え
+void RenderQueue::Sort() {
+	if(packets_.size() < 2) {
+		return;
+	}
+	scratch_.resize(packets_.size());
+	RenderPacket* result = RadixSortRenderPackets(packets_.data(), scratch_.data(), packets_.size());
+	//結果が作業用に入っていれば入れ替えるだけで済ませる
+	if(result != packets_.data()) {
+		packets_.swap(scratch_);
+	}
+}
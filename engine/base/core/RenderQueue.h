@@ -0,0 +1,121 @@
+/*********************************************************************
+ * \file   RenderQueue.h
+ * \brief  64bitのソートキーで並べ替える描画キュー(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   描画をパケット(キーと呼び出し側の添え字)として集め、フレームごとに
+ *         基数ソートする。キーは上位からパス→ステート→深度の順に詰めるので、
+ *         不透明はステートごとに手前から奥へ、半透明は奥から手前へ並ぶ
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///=============================================================================
+///						描画パス(キーの最上位。小さいほど先に描く)
+enum class RenderQueuePass : uint32_t {
+	kOpaque = 0,		// 不透明(手前から奥へ。早期深度テストが効く)
+	kTransparent = 1,	// 半透明(奥から手前へ)
+	kParticle = 2,		// パーティクル(奥から手前へ)
+};
+
+///=============================================================================
+///						ソートキーの元になる値
+struct RenderSortKeyDesc {
+	RenderQueuePass pass = RenderQueuePass::kOpaque;
+	uint32_t pipeline = 0;	// PSOの番号(8bit)
+	uint32_t material = 0;	// マテリアルの番号(12bit)
+	uint32_t texture = 0;	// テクスチャの番号(12bit)
+	uint32_t variant = 0;	// 同じマテリアルで定数だけ違う組の番号(4bit。ライト・カメラなど)
+	uint32_t depth = 0;		// QuantizeDepthで量子化した深度(24bit)
+};
+
+///=============================================================================
+///						ソートキー
+namespace RenderSortKey {
+	//========================================
+	// 各フィールドのビット数
+	constexpr uint32_t kPassBits = 4;
+	constexpr uint32_t kPipelineBits = 8;
+	constexpr uint32_t kMaterialBits = 12;
+	constexpr uint32_t kTextureBits = 12;
+	constexpr uint32_t kVariantBits = 4;
+	constexpr uint32_t kDepthBits = 24;
+	static_assert(kPassBits + kPipelineBits + kMaterialBits + kTextureBits + kVariantBits + kDepthBits == 64);
+
+	/// \brief 深度を除いた部分(同じなら1つの描画にまとめられる)を取り出すシフト量(不透明用)
+	constexpr uint32_t kStateShift = kDepthBits;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  QuantizeDepth 深度の量子化
+	 * \param  viewDepth カメラからの距離(ビュー空間のZ)
+	 * \param  farClip ファークリップ(これより奥は同じ値になる)
+	 * \return 24bitの深度
+	 */
+	uint32_t QuantizeDepth(float viewDepth, float farClip);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Make ソートキーの作成
+	 * \param  desc キーの元になる値(ビット数を超えた分は切り捨てる)
+	 * \return 不透明は パス|PSO|マテリアル|テクスチャ|組|深度、
+	 *         それ以外は パス|反転した深度|PSO|マテリアル|テクスチャ|組 の順に詰めたキー
+	 */
+	uint64_t Make(const RenderSortKeyDesc& desc);
+}
+
+///=============================================================================
+///						描画パケット
+struct RenderPacket {
+	uint64_t key = 0;		// ソートキー
+	uint32_t index = 0;		// 呼び出し側の描画データの添え字
+	uint32_t reserved = 0;
+};
+
+/**----------------------------------------------------------------------------
+ * \brief  RadixSortRenderPackets パケットをキーの昇順に基数ソート(安定)
+ * \param  packets ソートするパケット
+ * \param  scratch 作業用(packetsと同じ数以上)
+ * \param  count パケット数
+ * \return 結果が入っている方(packetsかscratch)
+ * \note   8bitずつ8回。全パケットで同じ桁は飛ばすので、上位が空いていれば速い
+ */
+RenderPacket* RadixSortRenderPackets(RenderPacket* packets, RenderPacket* scratch, size_t count);
+
+///=============================================================================
+///						描画キュー
+class RenderQueue {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/// \brief 空にする(確保したメモリは残す)
+	void Clear() { packets_.clear(); }
+
+	/// \brief 容量の確保
+	void Reserve(size_t count) { packets_.reserve(count); }
+
+	/// \brief パケットの追加
+	void Push(uint64_t key, uint32_t index) { packets_.push_back(RenderPacket{ key, index, 0 }); }
+
+	/// \brief キーの昇順に並べ替える(同じキーは追加順)
+	void Sort();
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief パケットの取得(Sortの後なら並べ替え済み)
+	const std::vector<RenderPacket>& GetPackets() const { return packets_; }
+
+	/// \brief パケット数の取得
+	size_t GetSize() const { return packets_.size(); }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// パケット
+	std::vector<RenderPacket> packets_;
+	// ソートの作業用
+	std::vector<RenderPacket> scratch_;
+};
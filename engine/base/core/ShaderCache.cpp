@@ -0,0 +1,179 @@
+/*********************************************************************
+ * \file   ShaderCache.cpp
+ * \brief  コンパイル済みシェーダーをディスクに保存して再利用するキャッシュ(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "ShaderCache.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace {
+	//========================================
+	// FNV-1aの初期値と素数
+	constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+	constexpr uint64_t kFnvPrime = 1099511628211ull;
+	// キャッシュの形式が変わったら上げる
+	constexpr uint32_t kCacheVersion = 1;
+}
+
+///=============================================================================
+///						初期化
+void ShaderCache::Initialize(const std::filesystem::path& cacheDirectory) {
+	cacheDirectory_ = cacheDirectory;
+	std::error_code errorCode;
+	std::filesystem::create_directories(cacheDirectory_, errorCode);
+}
+
+///=============================================================================
+///						キャッシュキーの計算
+uint64_t ShaderCache::ComputeKey(const std::filesystem::path& sourcePath, const std::wstring& profile, const std::vector<std::wstring>& arguments) {
+	uint64_t hash = kFnvOffsetBasis;
+	HashBytes(hash, &kCacheVersion, sizeof(kCacheVersion));
+	//========================================
+	// ソースとinclude先
+	std::vector<std::filesystem::path> visited;
+	if(!HashFile(sourcePath, hash, visited)) {
+		return 0;
+	}
+	//========================================
+	// プロファイルと引数(区切りも含めて順序の違いを区別する)
+	HashBytes(hash, profile.data(), profile.size() * sizeof(wchar_t));
+	for(const std::wstring& argument : arguments) {
+		const wchar_t separator = L'\0';
+		HashBytes(hash, &separator, sizeof(separator));
+		HashBytes(hash, argument.data(), argument.size() * sizeof(wchar_t));
+	}
+	//0は読み込み失敗を表すので避ける
+	return hash != 0 ? hash : 1;
+}
+
+///=============================================================================
+///						キャッシュの検索
+bool ShaderCache::Find(uint64_t key, std::vector<uint8_t>& outBytecode) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	//========================================
+	// メモリ
+	auto it = entries_.find(key);
+	if(it != entries_.end()) {
+		outBytecode = it->second;
+		++hitCount_;
+		return true;
+	}
+	//========================================
+	// ディスク
+	if(!cacheDirectory_.empty()) {
+		std::ifstream file(GetCacheFilePath(key), std::ios::binary);
+		if(file) {
+			std::vector<uint8_t> bytecode(( std::istreambuf_iterator<char>(file) ), std::istreambuf_iterator<char>());
+			if(!bytecode.empty()) {
+				outBytecode = bytecode;
+				entries_.emplace(key, std::move(bytecode));
+				++hitCount_;
+				return true;
+			}
+		}
+	}
+	++missCount_;
+	return false;
+}
+
+///=============================================================================
+///						キャッシュへの登録
+void ShaderCache::Store(uint64_t key, const void* data, size_t size) {
+	const uint8_t* bytes = static_cast<const uint8_t*>( data );
+	std::lock_guard<std::mutex> lock(mutex_);
+	entries_[key].assign(bytes, bytes + size);
+	if(cacheDirectory_.empty()) {
+		return;
+	}
+	//========================================
+	// 書きかけのファイルを読まないよう、一時ファイルに書いてから置き換える
+	std::filesystem::path path = GetCacheFilePath(key);
+	std::filesystem::path temporaryPath = path;
+	temporaryPath += ".tmp";
+	{
+		std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		if(!file) {
+			return;
+		}
+		file.write(reinterpret_cast<const char*>( bytes ), static_cast<std::streamsize>( size ));
+		if(!file) {
+			return;
+		}
+	}
+	std::error_code errorCode;
+	std::filesystem::rename(temporaryPath, path, errorCode);
+	if(errorCode) {
+		std::filesystem::remove(temporaryPath, errorCode);
+	}
+}
+
+///=============================================================================
+///						ファイルとinclude先のハッシュ
+bool ShaderCache::HashFile(const std::filesystem::path& path, uint64_t& hash, std::vector<std::filesystem::path>& visited) {
+	std::error_code errorCode;
+	std::filesystem::path normalizedPath = std::filesystem::weakly_canonical(path, errorCode);
+	if(errorCode) {
+		normalizedPath = path.lexically_normal();
+	}
+	if(std::find(visited.begin(), visited.end(), normalizedPath) != visited.end()) {
+		return true;
+	}
+	visited.push_back(normalizedPath);
+
+	//========================================
+	// 内容
+	std::ifstream file(path, std::ios::binary);
+	if(!file) {
+		return false;
+	}
+	std::string source(( std::istreambuf_iterator<char>(file) ), std::istreambuf_iterator<char>());
+	HashBytes(hash, source.data(), source.size());
+
+	//========================================
+	// #include "..." を辿る(DXCの既定のインクルードハンドラと同じく同じフォルダ基準)
+	std::istringstream lines(source);
+	std::string line;
+	while(std::getline(lines, line)) {
+		size_t begin = line.find_first_not_of(" \t");
+		if(begin == std::string::npos || line.compare(begin, 8, "#include") != 0) {
+			continue;
+		}
+		size_t open = line.find('"', begin + 8);
+		size_t close = open == std::string::npos ? std::string::npos : line.find('"', open + 1);
+		if(close == std::string::npos) {
+			continue;
+		}
+		std::filesystem::path includePath = path.parent_path() / line.substr(open + 1, close - open - 1);
+		//見つからないincludeはコンパイル時にエラーになるので、ここではパスだけ混ぜる
+		if(!HashFile(includePath, hash, visited)) {
+			std::string missing = includePath.generic_string();
+			HashBytes(hash, missing.data(), missing.size());
+		}
+	}
+	return true;
+}
+
+///=============================================================================
+///						FNV-1a
+void ShaderCache::HashBytes(uint64_t& hash, const void* data, size_t size) {
+	const uint8_t* bytes = static_cast<const uint8_t*>( data );
+	for(size_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= kFnvPrime;
+	}
+}
+
+///=============================================================================
+///						キャッシュファイルのパス
+std::filesystem::path ShaderCache::GetCacheFilePath(uint64_t key) const {
+	char fileName[32] = {};
+	std::snprintf(fileName, sizeof(fileName), "%016llx.cso", static_cast<unsigned long long>( key ));
+	return cacheDirectory_ / fileName;
+}
@@ -0,0 +1,105 @@
+/*********************************************************************
+ * \file   ShaderCache.h
+ * \brief  コンパイル済みシェーダーをディスクに保存して再利用するキャッシュ(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   キーはソース・include先・プロファイル・コンパイル引数の内容から作るので、
+ *         どれかを書き換えれば自動で再コンパイルされる
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///=============================================================================
+///						シェーダーキャッシュ
+class ShaderCache {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  cacheDirectory キャッシュファイルの保存先(なければ作る)
+	 */
+	void Initialize(const std::filesystem::path& cacheDirectory);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  ComputeKey キャッシュキーの計算
+	 * \param  sourcePath シェーダーファイルのパス
+	 * \param  profile プロファイル
+	 * \param  arguments コンパイル引数
+	 * \return キー ソースが読めなければ0
+	 * \note   #include "..." で参照しているファイルも再帰的に内容を含める
+	 */
+	static uint64_t ComputeKey(const std::filesystem::path& sourcePath, const std::wstring& profile, const std::vector<std::wstring>& arguments);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Find キャッシュの検索
+	 * \param  key キー
+	 * \param  outBytecode 見つかったバイトコード
+	 * \return 見つかったか
+	 * \note   メモリになければディスクを探す。複数スレッドから呼んでよい
+	 */
+	bool Find(uint64_t key, std::vector<uint8_t>& outBytecode);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Store キャッシュへの登録
+	 * \param  key キー
+	 * \param  data バイトコード
+	 * \param  size サイズ
+	 * \note   メモリとディスクの両方に保存する。複数スレッドから呼んでよい
+	 */
+	void Store(uint64_t key, const void* data, size_t size);
+
+	///--------------------------------------------------------------
+	///							静的メンバ関数
+private:
+	/**----------------------------------------------------------------------------
+	 * \brief  HashFile ファイルとそのinclude先の内容をハッシュに加える
+	 * \param  path ファイルパス
+	 * \param  hash ハッシュ値
+	 * \param  visited 処理済みのファイル(循環include対策)
+	 * \return 読めたか
+	 */
+	static bool HashFile(const std::filesystem::path& path, uint64_t& hash, std::vector<std::filesystem::path>& visited);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  HashBytes FNV-1aでハッシュに加える
+	 */
+	static void HashBytes(uint64_t& hash, const void* data, size_t size);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetCacheFilePath キャッシュファイルのパスの取得
+	 */
+	std::filesystem::path GetCacheFilePath(uint64_t key) const;
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief ヒット数の取得
+	uint32_t GetHitCount() const { return hitCount_; }
+
+	/// \brief ミス数の取得
+	uint32_t GetMissCount() const { return missCount_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 保存先
+	std::filesystem::path cacheDirectory_;
+
+	//========================================
+	// 読み込み済みのバイトコード
+	std::unordered_map<uint64_t, std::vector<uint8_t>> entries_;
+	std::mutex mutex_;
+
+	//========================================
+	// 統計
+	uint32_t hitCount_ = 0;
+	uint32_t missCount_ = 0;
+};
@@ -20,26 +20,67 @@ void SrvSetup::Initialize(DirectXCore* dxCore) {
 	descriptorHeap_ = dxCore_->CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, kMaxSRVCount_, true);
 	//ディスクリプタ1個分のサイズを取得して記録
 	descriptorSizeSRV_ = dxCore_->GetDevice()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+	//========================================
+	// 割り当て管理の初期化
+	allocator_.Initialize(kMaxSRVCount_);
 }
 
 ///=============================================================================
 ///						ループ前処理
 void SrvSetup::PreDraw() {
+	//========================================
+	// GPUが使い終わったディスクリプタを回収
+	allocator_.ReleaseCompleted(dxCore_->GetCompletedFenceValue());
+
+	//========================================
+	// ディスクリプタヒープの設定
+	SetDescriptorHeap();
+}
+
+///=============================================================================
+///						ディスクリプタヒープの設定
+void SrvSetup::SetDescriptorHeap() {
 	ID3D12DescriptorHeap* descriptorHeaps[] = { descriptorHeap_.Get() };
-	dxCore_->GetCommandList()->SetDescriptorHeaps(1, descriptorHeaps);
+	dxCore_->GetRenderCommandList()->SetDescriptorHeaps(1, descriptorHeaps);
 }
 
 ///=============================================================================
 ///						メモリ確保
 uint32_t SrvSetup::Allocate() {
-	// returnする番号を一旦記録
-	uint32_t index = useIndex_;
-	//次に使用するディスクリプタのインデックスを進める
-	useIndex_++;
-	//上で記録した番号を返す
+	return AllocateRange(1);
+}
+
+///=============================================================================
+///						連続したメモリ確保
+uint32_t SrvSetup::AllocateRange(uint32_t count) {
+	uint32_t index = allocator_.AllocateRange(count);
+	if(index == DescriptorAllocator::kInvalidIndex) {
+		Log("SrvSetup: SRV descriptor heap is full", LogLevel::Error);
+		assert(false && "SRV descriptor heap is full");
+	}
+	return index;
+}
+
+///=============================================================================
+///						フレーム内一時メモリ確保
+uint32_t SrvSetup::AllocateTransient(uint32_t count) {
+	// 現在記録中のコマンドは次にシグナルされるフェンス値で完了する
+	uint32_t index = allocator_.AllocateTransient(count, dxCore_->GetFenceValue() + 1);
+	if(index == DescriptorAllocator::kInvalidIndex) {
+		Log("SrvSetup: SRV descriptor heap is full (transient)", LogLevel::Error);
+		assert(false && "SRV descriptor heap is full");
+	}
 	return index;
 }
 
+///=============================================================================
+///						メモリ解放
+void SrvSetup::Free(uint32_t index, uint32_t count) {
+	// 記録中のコマンドが参照している可能性があるのでフェンス完了まで待つ
+	allocator_.FreeDeferred(index, count, dxCore_->GetFenceValue() + 1);
+}
+
 ///=============================================================================
 ///						SRV生成(テクスチャ用)
 void SrvSetup::CreateSRVforTexture2D(uint32_t srvIndex, ID3D12Resource* pResource, DXGI_FORMAT format, UINT mipLevels) {
@@ -98,8 +139,10 @@ D3D12_GPU_DESCRIPTOR_HANDLE SrvSetup::GetSRVGPUDescriptorHandle(uint32_t index)
 
 }
 
+///=============================================================================
+///						ルートディスクリプタテーブルの設定
 void SrvSetup::SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint32_t srvIndex) {
 	//========================================
 	// ルートディスクリプタテーブルの設定
-	dxCore_->GetCommandList()->SetGraphicsRootDescriptorTable(rootParameterIndex, GetSRVGPUDescriptorHandle(srvIndex));
+	dxCore_->GetRenderCommandList()->SetGraphicsRootDescriptorTable(rootParameterIndex, GetSRVGPUDescriptorHandle(srvIndex).ptr);
 }
@@ -8,6 +8,7 @@
  *********************************************************************/
 #pragma once
 #include "DirectXCore.h"
+#include "DescriptorAllocator.h"
 
 class SrvSetup {
 
@@ -23,13 +24,42 @@ public:
 	 */
 	void PreDraw();
 
+	/**----------------------------------------------------------------------------
+	 * \brief  SetDescriptorHeap 現在の記録先にSRVディスクリプタヒープを設定
+	 * \note   並列記録するコマンドリストごとに呼ぶ
+	 */
+	void SetDescriptorHeap();
+
 	/**----------------------------------------------------------------------------
 	 * \brief  Allocate メモリ確保
 	 * \return
 	 */
 	uint32_t Allocate();
 
-	bool IsFull() { return useIndex_ >= kMaxSRVCount_; }
+	/**----------------------------------------------------------------------------
+	 * \brief  AllocateRange 連続したディスクリプタの確保(ディスクリプタテーブル用)
+	 * \param  count 個数
+	 * \return 先頭インデックス
+	 */
+	uint32_t AllocateRange(uint32_t count);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  AllocateTransient 現在のフレームだけ使うディスクリプタの確保
+	 * \param  count 個数
+	 * \return 先頭インデックス
+	 * \note   このフレームのGPU処理完了後に自動で解放される
+	 */
+	uint32_t AllocateTransient(uint32_t count);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Free ディスクリプタの解放
+	 * \param  index 先頭インデックス
+	 * \param  count 個数
+	 * \note   GPUが現在のフレームを処理し終えてから再利用される
+	 */
+	void Free(uint32_t index, uint32_t count = 1);
+
+	bool IsFull() const { return allocator_.IsFull(); }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  CreateSRVforTexture2D SRV生成(テクスチャ用)
@@ -79,6 +109,11 @@ public:
 	 */
 	void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint32_t srvIndex);
 
+	/**----------------------------------------------------------------------------
+	 * \brief  GetStats ディスクリプタ使用状況の取得
+	 */
+	DescriptorAllocator::Stats GetStats() const { return allocator_.GetStats(); }
+
 	//========================================
 	// 最大SRV数
 	static const uint32_t kMaxSRVCount_ = 512;
@@ -97,8 +132,8 @@ private:
 	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> descriptorHeap_ = nullptr;
 
 	//========================================
-	// 次に使用するディスクリプタのインデックス
-	uint32_t useIndex_ = 0;
+	// ディスクリプタの割り当て管理
+	DescriptorAllocator allocator_;
 
 
 };
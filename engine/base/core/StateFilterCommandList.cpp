@@ -0,0 +1,166 @@
+/*********************************************************************
+ * \file   StateFilterCommandList.cpp
+ * \brief  同じ値の再設定を落としてから流す発行先(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "StateFilterCommandList.h"
+
+///=============================================================================
+///						状態の破棄
+void StateFilterCommandList::Invalidate() {
+	hasRootSignature_ = false;
+	hasPipelineState_ = false;
+	heapCount_ = 0;
+	InvalidateRootArguments();
+	hasTopology_ = false;
+	vertexBufferMask_ = 0;
+	hasIndexBuffer_ = false;
+}
+
+///=============================================================================
+///						ディスクリプタヒープ
+void StateFilterCommandList::SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) {
+	bool isSame = heapCount > 0 && heapCount == heapCount_;
+	for(uint32_t i = 0; isSame && i < heapCount; ++i) {
+		isSame = heaps[i] == heaps_[i];
+	}
+	if(Skip(isSame)) {
+		return;
+	}
+	//ヒープが変わるとそれまでのテーブルは指す先が変わるので覚え直す
+	InvalidateRootArguments();
+	heapCount_ = heapCount <= kMaxDescriptorHeaps ? heapCount : 0;
+	for(uint32_t i = 0; i < heapCount_; ++i) {
+		heaps_[i] = heaps[i];
+	}
+	target_->SetDescriptorHeaps(heapCount, heaps);
+}
+
+///=============================================================================
+///						ルートシグネチャ・PSO
+void StateFilterCommandList::SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) {
+	if(Skip(hasRootSignature_ && rootSignature == rootSignature_)) {
+		return;
+	}
+	//別のルートシグネチャに変わるとルート引数はすべて設定し直しになる
+	InvalidateRootArguments();
+	hasRootSignature_ = true;
+	rootSignature_ = rootSignature;
+	target_->SetGraphicsRootSignature(rootSignature);
+}
+
+void StateFilterCommandList::SetPipelineState(ID3D12PipelineState* pipelineState) {
+	if(Skip(hasPipelineState_ && pipelineState == pipelineState_)) {
+		return;
+	}
+	hasPipelineState_ = true;
+	pipelineState_ = pipelineState;
+	target_->SetPipelineState(pipelineState);
+}
+
+///=============================================================================
+///						入力アセンブラ
+void StateFilterCommandList::IASetPrimitiveTopology(PrimitiveTopology topology) {
+	if(Skip(hasTopology_ && topology == topology_)) {
+		return;
+	}
+	hasTopology_ = true;
+	topology_ = topology;
+	target_->IASetPrimitiveTopology(topology);
+}
+
+void StateFilterCommandList::IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) {
+	//覚えている範囲に収まり、すべてのスロットが同じときだけ落とす
+	bool isSame = startSlot + viewCount <= kMaxVertexBuffers && viewCount > 0;
+	for(uint32_t i = 0; isSame && i < viewCount; ++i) {
+		uint32_t slot = startSlot + i;
+		const VertexBufferView& bound = vertexBuffers_[slot];
+		isSame = ( vertexBufferMask_ & ( 1u << slot ) ) != 0 &&
+			bound.bufferLocation == views[i].bufferLocation &&
+			bound.sizeInBytes == views[i].sizeInBytes &&
+			bound.strideInBytes == views[i].strideInBytes;
+	}
+	if(Skip(isSame)) {
+		return;
+	}
+	//範囲をまたぐ設定でも、範囲内のスロットは覚え直す(古い値で落とさないように)
+	for(uint32_t slot = startSlot; slot < startSlot + viewCount && slot < kMaxVertexBuffers; ++slot) {
+		vertexBuffers_[slot] = views[slot - startSlot];
+		vertexBufferMask_ |= 1u << slot;
+	}
+	target_->IASetVertexBuffers(startSlot, viewCount, views);
+}
+
+void StateFilterCommandList::IASetIndexBuffer(const IndexBufferView& view) {
+	bool isSame = hasIndexBuffer_ &&
+		view.bufferLocation == indexBuffer_.bufferLocation &&
+		view.sizeInBytes == indexBuffer_.sizeInBytes &&
+		view.format == indexBuffer_.format;
+	if(Skip(isSame)) {
+		return;
+	}
+	hasIndexBuffer_ = true;
+	indexBuffer_ = view;
+	target_->IASetIndexBuffer(view);
+}
+
+///=============================================================================
+///						ルートパラメータ
+void StateFilterCommandList::SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	bool isTracked = rootParameterIndex < kMaxRootParameters;
+	bool isSame = isTracked && ( rootConstantBufferMask_ & ( 1u << rootParameterIndex ) ) != 0 &&
+		rootConstantBuffers_[rootParameterIndex] == gpuAddress;
+	if(Skip(isSame)) {
+		return;
+	}
+	if(isTracked) {
+		rootConstantBufferMask_ |= 1u << rootParameterIndex;
+		rootConstantBuffers_[rootParameterIndex] = gpuAddress;
+	}
+	target_->SetGraphicsRootConstantBufferView(rootParameterIndex, gpuAddress);
+}
+
+void StateFilterCommandList::SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) {
+	bool isTracked = rootParameterIndex < kMaxRootParameters;
+	bool isSame = isTracked && ( rootShaderResourceMask_ & ( 1u << rootParameterIndex ) ) != 0 &&
+		rootShaderResources_[rootParameterIndex] == gpuAddress;
+	if(Skip(isSame)) {
+		return;
+	}
+	if(isTracked) {
+		rootShaderResourceMask_ |= 1u << rootParameterIndex;
+		rootShaderResources_[rootParameterIndex] = gpuAddress;
+	}
+	target_->SetGraphicsRootShaderResourceView(rootParameterIndex, gpuAddress);
+}
+
+void StateFilterCommandList::SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) {
+	bool isTracked = rootParameterIndex < kMaxRootParameters;
+	bool isSame = isTracked && ( rootTableMask_ & ( 1u << rootParameterIndex ) ) != 0 &&
+		rootTables_[rootParameterIndex] == gpuDescriptor;
+	if(Skip(isSame)) {
+		return;
+	}
+	if(isTracked) {
+		rootTableMask_ |= 1u << rootParameterIndex;
+		rootTables_[rootParameterIndex] = gpuDescriptor;
+	}
+	target_->SetGraphicsRootDescriptorTable(rootParameterIndex, gpuDescriptor);
+}
+
+///=============================================================================
+///						描画・バリア(状態を持たないのでそのまま流す)
+void StateFilterCommandList::DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) {
+	target_->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+}
+
+void StateFilterCommandList::DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) {
+	target_->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+}
+
+void StateFilterCommandList::ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) {
+	target_->ResourceBarriers(barrierCount, barriers);
+}
@@ -0,0 +1,123 @@
+/*********************************************************************
+ * \file   StateFilterCommandList.h
+ * \brief  同じ値の再設定を落としてから流す発行先(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   ルートシグネチャ・PSO・ディスクリプタヒープ・ルートCBV・
+ *         ルートSRV・ディスクリプタテーブル・IAの状態を覚えておき、今と同じ値の設定は
+ *         発行先へ流さずに数えるだけにする。覚えている状態は記録先の
+ *         コマンドリスト1本分なので、記録先が変わったらInvalidateすること
+ *********************************************************************/
+#pragma once
+#include "BaseCommandList.h"
+#include <cstdint>
+
+///=============================================================================
+///						ステートフィルタ
+class StateFilterCommandList : public BaseCommandList {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	void SetDescriptorHeaps(uint32_t heapCount, ID3D12DescriptorHeap* const* heaps) override;
+	void SetGraphicsRootSignature(ID3D12RootSignature* rootSignature) override;
+	void SetPipelineState(ID3D12PipelineState* pipelineState) override;
+	void IASetPrimitiveTopology(PrimitiveTopology topology) override;
+	void IASetVertexBuffers(uint32_t startSlot, uint32_t viewCount, const VertexBufferView* views) override;
+	void IASetIndexBuffer(const IndexBufferView& view) override;
+	void SetGraphicsRootConstantBufferView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootShaderResourceView(uint32_t rootParameterIndex, uint64_t gpuAddress) override;
+	void SetGraphicsRootDescriptorTable(uint32_t rootParameterIndex, uint64_t gpuDescriptor) override;
+	void DrawInstanced(uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t startVertexLocation, uint32_t startInstanceLocation) override;
+	void DrawIndexedInstanced(uint32_t indexCountPerInstance, uint32_t instanceCount, uint32_t startIndexLocation, int32_t baseVertexLocation, uint32_t startInstanceLocation) override;
+	void ResourceBarriers(uint32_t barrierCount, const ResourceBarrierDesc* barriers) override;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Invalidate 覚えている状態をすべて捨てる
+	 * \note   記録先のコマンドリストが変わったとき、Resetしたとき、
+	 *         このクラスを通さずに状態を変えたときに呼ぶ
+	 */
+	void Invalidate();
+
+	/// \brief 件数のリセット
+	void ResetCounts() {
+		stateSetCount_ = 0;
+		skippedCount_ = 0;
+	}
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 流す先の設定
+	void SetTarget(BaseCommandList* target) { target_ = target; }
+
+	/// \brief 受け取った状態設定の件数
+	uint64_t GetStateSetCount() const { return stateSetCount_; }
+
+	/// \brief 同じ値だったので落とした件数
+	uint64_t GetSkippedCount() const { return skippedCount_; }
+
+	//========================================
+	// 覚えておく範囲(超えた分は常に流す)
+	static constexpr uint32_t kMaxRootParameters = 16;
+	static constexpr uint32_t kMaxVertexBuffers = 4;
+	static constexpr uint32_t kMaxDescriptorHeaps = 2;
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+private:
+	/// \brief 状態設定を1件数え、落とすならtrueを返す
+	bool Skip(bool isSame) {
+		++stateSetCount_;
+		if(isSame) {
+			++skippedCount_;
+		}
+		return isSame;
+	}
+
+	/// \brief ルート引数を忘れる(ルートシグネチャ・ヒープが変わったとき)
+	void InvalidateRootArguments() {
+		rootConstantBufferMask_ = 0;
+		rootShaderResourceMask_ = 0;
+		rootTableMask_ = 0;
+	}
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 流す先
+	BaseCommandList* target_ = nullptr;
+
+	//========================================
+	// パイプライン
+	bool hasRootSignature_ = false;
+	ID3D12RootSignature* rootSignature_ = nullptr;
+	bool hasPipelineState_ = false;
+	ID3D12PipelineState* pipelineState_ = nullptr;
+	uint32_t heapCount_ = 0;			// 0なら未設定
+	ID3D12DescriptorHeap* heaps_[kMaxDescriptorHeaps] = {};
+
+	//========================================
+	// ルート引数(ビットが立っているものだけ有効)
+	uint32_t rootConstantBufferMask_ = 0;
+	uint64_t rootConstantBuffers_[kMaxRootParameters] = {};
+	uint32_t rootShaderResourceMask_ = 0;
+	uint64_t rootShaderResources_[kMaxRootParameters] = {};
+	uint32_t rootTableMask_ = 0;
+	uint64_t rootTables_[kMaxRootParameters] = {};
+
+	//========================================
+	// 入力アセンブラ
+	bool hasTopology_ = false;
+	PrimitiveTopology topology_ = PrimitiveTopology::kUndefined;
+	uint32_t vertexBufferMask_ = 0;
+	VertexBufferView vertexBuffers_[kMaxVertexBuffers] = {};
+	bool hasIndexBuffer_ = false;
+	IndexBufferView indexBuffer_{};
+
+	//========================================
+	// 件数
+	uint64_t stateSetCount_ = 0;
+	uint64_t skippedCount_ = 0;
+};
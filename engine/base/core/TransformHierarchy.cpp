@@ -0,0 +1,274 @@
+/*********************************************************************
+ * \file   TransformHierarchy.cpp
+ * \brief  親子関係を持つTransformの階層(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TransformHierarchy.h"
+#include "MathFunc4x4.h"
+#include "AffineTransformations.h"
+#include <algorithm>
+#include <cassert>
+
+///=============================================================================
+///						ノードの作成
+uint32_t TransformHierarchy::Create(const Transform& localTransform, uint32_t parent) {
+	//========================================
+	// ハンドルの確保
+	uint32_t handle;
+	if(!freeHandles_.empty()) {
+		handle = freeHandles_.back();
+		freeHandles_.pop_back();
+	} else {
+		handle = static_cast<uint32_t>( indexOfHandle_.size() );
+		indexOfHandle_.push_back(kInvalidHandle);
+		parentHandle_.push_back(kInvalidHandle);
+	}
+
+	//========================================
+	// 末尾に追加する
+	// NOTE:ルートなら末尾でも並びは崩れない。親があるときは親の部分木に入れるため並べ直す
+	uint32_t index = static_cast<uint32_t>( handleOf_.size() );
+	indexOfHandle_[handle] = index;
+	parentHandle_[handle] = parent;
+	handleOf_.push_back(handle);
+	parent_.push_back(parent == kInvalidHandle ? kInvalidHandle : IndexOf(parent));
+	subtreeEnd_.push_back(index + 1);
+	local_.push_back(localTransform);
+	localMatrix_.push_back(Identity4x4());
+	worldMatrix_.push_back(Identity4x4());
+	worldVersion_.push_back(0);
+	isDirty_.push_back(0);
+	if(parent != kInvalidHandle) {
+		needsRebuild_ = true;
+	}
+	MarkDirty(index);
+	return handle;
+}
+
+///=============================================================================
+///						ノードの削除
+void TransformHierarchy::Destroy(uint32_t handle) {
+	uint32_t index = IndexOf(handle);
+	//========================================
+	// 子を自分の親につなぎ替える
+	// NOTE:並べ直し前は部分木の範囲が古いことがあるので、ハンドルの親を全部見る
+	for(uint32_t child = 0; child < parentHandle_.size(); ++child) {
+		if(parentHandle_[child] == handle) {
+			parentHandle_[child] = parentHandle_[handle];
+			MarkDirty(indexOfHandle_[child]);
+		}
+	}
+	//========================================
+	// 空いた場所は次の並べ直しで詰める
+	handleOf_[index] = kInvalidHandle;
+	indexOfHandle_[handle] = kInvalidHandle;
+	parentHandle_[handle] = kInvalidHandle;
+	freeHandles_.push_back(handle);
+	needsRebuild_ = true;
+}
+
+///=============================================================================
+///						親の変更
+void TransformHierarchy::SetParent(uint32_t handle, uint32_t parent) {
+	uint32_t index = IndexOf(handle);
+	if(parentHandle_[handle] == parent) {
+		return;
+	}
+	// 自分の子孫を親にすると循環する
+	for(uint32_t ancestor = parent; ancestor != kInvalidHandle; ancestor = parentHandle_[ancestor]) {
+		assert(ancestor != handle && "TransformHierarchy: parent must not be a descendant");
+		if(ancestor == handle) {
+			return;
+		}
+	}
+	parentHandle_[handle] = parent;
+	needsRebuild_ = true;
+	MarkDirty(index);
+}
+
+///=============================================================================
+///						ワールド行列の更新
+void TransformHierarchy::UpdateWorldMatrices() {
+	if(needsRebuild_) {
+		Rebuild();
+	}
+	if(dirtyHandles_.empty()) {
+		return;
+	}
+	//========================================
+	// 印をつけたノードを並び順にする
+	std::vector<uint32_t> dirtyIndices;
+	dirtyIndices.reserve(dirtyHandles_.size());
+	for(uint32_t handle : dirtyHandles_) {
+		uint32_t index = indexOfHandle_[handle];
+		if(index != kInvalidHandle && isDirty_[index]) {
+			dirtyIndices.push_back(index);
+		}
+	}
+	dirtyHandles_.clear();
+	std::sort(dirtyIndices.begin(), dirtyIndices.end());
+
+	//========================================
+	// 前から1回なめる(親の部分木に含まれるものは親と一緒に求め直している)
+	uint32_t coveredEnd = 0;
+	for(uint32_t index : dirtyIndices) {
+		if(index < coveredEnd) {
+			continue;
+		}
+		UpdateSubtree(index);
+		coveredEnd = subtreeEnd_[index];
+	}
+}
+
+///=============================================================================
+///						親から見たTransformの設定
+void TransformHierarchy::SetLocalTransform(uint32_t handle, const Transform& localTransform) {
+	uint32_t index = IndexOf(handle);
+	local_[index] = localTransform;
+	MarkDirty(index);
+}
+
+///=============================================================================
+///						取得
+const Transform& TransformHierarchy::GetLocalTransform(uint32_t handle) const {
+	return local_[IndexOf(handle)];
+}
+
+uint32_t TransformHierarchy::GetParent(uint32_t handle) const {
+	IndexOf(handle);
+	return parentHandle_[handle];
+}
+
+const Matrix4x4& TransformHierarchy::GetWorldMatrix(uint32_t handle) const {
+	return worldMatrix_[IndexOf(handle)];
+}
+
+uint32_t TransformHierarchy::GetWorldVersion(uint32_t handle) const {
+	return worldVersion_[IndexOf(handle)];
+}
+
+///=============================================================================
+///						ハンドルから並び順の添え字へ
+uint32_t TransformHierarchy::IndexOf(uint32_t handle) const {
+	assert(handle < indexOfHandle_.size() && indexOfHandle_[handle] != kInvalidHandle && "TransformHierarchy: invalid handle");
+	return indexOfHandle_[handle];
+}
+
+///=============================================================================
+///						変更の印をつける
+void TransformHierarchy::MarkDirty(uint32_t index) {
+	if(isDirty_[index]) {
+		return;
+	}
+	isDirty_[index] = 1;
+	dirtyHandles_.push_back(handleOf_[index]);
+}
+
+///=============================================================================
+///						並び順の作り直し
+void TransformHierarchy::Rebuild() {
+	needsRebuild_ = false;
+	//========================================
+	// 親ごとの子の一覧(今の並び順を保つ)
+	size_t handleCount = indexOfHandle_.size();
+	std::vector<uint32_t> childOffset(handleCount + 1, 0);
+	for(uint32_t handle : handleOf_) {
+		if(handle != kInvalidHandle && parentHandle_[handle] != kInvalidHandle) {
+			++childOffset[parentHandle_[handle] + 1];
+		}
+	}
+	for(size_t i = 0; i < handleCount; ++i) {
+		childOffset[i + 1] += childOffset[i];
+	}
+	std::vector<uint32_t> children(childOffset[handleCount]);
+	std::vector<uint32_t> cursor(childOffset.begin(), childOffset.end() - 1);
+	for(uint32_t handle : handleOf_) {
+		if(handle != kInvalidHandle && parentHandle_[handle] != kInvalidHandle) {
+			children[cursor[parentHandle_[handle]]++] = handle;
+		}
+	}
+
+	//========================================
+	// ルートから深さ優先でたどった順にする
+	std::vector<uint32_t> order;
+	order.reserve(handleOf_.size());
+	std::vector<uint32_t> stack;
+	for(uint32_t root : handleOf_) {
+		if(root == kInvalidHandle || parentHandle_[root] != kInvalidHandle) {
+			continue;
+		}
+		stack.push_back(root);
+		while(!stack.empty()) {
+			uint32_t handle = stack.back();
+			stack.pop_back();
+			order.push_back(handle);
+			// 先頭の子が先に取り出されるよう逆順に積む
+			for(uint32_t i = childOffset[handle + 1]; i > childOffset[handle]; --i) {
+				stack.push_back(children[i - 1]);
+			}
+		}
+	}
+
+	//========================================
+	// 新しい順に並べ替える
+	size_t count = order.size();
+	std::vector<uint32_t> parent(count);
+	std::vector<uint32_t> subtreeEnd(count);
+	std::vector<Transform> local(count);
+	std::vector<Matrix4x4> localMatrix(count);
+	std::vector<Matrix4x4> worldMatrix(count);
+	std::vector<uint32_t> worldVersion(count);
+	std::vector<uint8_t> isDirty(count);
+	for(uint32_t newIndex = 0; newIndex < count; ++newIndex) {
+		uint32_t oldIndex = indexOfHandle_[order[newIndex]];
+		local[newIndex] = local_[oldIndex];
+		localMatrix[newIndex] = localMatrix_[oldIndex];
+		worldMatrix[newIndex] = worldMatrix_[oldIndex];
+		worldVersion[newIndex] = worldVersion_[oldIndex];
+		isDirty[newIndex] = isDirty_[oldIndex];
+	}
+	for(uint32_t newIndex = 0; newIndex < count; ++newIndex) {
+		indexOfHandle_[order[newIndex]] = newIndex;
+	}
+	for(uint32_t newIndex = 0; newIndex < count; ++newIndex) {
+		uint32_t parentHandle = parentHandle_[order[newIndex]];
+		parent[newIndex] = parentHandle == kInvalidHandle ? kInvalidHandle : indexOfHandle_[parentHandle];
+		subtreeEnd[newIndex] = newIndex + 1;
+	}
+	// 子は親より後ろにあるので、後ろから親の範囲を広げる
+	for(uint32_t i = static_cast<uint32_t>( count ); i > 0; --i) {
+		uint32_t index = i - 1;
+		if(parent[index] != kInvalidHandle) {
+			subtreeEnd[parent[index]] = ( std::max )( subtreeEnd[parent[index]], subtreeEnd[index] );
+		}
+	}
+	handleOf_ = std::move(order);
+	parent_ = std::move(parent);
+	subtreeEnd_ = std::move(subtreeEnd);
+	local_ = std::move(local);
+	localMatrix_ = std::move(localMatrix);
+	worldMatrix_ = std::move(worldMatrix);
+	worldVersion_ = std::move(worldVersion);
+	isDirty_ = std::move(isDirty);
+}
+
+///=============================================================================
+///						部分木のワールド行列を求め直す
+void TransformHierarchy::UpdateSubtree(uint32_t index) {
+	for(uint32_t i = index; i < subtreeEnd_[index]; ++i) {
+		// 親から見た行列は自分が変わったときだけ作り直す
+		if(isDirty_[i]) {
+			localMatrix_[i] = MakeAffineMatrix(local_[i].scale, local_[i].rotate, local_[i].translate);
+			isDirty_[i] = 0;
+		}
+		worldMatrix_[i] = parent_[i] == kInvalidHandle ? localMatrix_[i] : Multiply4x4(localMatrix_[i], worldMatrix_[parent_[i]]);
+		// 0は「まだ求めていない」に使うので飛ばす
+		if(++worldVersion_[i] == 0) {
+			worldVersion_[i] = 1;
+		}
+		++updatedCount_;
+	}
+}
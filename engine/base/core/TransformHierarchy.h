@@ -0,0 +1,125 @@
+/*********************************************************************
+ * \file   TransformHierarchy.h
+ * \brief  親子関係を持つTransformの階層(D3D12非依存)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   ノードを親が子より前に来る深さ優先の順(部分木が連続する)で配列に並べる。
+ *         変更したノードに印をつけ、UpdateWorldMatricesでその部分木の範囲だけを
+ *         前から1回なめてワールド行列を求め直す(変更のないノードは何もしない)
+ *********************************************************************/
+#pragma once
+#include "Transform.h"
+#include "Matrix4x4.h"
+#include <cstdint>
+#include <vector>
+
+///=============================================================================
+///						Transformの階層
+class TransformHierarchy {
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/// \brief 無効なハンドル(親がないことも表す)
+	static constexpr uint32_t kInvalidHandle = UINT32_MAX;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Create ノードの作成
+	 * \param  localTransform 親から見たTransform
+	 * \param  parent 親のハンドル(kInvalidHandleならルート)
+	 * \return ハンドル(Destroyするまで変わらない)
+	 */
+	uint32_t Create(const Transform& localTransform, uint32_t parent = kInvalidHandle);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Destroy ノードの削除
+	 * \param  handle
+	 * \note   子は削除したノードの親につなぎ替える
+	 */
+	void Destroy(uint32_t handle);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  SetParent 親の変更
+	 * \param  handle
+	 * \param  parent 新しい親(kInvalidHandleならルートにする。自分の子孫は指定できない)
+	 */
+	void SetParent(uint32_t handle, uint32_t parent);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  UpdateWorldMatrices 変更のあった部分木のワールド行列を求め直す
+	 * \note   変更がなければすぐに戻るので、各オブジェクトの更新から何度呼んでもよい
+	 */
+	void UpdateWorldMatrices();
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 親から見たTransformの設定(ワールド行列は次のUpdateWorldMatricesで反映)
+	void SetLocalTransform(uint32_t handle, const Transform& localTransform);
+
+	/// \brief 親から見たTransformの取得
+	const Transform& GetLocalTransform(uint32_t handle) const;
+
+	/// \brief 親のハンドルの取得
+	uint32_t GetParent(uint32_t handle) const;
+
+	/// \brief ワールド行列の取得(直前のUpdateWorldMatricesの結果)
+	const Matrix4x4& GetWorldMatrix(uint32_t handle) const;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetWorldVersion ワールド行列の版の取得
+	 * \param  handle
+	 * \return ワールド行列を求め直すたびに増える値(1以上)。覚えておいた値と比べて変化を知る
+	 */
+	uint32_t GetWorldVersion(uint32_t handle) const;
+
+	/// \brief ノード数の取得(並べ直し前の空いた場所は数えない)
+	size_t GetSize() const { return indexOfHandle_.size() - freeHandles_.size(); }
+
+	/// \brief ResetUpdatedCountの後にワールド行列を求め直した数の取得
+	uint32_t GetUpdatedCount() const { return updatedCount_; }
+
+	/// \brief 求め直した数を0に戻す
+	void ResetUpdatedCount() { updatedCount_ = 0; }
+
+	///--------------------------------------------------------------
+	///							内部処理
+private:
+	/// \brief ハンドルから並び順の添え字へ
+	uint32_t IndexOf(uint32_t handle) const;
+
+	/// \brief 変更の印をつける
+	void MarkDirty(uint32_t index);
+
+	/// \brief 親子関係から並び順を作り直す
+	void Rebuild();
+
+	/// \brief 1つの部分木のワールド行列を求め直す
+	void UpdateSubtree(uint32_t index);
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 並び順ごとの値(親は必ず子より前。部分木は [i, subtreeEnd_[i]) に並ぶ)
+	std::vector<uint32_t> handleOf_;
+	std::vector<uint32_t> parent_;		// 親の添え字(ルートはkInvalidHandle)
+	std::vector<uint32_t> subtreeEnd_;
+	std::vector<Transform> local_;
+	std::vector<Matrix4x4> localMatrix_;
+	std::vector<Matrix4x4> worldMatrix_;
+	std::vector<uint32_t> worldVersion_;
+	std::vector<uint8_t> isDirty_;		// 親から見たTransformが変わった
+
+	//========================================
+	// ハンドルごとの値
+	std::vector<uint32_t> indexOfHandle_;	// 並び順の添え字(削除済みはkInvalidHandle)
+	std::vector<uint32_t> parentHandle_;	// 親のハンドル(並び順を作り直すときに使う)
+	std::vector<uint32_t> freeHandles_;
+
+	//========================================
+	// 変更
+	std::vector<uint32_t> dirtyHandles_;	// 印をつけたノード
+	bool needsRebuild_ = false;				// 親子関係が変わった
+	uint32_t updatedCount_ = 0;
+};
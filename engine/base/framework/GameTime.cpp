@@ -0,0 +1,62 @@
+/*********************************************************************
+ * \file   GameTime.cpp
+ * \brief  ゲームの時間(実時間・可変ステップ・固定ステップ・時間倍率・ポーズ)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "GameTime.h"
+#include <algorithm>
+#include <cassert>
+
+///=============================================================================
+///						初期化
+void GameTime::Initialize(float fixedDeltaTime, uint32_t maxFixedSteps) {
+	assert(fixedDeltaTime > 0.0f);
+	assert(maxFixedSteps >= 1);
+	fixedDeltaTime_ = fixedDeltaTime;
+	maxFixedSteps_ = maxFixedSteps;
+	timeScale_ = 1.0f;
+	isPaused_ = false;
+	realDeltaTime_ = 0.0f;
+	deltaTime_ = 0.0f;
+	fixedStepCount_ = 0;
+	interpolationAlpha_ = 0.0f;
+	accumulator_ = 0.0;
+	totalTime_ = 0.0;
+	realTotalTime_ = 0.0;
+	droppedStepCount_ = 0;
+}
+
+///=============================================================================
+///						時間を進める
+void GameTime::Advance(float realDeltaTime) {
+	realDeltaTime_ = ( std::max )( realDeltaTime, 0.0f );
+	realTotalTime_ += realDeltaTime_;
+
+	//========================================
+	// ゲーム内の時間
+	deltaTime_ = isPaused_ ? 0.0f : realDeltaTime_ * timeScale_;
+	totalTime_ += deltaTime_;
+
+	//========================================
+	// 固定ステップ
+	accumulator_ += deltaTime_;
+	uint32_t stepCount = static_cast<uint32_t>( accumulator_ / fixedDeltaTime_ );
+	accumulator_ -= static_cast<double>( stepCount ) * fixedDeltaTime_;
+	//処理落ちで溜まりすぎた分は捨てる(追いつこうとしてさらに重くなるのを防ぐ)
+	if(stepCount > maxFixedSteps_) {
+		droppedStepCount_ += stepCount - maxFixedSteps_;
+		stepCount = maxFixedSteps_;
+	}
+	fixedStepCount_ = stepCount;
+	interpolationAlpha_ = static_cast<float>( accumulator_ / fixedDeltaTime_ );
+}
+
+///=============================================================================
+///						時間倍率の設定
+void GameTime::SetTimeScale(float timeScale) {
+	assert(timeScale >= 0.0f);
+	timeScale_ = ( std::max )( timeScale, 0.0f );
+}
@@ -0,0 +1,110 @@
+/*********************************************************************
+ * \file   GameTime.h
+ * \brief  ゲームの時間(実時間・可変ステップ・固定ステップ・時間倍率・ポーズ)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   毎フレームAdvanceに実時間の経過を渡すと、その中で進める固定ステップ数と
+ *         描画用の補間係数が決まる。シミュレーションの速さが描画のフレームレートに依存しない。
+ *         シーンにはconst参照で渡す(時間を進めるのはフレームワークだけ)
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+
+///=============================================================================
+///						ゲームの時間
+class GameTime {
+	///--------------------------------------------------------------
+	///							定数
+public:
+	//========================================
+	// 既定の固定ステップ(これまでの1フレーム分)
+	static constexpr float kDefaultFixedDeltaTime = 1.0f / 60.0f;
+	// 既定の1フレームで進める固定ステップの上限
+	static constexpr uint32_t kDefaultMaxFixedSteps = 5;
+
+	///--------------------------------------------------------------
+	///							メンバ関数
+public:
+	/**----------------------------------------------------------------------------
+	 * \brief  Initialize 初期化
+	 * \param  fixedDeltaTime 固定ステップの時間(秒)
+	 * \param  maxFixedSteps 1フレームで進める固定ステップの上限(超えた分は捨てる)
+	 */
+	void Initialize(float fixedDeltaTime = kDefaultFixedDeltaTime, uint32_t maxFixedSteps = kDefaultMaxFixedSteps);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Advance 時間を進める
+	 * \param  realDeltaTime 前のフレームからの実時間(秒)
+	 * \note   1フレームに1回、シーンの更新より前に呼ぶ
+	 */
+	void Advance(float realDeltaTime);
+
+	///--------------------------------------------------------------
+	///							入出力関数
+public:
+	/// \brief 実時間のデルタタイム(時間倍率・ポーズの影響を受けない。UIやデバッグ用)
+	float GetRealDeltaTime() const { return realDeltaTime_; }
+
+	/// \brief ゲーム内のデルタタイム(時間倍率をかけ、ポーズ中は0)
+	float GetDeltaTime() const { return deltaTime_; }
+
+	/// \brief 固定ステップの時間
+	float GetFixedDeltaTime() const { return fixedDeltaTime_; }
+
+	/// \brief このフレームで進める固定ステップの数
+	uint32_t GetFixedStepCount() const { return fixedStepCount_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetInterpolationAlpha 描画用の補間係数(0～1)
+	 * \note   最後の固定ステップから次の固定ステップまでの進み具合。
+	 *         前のステップの状態と今の状態をこの割合で補間して描くと動きが滑らかになる
+	 */
+	float GetInterpolationAlpha() const { return interpolationAlpha_; }
+
+	/// \brief ゲーム開始からのゲーム内時間(秒)
+	double GetTotalTime() const { return totalTime_; }
+
+	/// \brief 起動してからの実時間(秒)
+	double GetRealTotalTime() const { return realTotalTime_; }
+
+	/// \brief 時間倍率の設定(1で等速、0以上)
+	void SetTimeScale(float timeScale);
+
+	/// \brief 時間倍率の取得
+	float GetTimeScale() const { return timeScale_; }
+
+	/// \brief ポーズの設定
+	void SetPaused(bool isPaused) { isPaused_ = isPaused; }
+
+	/// \brief ポーズ中か
+	bool IsPaused() const { return isPaused_; }
+
+	/// \brief 上限を超えて捨てた固定ステップの累計(処理落ちの目安)
+	uint64_t GetDroppedStepCount() const { return droppedStepCount_; }
+
+	///--------------------------------------------------------------
+	///							メンバ変数
+private:
+	//========================================
+	// 設定
+	float fixedDeltaTime_ = kDefaultFixedDeltaTime;
+	uint32_t maxFixedSteps_ = kDefaultMaxFixedSteps;
+	float timeScale_ = 1.0f;
+	bool isPaused_ = false;
+
+	//========================================
+	// このフレームの時間
+	float realDeltaTime_ = 0.0f;
+	float deltaTime_ = 0.0f;
+	uint32_t fixedStepCount_ = 0;
+	float interpolationAlpha_ = 0.0f;
+
+	//========================================
+	// 累計
+	// 固定ステップに使い切っていない時間
+	double accumulator_ = 0.0;
+	double totalTime_ = 0.0;
+	double realTotalTime_ = 0.0;
+	uint64_t droppedStepCount_ = 0;
+};
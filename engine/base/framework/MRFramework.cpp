@@ -8,6 +8,12 @@
  *********************************************************************/
 #include "MRFramework.h"
 #include "WinApp.h"
+#include <algorithm>
+#include <chrono>
+#include "NullCommandList.h"
+#include "RenderCommandLog.h"
+#include "LightCluster.h"
+#include <thread>
 
 ///=============================================================================
 ///						実行
@@ -60,6 +66,24 @@ void MRFramework::Initialize() {
 	//ダイレクトXの初期化
 	dxCore_->InitializeDirectX(win_.get());
 
+	///--------------------------------------------------------------
+	///						 ゲームの時間
+	//固定ステップはこれまでの1フレーム分(1/60秒)
+	gameTime_.Initialize(GameTime::kDefaultFixedDeltaTime);
+
+	///--------------------------------------------------------------
+	///						 シェーダーの事前コンパイル
+	//各共通部の初期化より先にまとめて並列コンパイルし、キャッシュに載せておく
+	dxCore_->PrecompileShaders({
+		{ L"resources/shader/Object3D.VS.hlsl", L"vs_6_0" },
+		{ L"resources/shader/Object3D.PS.hlsl", L"ps_6_0" },
+		{ L"resources/shader/Object3dInstancing.VS.hlsl", L"vs_6_0" },
+		{ L"resources/shader/Sprite.VS.hlsl", L"vs_6_0" },
+		{ L"resources/shader/Sprite.PS.hlsl", L"ps_6_0" },
+		{ L"resources/shader/Particle.VS.hlsl", L"vs_6_0" },
+		{ L"resources/shader/Particle.PS.hlsl", L"ps_6_0" },
+		});
+
 	///--------------------------------------------------------------
 	///						 ImGuiのセットアップ
 	imguiSetup_ = std::make_unique<ImguiSetup>();
@@ -72,6 +96,16 @@ void MRFramework::Initialize() {
 	//SrvSetupの初期化
 	srvSetup_->Initialize(dxCore_.get());
 
+	///--------------------------------------------------------------
+	///						 描画パスの並列記録
+	commandRecorder_ = std::make_unique<DirectXCommandRecorder>();
+	commandRecorder_->Initialize(dxCore_.get(), srvSetup_.get());
+	//メインスレッドも記録に参加するので、3パスに対してワーカーは最大2つ
+	uint32_t hardwareThreadCount = std::thread::hardware_concurrency();
+	uint32_t workerCount = hardwareThreadCount > 1 ? ( std::min )( 2u, hardwareThreadCount - 1 ) : 0u;
+	passRecorder_ = std::make_unique<ParallelPassRecorder>();
+	passRecorder_->Initialize(commandRecorder_.get(), workerCount);
+
 	///--------------------------------------------------------------
 	///						 入力クラス
 	//入力の初期化
@@ -145,7 +179,7 @@ void MRFramework::Update() {
 
 	//========================================
 	// カメラの更新
-	CameraManager::GetInstance()->UpdateAll();
+	CameraManager::GetInstance()->Update();
 	//========================================
 	// Object3Dのカメラ設定の更新
 	object3dSetup_->SetDefaultCamera(CameraManager::GetInstance()->GetCurrentCamera());
@@ -155,14 +189,24 @@ void MRFramework::Update() {
 	// インプットの更新
 	Input::GetInstance()->Update();
 	
+	//========================================
+	// 時間を進める(前のフレームの実時間)
+	gameTime_.Advance(dxCore_->GetDeltaTime());
+
 	//========================================
 	// シーンマネージャの更新
-	sceneManager_->Update();
+	sceneManager_->Update(gameTime_);
 }
 
 ///=============================================================================
 ///						終了処理
 void MRFramework::Finalize() {
+	//========================================
+	// GPUがリソースを使い終わるのを待つ
+	dxCore_->WaitForGpu();
+	//========================================
+	// 描画パスのワーカーを停止
+	passRecorder_->Finalize();
 	//========================================
 	// ImGuiの終了処理
 	imguiSetup_->Finalize();
@@ -195,6 +239,9 @@ void MRFramework::FrameworkPreDraw() {
 ///=============================================================================
 ///						フレームワーク共通後処理
 void MRFramework::FrameworkPostDraw() {
+	//========================================
+	// 並列記録したパスの後ろに積むコマンドリストへ切り替え
+	dxCore_->BeginEpilogueCommandList();
 	//========================================
 	// ImGui描画
 	imguiSetup_->Draw();
@@ -215,6 +262,10 @@ void MRFramework::ImGuiPreDraw() {
 	Input::GetInstance()->ImGuiDraw();
 	// CameraのImGui描画
 	CameraManager::GetInstance()->DrawImGui();
+	// 時間とフレームレートのImGui描画
+	TimeImGuiDraw();
+	// 描画コマンドの取り込みと分析
+	RenderCaptureImGuiDraw();
 #endif // DEBUG
 }
 
@@ -247,4 +298,147 @@ void MRFramework::Object3DCommonDraw() {
 	object3dSetup_->CommonDrawSetup();
 	// 3D描画
 	sceneManager_->Object3DDraw();
+	// 予約されたObject3dをモデルごとにまとめて描画
+	object3dSetup_->FlushInstances();
+}
+
+///=============================================================================
+///						各パスの並列記録
+void MRFramework::ParallelCommonDraw() {
+	//========================================
+	// 登録順がGPUでの実行順になる
+	passRecorder_->AddPass("Object3D", [this] { Object3DCommonDraw(); });
+	passRecorder_->AddPass("Object2D", [this] { Object2DCommonDraw(); });
+	passRecorder_->AddPass("Particle", [this] { ParticleCommonDraw(); });
+	//========================================
+	// ワーカースレッドで記録してまとめて提出
+	passRecorder_->Execute();
+}
+
+///=============================================================================
+///						時間とフレームレートのImGui描画
+void MRFramework::TimeImGuiDraw() {
+	FramePacer *framePacer = dxCore_->GetFramePacer();
+	const FramePacer::FrameStats &stats = framePacer->GetStats();
+	ImGui::Begin("Time");
+	//========================================
+	// フレーム時間
+	ImGui::Text("FPS: %.1f", stats.averageFps);
+	ImGui::Text("Frame: %.2fms (min %.2f / max %.2f)", stats.averageFrameMs, stats.minFrameMs, stats.maxFrameMs);
+	//========================================
+	// フレームレートの制限
+	ImGui::Separator();
+	bool isVSyncEnabled = dxCore_->IsVSyncEnabled();
+	if(ImGui::Checkbox("VSync", &isVSyncEnabled)) {
+		dxCore_->SetVSync(isVSyncEnabled);
+	}
+	const uint32_t kTargets[] = { FramePacer::k60Fps, FramePacer::k120Fps, FramePacer::k144Fps, FramePacer::kUncapped };
+	const char *kTargetNames[] = { "60", "120", "144", "Uncapped" };
+	for(int i = 0; i < 4; ++i) {
+		if(i > 0) {
+			ImGui::SameLine();
+		}
+		if(ImGui::RadioButton(kTargetNames[i], framePacer->GetTargetFrameRate() == kTargets[i])) {
+			framePacer->SetTargetFrameRate(kTargets[i]);
+			framePacer->ResetStats();
+		}
+	}
+	//========================================
+	// ゲームの時間
+	ImGui::Separator();
+	float timeScale = gameTime_.GetTimeScale();
+	if(ImGui::SliderFloat("TimeScale", &timeScale, 0.0f, 2.0f)) {
+		gameTime_.SetTimeScale(timeScale);
+	}
+	bool isPaused = gameTime_.IsPaused();
+	if(ImGui::Checkbox("Pause", &isPaused)) {
+		gameTime_.SetPaused(isPaused);
+	}
+	ImGui::Text("FixedSteps: %u  Alpha: %.2f", gameTime_.GetFixedStepCount(), gameTime_.GetInterpolationAlpha());
+	ImGui::Text("Dropped: %llu", static_cast<unsigned long long>( gameTime_.GetDroppedStepCount() ));
+	ImGui::End();
+}
+
+///=============================================================================
+///						描画コマンドの取り込みと分析のImGui描画
+void MRFramework::RenderCaptureImGuiDraw() {
+	const char *kCapturePath = "capture/frame.mrcl";
+	FrameCapture *frameCapture = dxCore_->GetFrameCapture();
+	//========================================
+	// 新しく取り込まれていれば分析する
+	if(frameCapture->GetCaptureCount() != analyzedCaptureCount_) {
+		analyzedCaptureCount_ = frameCapture->GetCaptureCount();
+		capturedCommands_ = frameCapture->GetLastCapture();
+		captureReportText_ = RenderCommandAnalyzer::Format(RenderCommandAnalyzer::Analyze(capturedCommands_));
+		replayMilliseconds_ = 0.0;
+	}
+	ImGui::Begin("RenderCapture");
+	//========================================
+	// 同じ値の再設定を落とすステートフィルタ
+	bool isStateFilterEnabled = dxCore_->IsStateFilterEnabled();
+	if(ImGui::Checkbox("StateFilter", &isStateFilterEnabled)) {
+		dxCore_->SetStateFilterEnabled(isStateFilterEnabled);
+	}
+	const DirectXCore::StateFilterStats &filterStats = dxCore_->GetStateFilterStats();
+	ImGui::Text("Skipped state sets: %llu / %llu",
+		static_cast<unsigned long long>( filterStats.skippedCount ), static_cast<unsigned long long>( filterStats.stateSetCount ));
+	//========================================
+	// Object3dのインスタンス描画
+	bool isInstancingEnabled = object3dSetup_->IsInstancingEnabled();
+	if(ImGui::Checkbox("Object3dInstancing", &isInstancingEnabled)) {
+		object3dSetup_->SetInstancingEnabled(isInstancingEnabled);
+	}
+	ImGui::Text("Object3d: %u instances in %u draws", object3dSetup_->GetInstanceCount(), object3dSetup_->GetInstancedDrawCount());
+	//========================================
+	// Object3dの視錐台カリング
+	bool isCullingEnabled = object3dSetup_->IsCullingEnabled();
+	if(ImGui::Checkbox("FrustumCulling", &isCullingEnabled)) {
+		object3dSetup_->SetCullingEnabled(isCullingEnabled);
+	}
+	ImGui::Text("Object3d: %u culled", object3dSetup_->GetCulledCount());
+	ImGui::Text("Transforms: %zu nodes, %u updated", object3dSetup_->GetTransformHierarchy().GetSize(), object3dSetup_->GetTransformUpdateCount());
+	const LightCluster &lightCluster = object3dSetup_->GetLightCluster();
+	ImGui::Text("Lights: %u, %zu assigned, max %u per cluster, %u dropped", lightCluster.GetLightCount(),
+		lightCluster.GetLightIndices().size(), lightCluster.GetMaxLightsPerCluster(), lightCluster.GetDroppedCount());
+	ImGui::Separator();
+	if(ImGui::Button("Capture")) {
+		dxCore_->RequestFrameCapture();
+	}
+	ImGui::SameLine();
+	if(ImGui::Button("Save") && !capturedCommands_.empty()) {
+		if(RenderCommandLog::Save(kCapturePath, capturedCommands_)) {
+			Log(std::format("Render commands saved to {}", kCapturePath), LogLevel::Success);
+		} else {
+			Log(std::format("Failed to save render commands to {}", kCapturePath), LogLevel::Warning);
+		}
+	}
+	ImGui::SameLine();
+	if(ImGui::Button("Load")) {
+		if(RenderCommandLog::Load(kCapturePath, capturedCommands_)) {
+			captureReportText_ = RenderCommandAnalyzer::Format(RenderCommandAnalyzer::Analyze(capturedCommands_));
+			replayMilliseconds_ = 0.0;
+		} else {
+			Log(std::format("Failed to load render commands from {}", kCapturePath), LogLevel::Warning);
+		}
+	}
+	ImGui::SameLine();
+	//========================================
+	// Null版へ繰り返し再生して、GPUを除いたコマンド発行のCPUコストを測る
+	if(ImGui::Button("Replay") && !capturedCommands_.empty()) {
+		const int kReplayCount = 100;
+		NullCommandList nullCommandList;
+		auto start = std::chrono::steady_clock::now();
+		for(int i = 0; i < kReplayCount; ++i) {
+			nullCommandList.Clear();
+			RenderCommandLog::Replay(capturedCommands_, &nullCommandList);
+		}
+		std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		replayMilliseconds_ = elapsed.count() / kReplayCount;
+	}
+	if(replayMilliseconds_ > 0.0) {
+		ImGui::Text("Replay: %.3fms / frame", replayMilliseconds_);
+	}
+	ImGui::Separator();
+	ImGui::TextUnformatted(captureReportText_.c_str());
+	ImGui::End();
 }
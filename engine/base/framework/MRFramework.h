@@ -13,6 +13,8 @@
 #include "DirectXCore.h"
 #include "ImguiSetup.h"
 #include "SrvSetup.h"
+#include "DirectXCommandRecorder.h"
+#include "ParallelPassRecorder.h"
 #include "Input.h"
 #include "MAudioG.h"
 #include "SpriteSetup.h"
@@ -24,6 +26,8 @@
 #include "CameraManager.h"
 #include "SceneManager.h"
 #include "SceneFactory.h"
+#include "GameTime.h"
+#include "RenderCommandAnalyzer.h"
 
 ///=============================================================================
 ///						FrameWorkクラス
@@ -75,12 +79,24 @@ public:
 	/// @brief オブジェクト3D共通描画設定
 	void Object3DCommonDraw();
 
+	/// @brief 3D・2D・パーティクルの各パスを並列に記録
+	void ParallelCommonDraw();
+
+	/// @brief 時間とフレームレートのImGui描画
+	void TimeImGuiDraw();
+
+	/// @brief 描画コマンドの取り込みと分析のImGui描画
+	void RenderCaptureImGuiDraw();
+
 	///--------------------------------------------------------------
 	///							入出力関数
 public:
 	/// \brief 終了リクエストの取得
 	virtual bool IsEndRequest() const { return isEndRequest_; }
 
+	/// \brief ゲームの時間の取得
+	GameTime *GetGameTime() { return &gameTime_; }
+
 	///--------------------------------------------------------------
 	///							メンバ変数
 protected:
@@ -88,6 +104,16 @@ protected:
 	// ゲーム終了フラグ
 	bool isEndRequest_ = false;
 	//========================================
+	// ゲームの時間
+	GameTime gameTime_;
+	//========================================
+	// 描画コマンドの取り込み結果
+	std::vector<RenderCommand> capturedCommands_;
+	std::string captureReportText_;
+	uint64_t analyzedCaptureCount_ = 0;
+	// Null版への再生にかかった時間(1回あたり)
+	double replayMilliseconds_ = 0.0;
+	//========================================
 	// ウィンドウクラス
 	std::unique_ptr<WinApp> win_;
 	//========================================
@@ -100,6 +126,10 @@ protected:
 	// SrvSetup
 	std::unique_ptr<SrvSetup> srvSetup_;
 	//========================================
+	// 描画パスの並列記録
+	std::unique_ptr<DirectXCommandRecorder> commandRecorder_;
+	std::unique_ptr<ParallelPassRecorder> passRecorder_;
+	//========================================
 	// スプライト共通部
 	std::unique_ptr<SpriteSetup> spriteSetup_;
 	// パーティクルセットアップ
@@ -51,16 +51,9 @@ void MaruRhythm::Draw() {
 	MRFramework::FrameworkPreDraw();
 
 	//========================================
-	//3Dオブジェクト共通描画設定
-	MRFramework::Object3DCommonDraw();
-
-	//========================================
-	// 2Dオブジェクト共通描画設定
-	MRFramework::Object2DCommonDraw();
-
-	//========================================
-	//パーティクル共通描画設定
-	MRFramework::ParticleCommonDraw();
+	// 3D・2D・パーティクルをそれぞれのスレッドで記録
+	// NOTE:実行順は 3D → 2D → パーティクル のまま
+	MRFramework::ParallelCommonDraw();
 
 	//========================================
 	// ループ後処理
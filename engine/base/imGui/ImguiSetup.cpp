@@ -69,7 +69,7 @@ void ImguiSetup::Initialize(WinApp* winApp, DirectXCore* dxCore, Style style) {
 	//========================================
 	// DirectX12用の初期化
 	ImGui_ImplDX12_Init(dxCore_->GetDevice().Get(),
-		dxCore_->GetSwapChainDesc().BufferCount,
+		DirectXCore::GetFrameCount(),
 		dxCore_->GetRtvDesc().Format,
 		srvDescriptorHeap_.Get(),
 		srvDescriptorHeap_->GetCPUDescriptorHandleForHeapStart(),
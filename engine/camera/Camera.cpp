@@ -13,19 +13,26 @@
 #include "MathFunc4x4.h"
 #include "AffineTransformations.h"
 
+namespace {
+	/// \brief 板ポリゴンの裏表を返す行列(MakeRotateYMatrix(π)と同じ。sin・cosを使わずコンパイル時に作る)
+	constexpr Matrix4x4 kBackToFrontMatrix = { {
+		{ -1.0f, 0.0f, 0.0f, 0.0f },
+		{ 0.0f, 1.0f, 0.0f, 0.0f },
+		{ 0.0f, 0.0f, -1.0f, 0.0f },
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+	} };
+}
+
 ///=============================================================================
 ///						デフォルトコンストラクタ
 Camera::Camera()
-//	Matrix4x4 projectionMatrix = MakePerspectiveFovMatrix(0.45f, float(object3dSetup_->GetDXManager()->GetWinApp().GetWindowWidth()) / float(object3dSetup_->GetDXManager()->GetWinApp().GetWindowHeight()), 0.1f, 100.0f);
 	:transform_({ {1.0f,1.0f,1.0f},{0.2f,0.0f,0.0f},{0.0f,4.0f,-16.0f} })
 	, horizontalFieldOfView_(0.45f)
 	, aspectRatio_(static_cast<float>( WinApp::kWindowWidth_ ) / static_cast<float>( WinApp::kWindowHeight_ ))
 	, nearClipRange_(0.1f)
-	, farClipRange_(100.0f)
-	, worldMatrix_(MakeAffineMatrix(transform_.scale, transform_.rotate, transform_.translate))
-	, viewMatrix_(Inverse4x4(worldMatrix_))
-	, projectionMatrix_(MakePerspectiveFovMatrix(horizontalFieldOfView_, aspectRatio_, nearClipRange_, farClipRange_))
-	, viewProjectionMatrix_(Multiply4x4(viewMatrix_, projectionMatrix_)) {
+	, farClipRange_(100.0f) {
+	// 作った時点で行列を使えるようにする
+	Update();
 }
 
 ///=============================================================================
@@ -36,23 +43,59 @@ void Camera::Initialize() {
 ///=============================================================================
 ///						更新
 void Camera::Update() {
-	// ---------------------------------------
-	// cameraTransformからcameraMatrixを作成
-	worldMatrix_ = MakeAffineMatrix(transform_.scale, transform_.rotate, transform_.translate);
-	// cameraTransformからviewMatrixを作成
-	viewMatrix_ = Inverse4x4(worldMatrix_);
-
-	//---------------------------------------
-	// 正射影行列の作成
-	projectionMatrix_ = MakePerspectiveFovMatrix(
-		horizontalFieldOfView_,
-		aspectRatio_,
-		nearClipRange_,
-		farClipRange_);
+	if(!isViewDirty_ && !isProjectionDirty_) {
+		return;
+	}
+
+	//========================================
+	// Transformが変わったときだけビュー行列を作る
+	if(isViewDirty_) {
+		// cameraTransformからcameraMatrixを作成
+		snapshot_.worldMatrix = MakeAffineMatrix(transform_.scale, transform_.rotate, transform_.translate);
+		// cameraTransformからviewMatrixを作成
+		// NOTE:カメラの行列はアフィン行列なので一般の逆行列は使わない(拡大縮小を設定できるのでInverseRigidにはしない)
+		snapshot_.viewMatrix = InverseAffine(snapshot_.worldMatrix);
+		snapshot_.worldPosition = transform_.translate;
+		// ビルボード行列(拡大縮小と平行移動は含めない)
+		snapshot_.billboardMatrix = Multiply4x4(kBackToFrontMatrix, MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, transform_.rotate, { 0.0f, 0.0f, 0.0f }));
+		isViewDirty_ = false;
+	}
+
+	//========================================
+	// FOV・アスペクト比・クリップが変わったときだけプロジェクション行列を作る
+	if(isProjectionDirty_) {
+		snapshot_.projectionMatrix = MakePerspectiveFovMatrix(
+			horizontalFieldOfView_,
+			aspectRatio_,
+			nearClipRange_,
+			farClipRange_);
+		isProjectionDirty_ = false;
+	}
 
 	//========================================
-	// ビュー・プロジェクション行列を計算
-	viewProjectionMatrix_ = Multiply4x4(viewMatrix_, projectionMatrix_);
+	// ビュー・プロジェクション行列と視錐台を計算
+	snapshot_.viewProjectionMatrix = Multiply4x4(snapshot_.viewMatrix, snapshot_.projectionMatrix);
+	snapshot_.frustum = Frustum::FromViewProjection(snapshot_.viewProjectionMatrix);
+	// 0は「まだ読んでいない」に使えるよう飛ばす
+	if(++snapshot_.version == 0) {
+		snapshot_.version = 1;
+	}
+}
+
+///=============================================================================
+///						値が変わったときだけ設定
+void Camera::SetIfChanged(Vector3& target, const Vector3& value, bool& isDirty) {
+	if(target != value) {
+		target = value;
+		isDirty = true;
+	}
+}
+
+void Camera::SetIfChanged(float& target, float value, bool& isDirty) {
+	if(target != value) {
+		target = value;
+		isDirty = true;
+	}
 }
 
 ///=============================================================================
@@ -9,6 +9,29 @@
 #pragma once
 #include "Transform.h"
 #include "Matrix4x4.h"
+#include "FrustumCuller.h"
+#include <cstdint>
+
+///=============================================================================
+///						カメラから求めた値(描画するものが共通で使う)
+struct CameraSnapshot {
+	// ワールド行列
+	Matrix4x4 worldMatrix;
+	// ビュー行列
+	Matrix4x4 viewMatrix;
+	// プロジェクション行列
+	Matrix4x4 projectionMatrix;
+	// ビュープロジェクション行列
+	Matrix4x4 viewProjectionMatrix;
+	// ビルボード行列(カメラの回転に板ポリゴンの裏表を返す行列をかけたもの。平行移動なし)
+	Matrix4x4 billboardMatrix;
+	// 視錐台(ワールド空間)
+	Frustum frustum;
+	// ワールド空間の位置
+	Vector3 worldPosition;
+	// 値を求め直すたびに増える(1以上)
+	uint32_t version;
+};
 
 ///=============================================================================
 ///						
@@ -24,7 +47,10 @@ public:
 	/// \brief 初期化	
 	void Initialize();
 
-	/// \brief 更新
+	/**----------------------------------------------------------------------------
+	 * \brief  Update 更新
+	 * \note   前の更新から変わった値に関わる行列だけを求め直す。変更がなければ何もしない
+	 */
 	void Update();
 
 	/// \brief 描画 
@@ -33,6 +59,9 @@ public:
 	///--------------------------------------------------------------
 	///							静的メンバ関数
 private:
+	/// \brief 値が変わったときだけ設定して印をつける
+	static void SetIfChanged(Vector3& target, const Vector3& value, bool& isDirty);
+	static void SetIfChanged(float& target, float value, bool& isDirty);
 
 	///--------------------------------------------------------------
 	///							入出力関数
@@ -42,31 +71,48 @@ public:
 	 * \brief  SetWorldMatrix ワールド行列の設定
 	 * \param  worldMatrix ワールド行列
 	 */
-	const Matrix4x4& GetWorldMatrix() const { return worldMatrix_; }
+	const Matrix4x4& GetWorldMatrix() const { return snapshot_.worldMatrix; }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetViewMatrix ビュー行列の設定
 	 * \param  viewMatrix ビュー行列
 	 */
-	const Matrix4x4& GetViewMatrix() const { return viewMatrix_; }
+	const Matrix4x4& GetViewMatrix() const { return snapshot_.viewMatrix; }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetProjectionMatrix プロジェクション行列の設定
 	 * \param  projectionMatrix プロジェクション行列
 	 */
-	const Matrix4x4& GetProjectionMatrix() const { return projectionMatrix_; }
+	const Matrix4x4& GetProjectionMatrix() const { return snapshot_.projectionMatrix; }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetViewProjectionMatrix ビュープロジェクション行列の設定
 	 * \param  viewProjectionMatrix ビュープロジェクション行列
 	 */
-	const Matrix4x4& GetViewProjectionMatrix() const { return viewProjectionMatrix_; }
+	const Matrix4x4& GetViewProjectionMatrix() const { return snapshot_.viewProjectionMatrix; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetSnapshot カメラから求めた値の取得
+	 * \return 直前のUpdateで求めた行列・視錐台・ビルボード行列
+	 * \note   Object3d・パーティクル・カリングはここから読み、同じフレームで同じ値を使う
+	 */
+	const CameraSnapshot& GetSnapshot() const { return snapshot_; }
+
+	/**----------------------------------------------------------------------------
+	 * \brief  GetVersion 値の版の取得
+	 * \return 行列を求め直すたびに増える値。覚えておいた値と比べて変化を知る
+	 */
+	uint32_t GetVersion() const { return snapshot_.version; }
 
 	/**----------------------------------------------------------------------------
 	 * \brief  SetTransform トランスフォームの設定
 	 * \param  transform トランスフォーム
 	 */
-	void SetTransform(const Transform& transform) { transform_ = transform; }
+	void SetTransform(const Transform& transform) {
+		SetIfChanged(transform_.scale, transform.scale, isViewDirty_);
+		SetIfChanged(transform_.rotate, transform.rotate, isViewDirty_);
+		SetIfChanged(transform_.translate, transform.translate, isViewDirty_);
+	}
 	/*
 	 * \brief  GetTransform　 トランスフォームの取得
 	 * \return translate トランスフォーム
@@ -77,7 +123,7 @@ public:
 	 * \brief  SetTranslate 移動の設定
 	 * \param  translate 移動
 	 */
-	void SetTranslate(const Vector3& translate) { transform_.translate = translate; }
+	void SetTranslate(const Vector3& translate) { SetIfChanged(transform_.translate, translate, isViewDirty_); }
 	/*
 	 * \brief  GetTranslate 移動の取得
 	 * \return translate 移動
@@ -88,7 +134,7 @@ public:
 	 * \brief  SetRotate 回転の設定
 	 * \param  rotate 回転
 	 */
-	void SetRotate(const Vector3& rotate) { transform_.rotate = rotate; }
+	void SetRotate(const Vector3& rotate) { SetIfChanged(transform_.rotate, rotate, isViewDirty_); }
 	/*
 	 * \brief  GetRotate 回転の取得
 	 * \return 
@@ -99,7 +145,7 @@ public:
 	 * \brief  SetFovY FovYの設定
 	 * \param  FovY 
 	 */
-	void SetFovY(float fovY) { horizontalFieldOfView_ = fovY; }
+	void SetFovY(float fovY) { SetIfChanged(horizontalFieldOfView_, fovY, isProjectionDirty_); }
 	/*
 	 * \brief  GetFovY FovYの取得
 	 * \return FovY
@@ -110,7 +156,7 @@ public:
 	 * \brief  SetNearClip ニアクリップの設定
 	 * \param  nearClip ニアクリップ
 	 */
-	void SetAspectRatio(float aspectRatio) { aspectRatio_ = aspectRatio; }
+	void SetAspectRatio(float aspectRatio) { SetIfChanged(aspectRatio_, aspectRatio, isProjectionDirty_); }
 	/*
 	 * \brief  GetNearClip ニアクリップの取得
 	 * \return nearClip ニアクリップ
@@ -121,7 +167,7 @@ public:
 	 * \brief  SetNearClip ニアクリップの設定
 	 * \param  nearClip ニアクリップ
 	 */
-	void SetNearClip(float nearClip) { nearClipRange_ = nearClip; }
+	void SetNearClip(float nearClip) { SetIfChanged(nearClipRange_, nearClip, isProjectionDirty_); }
 	/*
 	 * \brief  GetNearClip
 	 * \return nearClip
@@ -132,7 +178,7 @@ public:
 	 * \brief  SetFarClip ファークリップの設定
 	 * \param  farClip ファークリップ
 	 */
-	void SetFarClip(float farClip) { farClipRange_ = farClip; }
+	void SetFarClip(float farClip) { SetIfChanged(farClipRange_, farClip, isProjectionDirty_); }
 	/*
 	 * \brief  GetFarClip ファークリップの取得
 	 * \return farClip ファークリップ
@@ -147,15 +193,8 @@ private:
 	// カメラのトランスフォーム
 	Transform transform_;
 
-	//---------------------------------------
-	// ワールド行列
-	Matrix4x4 worldMatrix_;
-	// ビュー行列
-	Matrix4x4 viewMatrix_;
-
 	//---------------------------------------
 	// プロジェクション行列関連データ
-	Matrix4x4 projectionMatrix_;
 	// 水平視野角(FOV)
 	float horizontalFieldOfView_;
 	// アスペクト比
@@ -166,8 +205,11 @@ private:
 	float farClipRange_;
 
 	//---------------------------------------
-	// ビュープロジェクション行列
-	Matrix4x4 viewProjectionMatrix_;
+	// 求めた値
+	CameraSnapshot snapshot_ = {};
+	// 前の更新から変わった値
+	bool isViewDirty_ = true;
+	bool isProjectionDirty_ = true;
 
 };
 
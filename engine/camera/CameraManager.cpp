@@ -11,6 +11,7 @@
 #include "Input.h"
 #include "MathFunc4x4.h"
 #include "AffineTransformations.h"
+#include "QuaternionFunc.h"
 
 ///=============================================================================
 ///						シングルトンインスタンスの取得
@@ -73,15 +74,14 @@ Camera *CameraManager::GetCurrentCamera() const {
 
 ///=============================================================================
 ///                     カメラの更新
-void CameraManager::UpdateAll() {
-	for(auto &pair : cameras_) {
-		if(pair.second) {
-			pair.second->Update();
-		}
-	}
-
-	// デバックカメラの更新
+void CameraManager::Update() {
+	// デバックカメラの更新(操作をこのフレームの行列に反映するため先に行う)
 	DebugCameraUpdate();
+
+	// 描画に使うカメラだけ更新する(変更がなければ何もしない)
+	if(Camera *currentCamera = GetCurrentCamera()) {
+		currentCamera->Update();
+	}
 }
 
 ///=============================================================================
@@ -118,31 +118,33 @@ void CameraManager::DebugCameraUpdate() {
 	static Vector3 targetPoint = { 0.0f, 0.0f, 0.0f }; // 回転の中心点
 	static float distanceToTarget = 5.0f; // 中心点とカメラの距離
 
+	// 回転はクォータニオンで積み重ねる(オイラー角を直接足すとジンバルロックが起きる)
+	Quaternion orientation = MakeRotateQuaternion(cameraTransform.rotate);
+
 	if(isLeftButtonPressed) {
 		// 回転速度の調整
 		const float rotateSpeed = 0.005f;
 
-		// マウス移動量に応じてカメラの回転を更新
-		cameraTransform.rotate.y -= mouseDx * rotateSpeed;
-		cameraTransform.rotate.x -= mouseDy * rotateSpeed;
-
-		// 回転行列を作成
-		Matrix4x4 rotationMatrix = MakeRotateMatrix(cameraTransform.rotate);
+		// マウス移動量に応じて、ワールドのY軸まわりとカメラのX軸まわりに回転する
+		Quaternion yaw = MakeRotateAxisAngleQuaternion({ 0.0f, 1.0f, 0.0f }, -mouseDx * rotateSpeed);
+		Quaternion pitch = MakeRotateAxisAngleQuaternion({ 1.0f, 0.0f, 0.0f }, -mouseDy * rotateSpeed);
+		orientation = NormalizeQuaternion(MultiplyQuaternion(yaw, MultiplyQuaternion(orientation, pitch)));
+		cameraTransform.rotate = QuaternionToEuler(orientation);
 
 		// カメラの位置を更新
-		cameraTransform.translate = targetPoint - Conversion({ 0.0f, 0.0f, 1.0f }, rotationMatrix) * distanceToTarget;
+		cameraTransform.translate = targetPoint - RotateVector({ 0.0f, 0.0f, 1.0f }, orientation) * distanceToTarget;
 	}
 
+	// カメラの向きから右方向・上方向・前方向のベクトルを計算
+	Vector3 right = RotateVector({ 1.0f, 0.0f, 0.0f }, orientation);
+	Vector3 up = RotateVector({ 0.0f, 1.0f, 0.0f }, orientation);
+	Vector3 forward = RotateVector({ 0.0f, 0.0f, 1.0f }, orientation);
+
 	// パン（カメラの平行移動）
 	if(isMiddleButtonPressed) {
 		// パン速度の調整
 		const float panSpeed = 0.01f;
 
-		// カメラの向きから右方向と上方向のベクトルを計算
-		Matrix4x4 rotationMatrix = MakeRotateMatrix(cameraTransform.rotate);
-		Vector3 right = { rotationMatrix.m[0][0], rotationMatrix.m[1][0], rotationMatrix.m[2][0] };
-		Vector3 up = { rotationMatrix.m[0][1], rotationMatrix.m[1][1], rotationMatrix.m[2][1] };
-
 		// マウス移動量に応じてカメラの位置を更新
 		cameraTransform.translate = cameraTransform.translate - ( right * ( mouseDx * panSpeed ) );
 		cameraTransform.translate = cameraTransform.translate + ( up * ( mouseDy * panSpeed ) );
@@ -152,9 +154,6 @@ void CameraManager::DebugCameraUpdate() {
 
 	// WASDキー（中心点の平行移動）
 	const float moveSpeed = 0.1f;
-	Matrix4x4 rotationMatrix = MakeRotateMatrix(cameraTransform.rotate);
-	Vector3 forward = { rotationMatrix.m[0][2], rotationMatrix.m[1][2], rotationMatrix.m[2][2] };
-	Vector3 right = { rotationMatrix.m[0][0], rotationMatrix.m[1][0], rotationMatrix.m[2][0] };
 
 	if(input->PushKey(DIK_UPARROW)) {
 		targetPoint = targetPoint + forward * moveSpeed;
@@ -181,7 +180,7 @@ void CameraManager::DebugCameraUpdate() {
 		}
 
 		// カメラの位置を更新
-		cameraTransform.translate = targetPoint - Conversion({ 0.0f, 0.0f, 1.0f }, rotationMatrix) * distanceToTarget;
+		cameraTransform.translate = targetPoint - forward * distanceToTarget;
 	}
 
 	// 更新されたトランスフォームをカメラに反映
@@ -42,8 +42,12 @@ public:
 	/// \brief 現在のカメラの取得
     Camera* GetCurrentCamera() const;
 
-	/// \brief 全てのカメラの更新
-    void UpdateAll();
+	/**----------------------------------------------------------------------------
+	 * \brief  Update 使われているカメラの更新
+	 * \note   デバッグカメラの操作を反映してから、描画に使う現在のカメラだけ行列を求め直す。
+	 *         使われていないカメラは変更の印が残り、切り替えたときに求め直す
+	 */
+    void Update();
 
 	/// @brief デバックカメラの更新
     void DebugCameraUpdate();
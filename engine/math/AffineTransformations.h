@@ -14,15 +14,13 @@
 	/// </summary>
 	/// <param name="translate"></param>
 	/// <returns></returns>
-inline Matrix4x4 MakeTranslateMatrix(const Vector3& translate) {
-	Matrix4x4 result = Identity4x4(); // 単位行列を初期化
-
-	// 平行移動成分をセット
-	result.m[3][0] = translate.x;
-	result.m[3][1] = translate.y;
-	result.m[3][2] = translate.z;
-
-	return result;
+inline constexpr Matrix4x4 MakeTranslateMatrix(const Vector3& translate) {
+	return { {
+		{ 1.0f, 0.0f, 0.0f, 0.0f },
+		{ 0.0f, 1.0f, 0.0f, 0.0f },
+		{ 0.0f, 0.0f, 1.0f, 0.0f },
+		{ translate.x, translate.y, translate.z, 1.0f },
+	} };
 }
 
 /// <summary>
@@ -30,16 +28,13 @@ inline Matrix4x4 MakeTranslateMatrix(const Vector3& translate) {
 /// </summary>
 /// <param name="scale"></param>
 /// <returns></returns>
-inline Matrix4x4 MakeScaleMatrix(const Vector3& scale) {
-	// 単位行列を初期化
-	Matrix4x4 result = Identity4x4();
-
-	// 拡大縮小成分をセット
-	result.m[0][0] = scale.x;
-	result.m[1][1] = scale.y;
-	result.m[2][2] = scale.z;
-
-	return result;
+inline constexpr Matrix4x4 MakeScaleMatrix(const Vector3& scale) {
+	return { {
+		{ scale.x, 0.0f, 0.0f, 0.0f },
+		{ 0.0f, scale.y, 0.0f, 0.0f },
+		{ 0.0f, 0.0f, scale.z, 0.0f },
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+	} };
 }
 
 /// <summary>
@@ -48,16 +43,15 @@ inline Matrix4x4 MakeScaleMatrix(const Vector3& scale) {
 /// <param name="radian"></param>
 /// <returns></returns>
 inline Matrix4x4 MakeRotateXMatrix(float radian) {
-	// 単位行列で初期化
-	Matrix4x4 result = Identity4x4();
-
-	//行列の計算
-	result.m[1][1] = std::cos(radian);
-	result.m[1][2] = std::sin(radian);
-	result.m[2][1] = -std::sin(radian);
-	result.m[2][2] = std::cos(radian);
-
-	return result;
+	// sin・cosは1回ずつ求める
+	float s = std::sin(radian);
+	float c = std::cos(radian);
+	return { {
+		{ 1.0f, 0.0f, 0.0f, 0.0f },
+		{ 0.0f, c, s, 0.0f },
+		{ 0.0f, -s, c, 0.0f },
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+	} };
 }
 
 /// <summary>
@@ -66,16 +60,14 @@ inline Matrix4x4 MakeRotateXMatrix(float radian) {
 /// <param name="radian"></param>
 /// <returns></returns>
 inline Matrix4x4 MakeRotateYMatrix(float radian) {
-	// 単位行列で初期化
-	Matrix4x4 result = Identity4x4();
-
-	//行列の計算
-	result.m[0][0] = std::cos(radian);
-	result.m[0][2] = -std::sin(radian);
-	result.m[2][0] = std::sin(radian);
-	result.m[2][2] = std::cos(radian);
-
-	return result;
+	float s = std::sin(radian);
+	float c = std::cos(radian);
+	return { {
+		{ c, 0.0f, -s, 0.0f },
+		{ 0.0f, 1.0f, 0.0f, 0.0f },
+		{ s, 0.0f, c, 0.0f },
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+	} };
 }
 
 /// <summary>
@@ -84,16 +76,14 @@ inline Matrix4x4 MakeRotateYMatrix(float radian) {
 /// <param name="radian"></param>
 /// <returns></returns>
 inline Matrix4x4 MakeRotateZMatrix(float radian) {
-	// 単位行列で初期化
-	Matrix4x4 result = Identity4x4();
-
-	//行列の計算
-	result.m[0][0] = std::cos(radian);
-	result.m[0][1] = std::sin(radian);
-	result.m[1][0] = -std::sin(radian);
-	result.m[1][1] = std::cos(radian);
-
-	return result;
+	float s = std::sin(radian);
+	float c = std::cos(radian);
+	return { {
+		{ c, s, 0.0f, 0.0f },
+		{ -s, c, 0.0f, 0.0f },
+		{ 0.0f, 0.0f, 1.0f, 0.0f },
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+	} };
 }
 
 /**----------------------------------------------------------------------------
@@ -116,7 +106,7 @@ inline Matrix4x4 MakeRotateMatrix(const Vector3& rotation) {
 /// <param name="vector"></param>
 /// <param name="matrix"></param>
 /// <returns></returns>
-inline Vector3 Conversion(const Vector3& vector, const Matrix4x4& matrix) {
+inline constexpr Vector3 Conversion(const Vector3& vector, const Matrix4x4& matrix) {
 	Vector3 result;
 
 	// 行列とベクトルの乗算
@@ -133,20 +123,27 @@ inline Vector3 Conversion(const Vector3& vector, const Matrix4x4& matrix) {
 }
 
 //アフィン変換
+// NOTE:S * (Rx * Ry * Rz) * T を展開した式で直接求める(行列の積を作らない)
 inline Matrix4x4 MakeAffineMatrix(const Vector3& scale, const Vector3& rotate, const Vector3& translate) {
-	//縮小拡大
-	Matrix4x4 scaleMatrix = MakeScaleMatrix(scale);
-	//回転
-	Matrix4x4 rotateXMatrix = MakeRotateXMatrix(rotate.x);
-	Matrix4x4 rotateYMatrix = MakeRotateYMatrix(rotate.y);
-	Matrix4x4 rotateZMatrix = MakeRotateZMatrix(rotate.z);
-	Matrix4x4 rotateXYZMatrix = Multiply4x4(rotateXMatrix, Multiply4x4(rotateYMatrix, rotateZMatrix));
-	//並行移動
-	Matrix4x4 translateMatrix = MakeTranslateMatrix(translate);
-	//合成
-	Matrix4x4 result = Identity4x4();
-	result = Multiply4x4(scaleMatrix, rotateXYZMatrix);
-	result = Multiply4x4(result, translateMatrix);
-
-	return result;
+	//各軸のsin・cosは1回ずつ
+	float sx = std::sin(rotate.x);
+	float cx = std::cos(rotate.x);
+	float sy = std::sin(rotate.y);
+	float cy = std::cos(rotate.y);
+	float sz = std::sin(rotate.z);
+	float cz = std::cos(rotate.z);
+	//回転の各行に拡大縮小をかけ、最後の行に平行移動を置く
+	return { {
+		{ scale.x * cy * cz, scale.x * cy * sz, scale.x * -sy, 0.0f },
+		{ scale.y * ( sx * sy * cz - cx * sz ), scale.y * ( sx * sy * sz + cx * cz ), scale.y * sx * cy, 0.0f },
+		{ scale.z * ( cx * sy * cz + sx * sz ), scale.z * ( cx * sy * sz - sx * cz ), scale.z * cx * cy, 0.0f },
+		{ translate.x, translate.y, translate.z, 1.0f },
+	} };
 }
+
+///=============================================================================
+///						コンパイル時の確認
+static_assert(Multiply4x4(MakeTranslateMatrix({ 1.0f, 2.0f, 3.0f }), MakeTranslateMatrix({ -1.0f, -2.0f, -3.0f })) == Identity4x4());
+static_assert(Inverse4x4(MakeTranslateMatrix({ 1.0f, 2.0f, 3.0f })) == MakeTranslateMatrix({ -1.0f, -2.0f, -3.0f }));
+static_assert(InverseAffine(MakeScaleMatrix({ 2.0f, 4.0f, 0.5f })) == MakeScaleMatrix({ 0.5f, 0.25f, 2.0f }));
+static_assert(Conversion({ 1.0f, 1.0f, 1.0f }, Multiply4x4(MakeScaleMatrix({ 2.0f, 3.0f, 4.0f }), MakeTranslateMatrix({ 1.0f, 2.0f, 3.0f }))) == Vector3{ 3.0f, 5.0f, 7.0f });
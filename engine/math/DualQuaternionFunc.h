@@ -0,0 +1,138 @@
+/*********************************************************************
+ * \file   DualQuaternionFunc.h
+ * \brief  デュアルクォータニオンの計算関数(スキニング用)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   回転と平行移動だけの変換を8成分で表す。ボーン行列を線形にブレンドすると
+ *         関節がつぶれる(キャンディラッパー)が、DLB(線形ブレンド後に正規化)なら形が保たれる
+ *********************************************************************/
+#pragma once
+#include <span>
+#include <stdexcept>
+#include "DualQuaternion.h"
+#include "QuaternionFunc.h"
+
+/**----------------------------------------------------------------------------
+ * \brief  IdentityDualQuaternion 何もしないデュアルクォータニオン
+ * \return DualQuaternion
+ */
+inline constexpr DualQuaternion IdentityDualQuaternion() {
+	return { IdentityQuaternion(), { 0.0f, 0.0f, 0.0f, 0.0f } };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeDualQuaternion 回転と平行移動からデュアルクォータニオンを作る
+ * \param  rotate 単位クォータニオン
+ * \param  translate 回転の後にかける平行移動
+ * \return DualQuaternion
+ */
+inline constexpr DualQuaternion MakeDualQuaternion(const Quaternion& rotate, const Vector3& translate) {
+	Quaternion dual = MultiplyQuaternion({ translate.x, translate.y, translate.z, 0.0f }, rotate);
+	return { rotate, { dual.x * 0.5f, dual.y * 0.5f, dual.z * 0.5f, dual.w * 0.5f } };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeDualQuaternionFromMatrix 回転と平行移動だけの行列からデュアルクォータニオンを作る
+ * \param  matrix 拡大縮小を含まないアフィン行列
+ * \return DualQuaternion
+ */
+inline DualQuaternion MakeDualQuaternionFromMatrix(const Matrix4x4& matrix) {
+	return MakeDualQuaternion(MakeQuaternionFromMatrix(matrix), { matrix.m[3][0], matrix.m[3][1], matrix.m[3][2] });
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MultiplyDualQuaternion デュアルクォータニオンの積
+ * \param  dq1 後からかける変換
+ * \param  dq2 先にかける変換
+ * \return DualQuaternion
+ */
+inline constexpr DualQuaternion MultiplyDualQuaternion(const DualQuaternion& dq1, const DualQuaternion& dq2) {
+	Quaternion real = MultiplyQuaternion(dq1.real, dq2.real);
+	Quaternion dualA = MultiplyQuaternion(dq1.real, dq2.dual);
+	Quaternion dualB = MultiplyQuaternion(dq1.dual, dq2.real);
+	return { real, { dualA.x + dualB.x, dualA.y + dualB.y, dualA.z + dualB.z, dualA.w + dualB.w } };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  NormalizeDualQuaternion デュアルクォータニオンの正規化
+ * \param  dualQuaternion
+ * \return DualQuaternion
+ * \note   実部の長さで両方を割る。実部の長さが0なら変換として扱えない
+ */
+inline DualQuaternion NormalizeDualQuaternion(const DualQuaternion& dualQuaternion) {
+	const Quaternion& real = dualQuaternion.real;
+	const Quaternion& dual = dualQuaternion.dual;
+	float length = std::sqrt(DotQuaternion(real, real));
+	if(length == 0.0f) {
+		throw std::runtime_error("DualQuaternion has zero real part and cannot be normalized.");
+	}
+	float inverseLength = 1.0f / length;
+	return {
+		{ real.x * inverseLength, real.y * inverseLength, real.z * inverseLength, real.w * inverseLength },
+		{ dual.x * inverseLength, dual.y * inverseLength, dual.z * inverseLength, dual.w * inverseLength },
+	};
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  GetTranslation デュアルクォータニオンの平行移動を取り出す
+ * \param  dualQuaternion 正規化済み
+ * \return Vector3
+ * \note   t = 2 * dual * conjugate(real) のベクトル部
+ */
+inline constexpr Vector3 GetTranslation(const DualQuaternion& dualQuaternion) {
+	Quaternion t = MultiplyQuaternion(dualQuaternion.dual, ConjugateQuaternion(dualQuaternion.real));
+	return { t.x * 2.0f, t.y * 2.0f, t.z * 2.0f };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  TransformPoint 点を変換する
+ * \param  point
+ * \param  dualQuaternion 正規化済み
+ * \return Vector3
+ */
+inline constexpr Vector3 TransformPoint(const Vector3& point, const DualQuaternion& dualQuaternion) {
+	return RotateVector(point, dualQuaternion.real) + GetTranslation(dualQuaternion);
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeRigidMatrix デュアルクォータニオンから行列を作る
+ * \param  dualQuaternion 正規化済み
+ * \return Matrix4x4
+ */
+inline constexpr Matrix4x4 MakeRigidMatrix(const DualQuaternion& dualQuaternion) {
+	Matrix4x4 result = MakeRotateMatrix(dualQuaternion.real);
+	Vector3 translate = GetTranslation(dualQuaternion);
+	result.m[3][0] = translate.x;
+	result.m[3][1] = translate.y;
+	result.m[3][2] = translate.z;
+	return result;
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  BlendDualQuaternions 重み付きでブレンドする(スキニング用)
+ * \param  dualQuaternions 各ボーンの変換
+ * \param  weights 各ボーンの重み(dualQuaternionsと同じ数)
+ * \return 正規化したDualQuaternion
+ * \note   q と -q は同じ回転なので、先頭と逆向きのものは符号を反転して足す
+ */
+inline DualQuaternion BlendDualQuaternions(std::span<const DualQuaternion> dualQuaternions, std::span<const float> weights) {
+	if(dualQuaternions.empty() || dualQuaternions.size() != weights.size()) {
+		throw std::runtime_error("BlendDualQuaternions requires one weight per DualQuaternion.");
+	}
+	const Quaternion& pivot = dualQuaternions[0].real;
+	DualQuaternion sum = { { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 0.0f } };
+	for(size_t i = 0; i < dualQuaternions.size(); ++i) {
+		const DualQuaternion& dq = dualQuaternions[i];
+		float weight = DotQuaternion(pivot, dq.real) < 0.0f ? -weights[i] : weights[i];
+		sum.real.x += dq.real.x * weight;
+		sum.real.y += dq.real.y * weight;
+		sum.real.z += dq.real.z * weight;
+		sum.real.w += dq.real.w * weight;
+		sum.dual.x += dq.dual.x * weight;
+		sum.dual.y += dq.dual.y * weight;
+		sum.dual.z += dq.dual.z * weight;
+		sum.dual.w += dq.dual.w * weight;
+	}
+	return NormalizeDualQuaternion(sum);
+}
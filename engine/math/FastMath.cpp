@@ -0,0 +1,77 @@
+/*********************************************************************
+ * \file   FastMath.cpp
+ * \brief  近似のsin・cos・逆平方根(まとめて求める版)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "FastMath.h"
+#include <cassert>
+
+///=============================================================================
+///						まとめてsin・cos
+void FastMath::SinCos(std::span<const float> angles, std::span<float> sinResults, std::span<float> cosResults) {
+	assert(sinResults.size() >= angles.size() && cosResults.size() >= angles.size());
+	size_t count = angles.size();
+	size_t index = 0;
+#ifdef MATH_SIMD_SSE
+	//========================================
+	// 4つずつ求める
+	for(; index + 4 <= count; index += 4) {
+		__m128 s, c;
+		MathSimd::SinCos(_mm_loadu_ps(&angles[index]), s, c);
+		_mm_storeu_ps(&sinResults[index], s);
+		_mm_storeu_ps(&cosResults[index], c);
+	}
+#endif
+	//========================================
+	// 端数
+	for(; index < count; ++index) {
+		SinCos(angles[index], sinResults[index], cosResults[index]);
+	}
+}
+
+///=============================================================================
+///						まとめて逆平方根
+void FastMath::InverseSqrt(std::span<const float> values, std::span<float> results) {
+	assert(results.size() >= values.size());
+	size_t count = values.size();
+	size_t index = 0;
+#ifdef MATH_SIMD_SSE
+	for(; index + 4 <= count; index += 4) {
+		_mm_storeu_ps(&results[index], MathSimd::InverseSqrt(_mm_loadu_ps(&values[index])));
+	}
+#endif
+	for(; index < count; ++index) {
+		results[index] = InverseSqrt(values[index]);
+	}
+}
+
+///=============================================================================
+///						まとめて正規化
+void FastMath::Normalize(std::span<Vector3> vectors) {
+	size_t count = vectors.size();
+	size_t index = 0;
+#ifdef MATH_SIMD_SSE
+	//========================================
+	// 長さの2乗を4つ集めて逆平方根を一度に求める
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	for(; index + 4 <= count; index += 4) {
+		Vector3* v = &vectors[index];
+		__m128 lengthSquared = _mm_setr_ps(Dot(v[0], v[0]), Dot(v[1], v[1]), Dot(v[2], v[2]), Dot(v[3], v[3]));
+		// ゼロベクトルは1をかけてそのまま残す
+		__m128 isZero = _mm_cmpeq_ps(lengthSquared, zero);
+		__m128 scale = _mm_or_ps(_mm_and_ps(isZero, one), _mm_andnot_ps(isZero, MathSimd::InverseSqrt(lengthSquared)));
+		alignas(16) float scales[4];
+		_mm_store_ps(scales, scale);
+		for(int lane = 0; lane < 4; ++lane) {
+			v[lane] = v[lane] * scales[lane];
+		}
+	}
+#endif
+	for(; index < count; ++index) {
+		vectors[index] = FastMath::Normalize(vectors[index]);
+	}
+}
@@ -10,7 +10,9 @@
 
 #pragma once
 #include <stdexcept>
+#include <type_traits>
 #include "Matrix4x4.h"
+#include "MathSimd.h"
 
 /**----------------------------------------------------------------------------
  * \brief  Add4x4 行列の加算
@@ -19,7 +21,7 @@
  * \return Matrix4x4
  * \note   
  */
-inline Matrix4x4 Add4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
+inline constexpr Matrix4x4 Add4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
 	Matrix4x4 result;
 	for (int i = 0; i < 4; ++i) {
 		for (int j = 0; j < 4; ++j) {
@@ -36,7 +38,7 @@ inline Matrix4x4 Add4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
  * \return Matrix4x4
  * \note   
  */
-inline Matrix4x4 Subtract4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
+inline constexpr Matrix4x4 Subtract4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
 	Matrix4x4 result;
 	for (int i = 0; i < 4; ++i) {
 		for (int j = 0; j < 4; ++j) {
@@ -47,13 +49,13 @@ inline Matrix4x4 Subtract4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
 }
 
 /**----------------------------------------------------------------------------
- * \brief  Multiply4x4 行列の乗算
+ * \brief  Multiply4x4Scalar 行列の乗算(スカラー版)
  * \param  m1
  * \param  m2
  * \return Matrix4x4
- * \note
+ * \note   SIMD版の結果を確かめるための基準として残している
  */
-inline Matrix4x4 Multiply4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
+inline constexpr Matrix4x4 Multiply4x4Scalar(const Matrix4x4& m1, const Matrix4x4& m2) {
 	Matrix4x4 result;
 
 	// 行列の各成分を直接計算して結果を求める
@@ -80,20 +82,71 @@ inline Matrix4x4 Multiply4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
 	return result;
 }
 
+/**----------------------------------------------------------------------------
+ * \brief  Multiply4x4 行列の乗算
+ * \param  m1
+ * \param  m2
+ * \return Matrix4x4
+ * \note   結果の各行は m2の各行 を m1の行の成分で重み付けした和なので、
+ *         m1の成分を4レーンに広げて積和を4回行う
+ */
+inline constexpr Matrix4x4 Multiply4x4(const Matrix4x4& m1, const Matrix4x4& m2) {
+	// コンパイル時はSIMD命令を使えないのでスカラー版で求める
+	if (std::is_constant_evaluated()) {
+		return Multiply4x4Scalar(m1, m2);
+	}
+#if defined(MATH_SIMD_SSE)
+	Matrix4x4 result;
+	__m128 row0 = _mm_load_ps(m2.m[0]);
+	__m128 row1 = _mm_load_ps(m2.m[1]);
+	__m128 row2 = _mm_load_ps(m2.m[2]);
+	__m128 row3 = _mm_load_ps(m2.m[3]);
+	auto multiplyRow = [&](const float* row) {
+		__m128 a = _mm_load_ps(row);
+		__m128 r = _mm_mul_ps(MathSimd::Splat<0>(a), row0);
+		r = MathSimd::MultiplyAdd(MathSimd::Splat<1>(a), row1, r);
+		r = MathSimd::MultiplyAdd(MathSimd::Splat<2>(a), row2, r);
+		return MathSimd::MultiplyAdd(MathSimd::Splat<3>(a), row3, r);
+	};
+	_mm_store_ps(result.m[0], multiplyRow(m1.m[0]));
+	_mm_store_ps(result.m[1], multiplyRow(m1.m[1]));
+	_mm_store_ps(result.m[2], multiplyRow(m1.m[2]));
+	_mm_store_ps(result.m[3], multiplyRow(m1.m[3]));
+	return result;
+#elif defined(MATH_SIMD_NEON)
+	Matrix4x4 result;
+	float32x4_t row0 = vld1q_f32(m2.m[0]);
+	float32x4_t row1 = vld1q_f32(m2.m[1]);
+	float32x4_t row2 = vld1q_f32(m2.m[2]);
+	float32x4_t row3 = vld1q_f32(m2.m[3]);
+	for (int i = 0; i < 4; ++i) {
+		float32x4_t a = vld1q_f32(m1.m[i]);
+		float32x4_t r = vmulq_laneq_f32(row0, a, 0);
+		r = vfmaq_laneq_f32(r, row1, a, 1);
+		r = vfmaq_laneq_f32(r, row2, a, 2);
+		r = vfmaq_laneq_f32(r, row3, a, 3);
+		vst1q_f32(result.m[i], r);
+	}
+	return result;
+#else
+	return Multiply4x4Scalar(m1, m2);
+#endif
+}
+
 
 // 余因子行列の計算に必要なサブ行列を計算するヘルパー関数
-inline Matrix4x4 Cofactor4x4(const Matrix4x4& matrix);
+inline constexpr Matrix4x4 Cofactor4x4(const Matrix4x4& matrix);
 
 // 余因子行列の計算に必要な小行列式を計算するヘルパー関数
-inline float Minor(const Matrix4x4& matrix, int row, int col);
+inline constexpr float Minor(const Matrix4x4& matrix, int row, int col);
 
 /**----------------------------------------------------------------------------
- * \brief  Inverse4x4 逆行列を求める
+ * \brief  Inverse4x4Scalar 逆行列を求める(スカラー版)
  * \param  matrix 
  * \return Matrix4x4
- * \note   
+ * \note   SIMD版の結果を確かめるための基準として残している
  */
-inline Matrix4x4 Inverse4x4(const Matrix4x4& matrix) {
+inline constexpr Matrix4x4 Inverse4x4Scalar(const Matrix4x4& matrix) {
 	// 行列式を計算
 	float det =
 		matrix.m[0][0] * ( matrix.m[1][1] * matrix.m[2][2] * matrix.m[3][3] +
@@ -146,13 +199,183 @@ inline Matrix4x4 Inverse4x4(const Matrix4x4& matrix) {
 	return inverseMatrix;
 }
 
+#ifdef MATH_SIMD_SSE
+namespace MathSimd {
+	/// \brief 2x2行列(行優先で1レジスタ)の積 A * B
+	inline __m128 Multiply2x2(__m128 a, __m128 b) {
+		return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+			_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	/// \brief 2x2行列の 余因子行列(A) * B
+	inline __m128 AdjugateMultiply2x2(__m128 a, __m128 b) {
+		return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+			_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	/// \brief 2x2行列の A * 余因子行列(B)
+	inline __m128 MultiplyAdjugate2x2(__m128 a, __m128 b) {
+		return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+			_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+}
+#endif
+
+/**----------------------------------------------------------------------------
+ * \brief  Inverse4x4 逆行列を求める
+ * \param  matrix 
+ * \return Matrix4x4
+ * \note   SSE版は4x4を2x2のブロック A B / C D に分け、ブロックの行列式と
+ *         余因子行列から逆行列を組み立てる(16個の小行列式を個別に求めない)
+ */
+inline constexpr Matrix4x4 Inverse4x4(const Matrix4x4& matrix) {
+	if (std::is_constant_evaluated()) {
+		return Inverse4x4Scalar(matrix);
+	}
+#ifdef MATH_SIMD_SSE
+	__m128 row0 = _mm_load_ps(matrix.m[0]);
+	__m128 row1 = _mm_load_ps(matrix.m[1]);
+	__m128 row2 = _mm_load_ps(matrix.m[2]);
+	__m128 row3 = _mm_load_ps(matrix.m[3]);
+	//========================================
+	// 2x2のブロックに分ける
+	__m128 a = _mm_movelh_ps(row0, row1);
+	__m128 b = _mm_movehl_ps(row1, row0);
+	__m128 c = _mm_movelh_ps(row2, row3);
+	__m128 d = _mm_movehl_ps(row3, row2);
+
+	//========================================
+	// 各ブロックの行列式 (|A|, |B|, |C|, |D|)
+	__m128 detSub = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+	__m128 detA = MathSimd::Splat<0>(detSub);
+	__m128 detB = MathSimd::Splat<1>(detSub);
+	__m128 detC = MathSimd::Splat<2>(detSub);
+	__m128 detD = MathSimd::Splat<3>(detSub);
+
+	//========================================
+	// 逆行列の各ブロックの余因子行列
+	__m128 adjDC = MathSimd::AdjugateMultiply2x2(d, c);
+	__m128 adjAB = MathSimd::AdjugateMultiply2x2(a, b);
+	__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), MathSimd::Multiply2x2(b, adjDC));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), MathSimd::Multiply2x2(c, adjAB));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), MathSimd::MultiplyAdjugate2x2(d, adjAB));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), MathSimd::MultiplyAdjugate2x2(a, adjDC));
+
+	//========================================
+	// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+	__m128 trace = _mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, _MM_SHUFFLE(3, 1, 2, 0)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+	__m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+	// 行列式が0の場合は逆行列は存在しない
+	if (_mm_cvtss_f32(det) == 0.0f) {
+		throw std::runtime_error("Matrix is singular and cannot be inverted.");
+	}
+
+	//========================================
+	// 余因子の符号をかけて行列式で割り、元の並びに戻す
+	__m128 inverseDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+	x = _mm_mul_ps(x, inverseDet);
+	y = _mm_mul_ps(y, inverseDet);
+	z = _mm_mul_ps(z, inverseDet);
+	w = _mm_mul_ps(w, inverseDet);
+	Matrix4x4 result;
+	_mm_store_ps(result.m[0], _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_store_ps(result.m[1], _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+	_mm_store_ps(result.m[2], _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_store_ps(result.m[3], _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+	return result;
+#else
+	return Inverse4x4Scalar(matrix);
+#endif
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  InverseAffine アフィン行列の逆行列を求める
+ * \param  matrix 4列目が(0, 0, 0, 1)の行列(拡大縮小・回転・平行移動の合成)
+ * \return Matrix4x4
+ * \note   左上3x3の逆行列 A^-1 と -t * A^-1 だけを求める。
+ *         4列目が(0, 0, 0, 1)でない行列(射影など)にはInverse4x4を使う
+ */
+inline constexpr Matrix4x4 InverseAffine(const Matrix4x4& matrix) {
+	const float (&m)[4][4] = matrix.m;
+	//========================================
+	// 左上3x3の余因子(転置済み)と行列式
+	float c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+	float c01 = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+	float c02 = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+	float c10 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+	float c11 = m[0][0] * m[2][2] - m[0][2] * m[2][0];
+	float c12 = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+	float c20 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+	float c21 = m[0][1] * m[2][0] - m[0][0] * m[2][1];
+	float c22 = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+	float det = m[0][0] * c00 + m[0][1] * c10 + m[0][2] * c20;
+	// 行列式が0の場合は逆行列は存在しない
+	if (det == 0) {
+		throw std::runtime_error("Matrix is singular and cannot be inverted.");
+	}
+	float inverseDet = 1.0f / det;
+
+	//========================================
+	// A^-1 と -t * A^-1
+	Matrix4x4 result;
+	result.m[0][0] = c00 * inverseDet;
+	result.m[0][1] = c01 * inverseDet;
+	result.m[0][2] = c02 * inverseDet;
+	result.m[0][3] = 0.0f;
+	result.m[1][0] = c10 * inverseDet;
+	result.m[1][1] = c11 * inverseDet;
+	result.m[1][2] = c12 * inverseDet;
+	result.m[1][3] = 0.0f;
+	result.m[2][0] = c20 * inverseDet;
+	result.m[2][1] = c21 * inverseDet;
+	result.m[2][2] = c22 * inverseDet;
+	result.m[2][3] = 0.0f;
+	result.m[3][0] = -( m[3][0] * result.m[0][0] + m[3][1] * result.m[1][0] + m[3][2] * result.m[2][0] );
+	result.m[3][1] = -( m[3][0] * result.m[0][1] + m[3][1] * result.m[1][1] + m[3][2] * result.m[2][1] );
+	result.m[3][2] = -( m[3][0] * result.m[0][2] + m[3][1] * result.m[1][2] + m[3][2] * result.m[2][2] );
+	result.m[3][3] = 1.0f;
+	return result;
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  InverseRigid 回転と平行移動だけの行列の逆行列を求める
+ * \param  matrix 拡大縮小を含まない(左上3x3が正規直交の)アフィン行列
+ * \return Matrix4x4
+ * \note   回転の逆は転置なので割り算がいらない。拡大縮小を含む行列にはInverseAffineを使う
+ */
+inline constexpr Matrix4x4 InverseRigid(const Matrix4x4& matrix) {
+	const float (&m)[4][4] = matrix.m;
+	Matrix4x4 result;
+	result.m[0][0] = m[0][0];
+	result.m[0][1] = m[1][0];
+	result.m[0][2] = m[2][0];
+	result.m[0][3] = 0.0f;
+	result.m[1][0] = m[0][1];
+	result.m[1][1] = m[1][1];
+	result.m[1][2] = m[2][1];
+	result.m[1][3] = 0.0f;
+	result.m[2][0] = m[0][2];
+	result.m[2][1] = m[1][2];
+	result.m[2][2] = m[2][2];
+	result.m[2][3] = 0.0f;
+	result.m[3][0] = -( m[3][0] * m[0][0] + m[3][1] * m[0][1] + m[3][2] * m[0][2] );
+	result.m[3][1] = -( m[3][0] * m[1][0] + m[3][1] * m[1][1] + m[3][2] * m[1][2] );
+	result.m[3][2] = -( m[3][0] * m[2][0] + m[3][1] * m[2][1] + m[3][2] * m[2][2] );
+	result.m[3][3] = 1.0f;
+	return result;
+}
+
 /**----------------------------------------------------------------------------
  * \brief  Cofactor4x4 余因子行列を求める
  * \param  matrix
  * \return 
  * \note   
  */
-inline Matrix4x4 Cofactor4x4(const Matrix4x4& matrix) {
+inline constexpr Matrix4x4 Cofactor4x4(const Matrix4x4& matrix) {
 	Matrix4x4 cofactorMatrix;
 	for (int i = 0; i < 4; i++) {
 		for (int j = 0; j < 4; j++) {
@@ -172,7 +395,7 @@ inline Matrix4x4 Cofactor4x4(const Matrix4x4& matrix) {
  * \return 
  * \note   
  */
-inline float Minor(const Matrix4x4& matrix, int row, int col) {
+inline constexpr float Minor(const Matrix4x4& matrix, int row, int col) {
 	float subMatrix[3][3];
 	int subRow = 0;
 	for (int i = 0; i < 4; i++) {
@@ -197,7 +420,7 @@ inline float Minor(const Matrix4x4& matrix, int row, int col) {
  * \return 
  * \note   
  */
-inline Matrix4x4 Transpose4x4(const Matrix4x4& matrix) {
+inline constexpr Matrix4x4 Transpose4x4(const Matrix4x4& matrix) {
 	Matrix4x4 result;
 	for (int i = 0; i < 4; ++i) {
 		for (int j = 0; j < 4; ++j) {
@@ -212,7 +435,7 @@ inline Matrix4x4 Transpose4x4(const Matrix4x4& matrix) {
  * \return 
  * \note   
  */
-inline Matrix4x4 Identity4x4() {
+inline constexpr Matrix4x4 Identity4x4() {
 	Matrix4x4 result;
 	for (int i = 0; i < 4; ++i) {
 		for (int j = 0; j < 4; ++j) {
@@ -225,3 +448,9 @@ inline Matrix4x4 Identity4x4() {
 	}
 	return result;
 }
+
+///=============================================================================
+///						コンパイル時の確認
+static_assert(Multiply4x4(Identity4x4(), Identity4x4()) == Identity4x4());
+static_assert(Transpose4x4(Identity4x4()) == Identity4x4());
+static_assert(Inverse4x4(Identity4x4()) == Identity4x4());
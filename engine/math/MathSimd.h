@@ -0,0 +1,44 @@
+/*********************************************************************
+ * \file   MathSimd.h
+ * \brief  数学関数で使うSIMD命令セットの選択
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   x64はSSE2が必ずあるのでSSE版を使う(/arch:AVX2ならFMAも使う)。
+ *         ARM64はNEON版、それ以外はスカラー版になる。
+ *         MATH_NO_SIMDを定義するとすべてスカラー版にできる(結果の比較用)
+ *********************************************************************/
+#pragma once
+
+#if !defined(MATH_NO_SIMD) && ( defined(_M_X64) || defined(__SSE2__) )
+#define MATH_SIMD_SSE
+#include <emmintrin.h>
+#if defined(__AVX2__) || defined(__FMA__)
+#define MATH_SIMD_FMA
+#include <immintrin.h>
+#endif
+#elif !defined(MATH_NO_SIMD) && ( defined(_M_ARM64) || defined(__aarch64__) )
+#define MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef MATH_SIMD_SSE
+///=============================================================================
+///						SSEの補助関数
+namespace MathSimd {
+	/// \brief a * b + c
+	inline __m128 MultiplyAdd(__m128 a, __m128 b, __m128 c) {
+#ifdef MATH_SIMD_FMA
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+	/// \brief 1つのレーンを4レーンに広げる
+	template <int lane>
+	inline __m128 Splat(__m128 v) {
+		return _mm_shuffle_ps(v, v, _MM_SHUFFLE(lane, lane, lane, lane));
+	}
+}
+#endif
@@ -0,0 +1,366 @@
+/*********************************************************************
+ * \file   QuaternionFunc.h
+ * \brief  クォータニオンの計算関数
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   q1 * q2 はハミルトン積で、q2の回転の後にq1の回転をかける。
+ *         行列は行ベクトル(v * M)なので MakeRotateMatrix(q1 * q2) = M(q2) * M(q1) になる
+ *********************************************************************/
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include "Quaternion.h"
+#include "Vector3.h"
+#include "Matrix4x4.h"
+#include "Transform.h"
+#include "MathSimd.h"
+
+/**----------------------------------------------------------------------------
+ * \brief  IdentityQuaternion 回転なしのクォータニオン
+ * \return Quaternion
+ */
+inline constexpr Quaternion IdentityQuaternion() {
+	return { 0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MultiplyQuaternionScalar クォータニオンの積(スカラー版)
+ * \param  q1
+ * \param  q2
+ * \return Quaternion
+ * \note   SIMD版の結果を確かめるための基準として残している
+ */
+inline constexpr Quaternion MultiplyQuaternionScalar(const Quaternion& q1, const Quaternion& q2) {
+	return {
+		q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
+		q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x,
+		q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w,
+		q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z,
+	};
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MultiplyQuaternion クォータニオンの積
+ * \param  q1 後からかける回転
+ * \param  q2 先にかける回転
+ * \return Quaternion
+ * \note   q1の各成分を4レーンに広げ、並べ替えて符号を変えたq2との積和を4回行う
+ */
+inline constexpr Quaternion MultiplyQuaternion(const Quaternion& q1, const Quaternion& q2) {
+	// コンパイル時はSIMD命令を使えないのでスカラー版で求める
+	if(std::is_constant_evaluated()) {
+		return MultiplyQuaternionScalar(q1, q2);
+	}
+#if defined(MATH_SIMD_SSE)
+	Quaternion result;
+	__m128 a = _mm_load_ps(&q1.x);
+	__m128 b = _mm_load_ps(&q2.x);
+	// 符号を反転するレーン(-0.0fとのxor)
+	const __m128 signX = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+	const __m128 signY = _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f);
+	const __m128 signZ = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+	// x1 * ( w2, -z2,  y2, -x2)
+	// y1 * ( z2,  w2, -x2, -y2)
+	// z1 * (-y2,  x2,  w2, -z2)
+	// w1 * ( x2,  y2,  z2,  w2)
+	__m128 bx = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), signX);
+	__m128 by = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), signY);
+	__m128 bz = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), signZ);
+	__m128 r = _mm_mul_ps(MathSimd::Splat<3>(a), b);
+	r = MathSimd::MultiplyAdd(MathSimd::Splat<0>(a), bx, r);
+	r = MathSimd::MultiplyAdd(MathSimd::Splat<1>(a), by, r);
+	r = MathSimd::MultiplyAdd(MathSimd::Splat<2>(a), bz, r);
+	_mm_store_ps(&result.x, r);
+	return result;
+#else
+	return MultiplyQuaternionScalar(q1, q2);
+#endif
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  DotQuaternion クォータニオンの内積
+ * \param  q1
+ * \param  q2
+ * \return float
+ */
+inline constexpr float DotQuaternion(const Quaternion& q1, const Quaternion& q2) {
+	return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  ConjugateQuaternion 共役クォータニオン
+ * \param  quaternion
+ * \return Quaternion
+ * \note   単位クォータニオンなら逆回転になる
+ */
+inline constexpr Quaternion ConjugateQuaternion(const Quaternion& quaternion) {
+	return { -quaternion.x, -quaternion.y, -quaternion.z, quaternion.w };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  NormalizeQuaternion クォータニオンの正規化
+ * \param  quaternion
+ * \return Quaternion
+ * \note   長さが0ならそのまま返す
+ */
+inline Quaternion NormalizeQuaternion(const Quaternion& quaternion) {
+	float length = std::sqrt(DotQuaternion(quaternion, quaternion));
+	if(length == 0.0f) {
+		return quaternion;
+	}
+	float inverseLength = 1.0f / length;
+	return { quaternion.x * inverseLength, quaternion.y * inverseLength, quaternion.z * inverseLength, quaternion.w * inverseLength };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  InverseQuaternion 逆クォータニオン
+ * \param  quaternion
+ * \return Quaternion
+ * \note   長さが0なら逆は存在しない。単位クォータニオンならConjugateQuaternionでよい
+ */
+inline Quaternion InverseQuaternion(const Quaternion& quaternion) {
+	float lengthSquared = DotQuaternion(quaternion, quaternion);
+	if(lengthSquared == 0.0f) {
+		throw std::runtime_error("Quaternion has zero length and cannot be inverted.");
+	}
+	float inverseLengthSquared = 1.0f / lengthSquared;
+	return { -quaternion.x * inverseLengthSquared, -quaternion.y * inverseLengthSquared, -quaternion.z * inverseLengthSquared, quaternion.w * inverseLengthSquared };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeRotateAxisAngleQuaternion 任意軸回転のクォータニオン
+ * \param  axis 回転軸(正規化済み)
+ * \param  angle 回転角(ラジアン)
+ * \return Quaternion
+ */
+inline Quaternion MakeRotateAxisAngleQuaternion(const Vector3& axis, float angle) {
+	float s = std::sin(angle * 0.5f);
+	return { axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f) };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeRotateQuaternion オイラー角からクォータニオンを作る
+ * \param  rotate 各軸の回転角(ラジアン)
+ * \return Quaternion
+ * \note   MakeAffineMatrixと同じくX→Y→Zの順にかける(qz * qy * qx を展開した式)
+ */
+inline Quaternion MakeRotateQuaternion(const Vector3& rotate) {
+	//半角のsin・cosは1回ずつ
+	float sx = std::sin(rotate.x * 0.5f);
+	float cx = std::cos(rotate.x * 0.5f);
+	float sy = std::sin(rotate.y * 0.5f);
+	float cy = std::cos(rotate.y * 0.5f);
+	float sz = std::sin(rotate.z * 0.5f);
+	float cz = std::cos(rotate.z * 0.5f);
+	return {
+		cz * cy * sx - sz * sy * cx,
+		cz * sy * cx + sz * cy * sx,
+		sz * cy * cx - cz * sy * sx,
+		cz * cy * cx + sz * sy * sx,
+	};
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  RotateVector ベクトルを回転する
+ * \param  vector
+ * \param  quaternion 単位クォータニオン
+ * \return Vector3
+ * \note   q * v * q^-1 を展開した v + w * t + u x t (t = 2 * u x v, u は虚部)で求める
+ */
+inline constexpr Vector3 RotateVector(const Vector3& vector, const Quaternion& quaternion) {
+	const Quaternion& q = quaternion;
+	Vector3 t = {
+		2.0f * ( q.y * vector.z - q.z * vector.y ),
+		2.0f * ( q.z * vector.x - q.x * vector.z ),
+		2.0f * ( q.x * vector.y - q.y * vector.x ),
+	};
+	return {
+		vector.x + q.w * t.x + ( q.y * t.z - q.z * t.y ),
+		vector.y + q.w * t.y + ( q.z * t.x - q.x * t.z ),
+		vector.z + q.w * t.z + ( q.x * t.y - q.y * t.x ),
+	};
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeRotateMatrix クォータニオンから回転行列を作る
+ * \param  quaternion 単位クォータニオン
+ * \return Matrix4x4
+ */
+inline constexpr Matrix4x4 MakeRotateMatrix(const Quaternion& quaternion) {
+	const Quaternion& q = quaternion;
+	float xx = q.x * q.x;
+	float yy = q.y * q.y;
+	float zz = q.z * q.z;
+	float xy = q.x * q.y;
+	float xz = q.x * q.z;
+	float yz = q.y * q.z;
+	float wx = q.w * q.x;
+	float wy = q.w * q.y;
+	float wz = q.w * q.z;
+	return { {
+		{ 1.0f - 2.0f * ( yy + zz ), 2.0f * ( xy + wz ), 2.0f * ( xz - wy ), 0.0f },
+		{ 2.0f * ( xy - wz ), 1.0f - 2.0f * ( xx + zz ), 2.0f * ( yz + wx ), 0.0f },
+		{ 2.0f * ( xz + wy ), 2.0f * ( yz - wx ), 1.0f - 2.0f * ( xx + yy ), 0.0f },
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+	} };
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeQuaternionFromMatrix 回転行列からクォータニオンを作る
+ * \param  matrix 左上3x3が回転だけの行列(拡大縮小を含む場合は各行を正規化してから渡す)
+ * \return Quaternion
+ * \note   対角成分の大きいものから求めて、0に近い値での割り算を避ける
+ */
+inline Quaternion MakeQuaternionFromMatrix(const Matrix4x4& matrix) {
+	const float (&m)[4][4] = matrix.m;
+	float trace = m[0][0] + m[1][1] + m[2][2];
+	Quaternion result;
+	if(trace > 0.0f) {
+		float s = std::sqrt(trace + 1.0f) * 2.0f;
+		result.w = 0.25f * s;
+		result.x = ( m[1][2] - m[2][1] ) / s;
+		result.y = ( m[2][0] - m[0][2] ) / s;
+		result.z = ( m[0][1] - m[1][0] ) / s;
+	} else if(m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+		float s = std::sqrt(1.0f + m[0][0] - m[1][1] - m[2][2]) * 2.0f;
+		result.w = ( m[1][2] - m[2][1] ) / s;
+		result.x = 0.25f * s;
+		result.y = ( m[0][1] + m[1][0] ) / s;
+		result.z = ( m[2][0] + m[0][2] ) / s;
+	} else if(m[1][1] > m[2][2]) {
+		float s = std::sqrt(1.0f + m[1][1] - m[0][0] - m[2][2]) * 2.0f;
+		result.w = ( m[2][0] - m[0][2] ) / s;
+		result.x = ( m[0][1] + m[1][0] ) / s;
+		result.y = 0.25f * s;
+		result.z = ( m[1][2] + m[2][1] ) / s;
+	} else {
+		float s = std::sqrt(1.0f + m[2][2] - m[0][0] - m[1][1]) * 2.0f;
+		result.w = ( m[0][1] - m[1][0] ) / s;
+		result.x = ( m[2][0] + m[0][2] ) / s;
+		result.y = ( m[1][2] + m[2][1] ) / s;
+		result.z = 0.25f * s;
+	}
+	return result;
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  QuaternionToEuler クォータニオンをオイラー角に戻す
+ * \param  quaternion 単位クォータニオン
+ * \return 各軸の回転角(MakeAffineMatrixと同じX→Y→Zの順)
+ * \note   Y軸が±90度付近ではZを0として残りをXにまとめる
+ */
+inline Vector3 QuaternionToEuler(const Quaternion& quaternion) {
+	const Quaternion& q = quaternion;
+	//回転行列の必要な成分だけを求める
+	float m00 = 1.0f - 2.0f * ( q.y * q.y + q.z * q.z );
+	float m01 = 2.0f * ( q.x * q.y + q.w * q.z );
+	float m02 = 2.0f * ( q.x * q.z - q.w * q.y );
+	float m12 = 2.0f * ( q.y * q.z + q.w * q.x );
+	float m22 = 1.0f - 2.0f * ( q.x * q.x + q.y * q.y );
+	// m02 = -sin(y)
+	float sinY = ( std::min )( ( std::max )( -m02, -1.0f ), 1.0f );
+	Vector3 result;
+	result.y = std::asin(sinY);
+	if(std::fabs(sinY) < 0.9999f) {
+		result.x = std::atan2(m12, m22);
+		result.z = std::atan2(m01, m00);
+	} else {
+		float m11 = 1.0f - 2.0f * ( q.x * q.x + q.z * q.z );
+		float m21 = 2.0f * ( q.y * q.z - q.w * q.x );
+		result.x = std::atan2(-m21, m11);
+		result.z = 0.0f;
+	}
+	return result;
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  Nlerp クォータニオンの線形補間(正規化つき)
+ * \param  q1 t = 0 の回転
+ * \param  q2 t = 1 の回転
+ * \param  t 補間係数
+ * \return Quaternion
+ * \note   角速度は一定にならないが、三角関数を使わないので多数のブレンドに向く
+ */
+inline Quaternion Nlerp(const Quaternion& q1, const Quaternion& q2, float t) {
+	//近い方の回転を通るよう、逆向きなら符号を反転する
+	float sign = DotQuaternion(q1, q2) < 0.0f ? -1.0f : 1.0f;
+	float t1 = 1.0f - t;
+	float t2 = t * sign;
+	return NormalizeQuaternion({
+		q1.x * t1 + q2.x * t2,
+		q1.y * t1 + q2.y * t2,
+		q1.z * t1 + q2.z * t2,
+		q1.w * t1 + q2.w * t2,
+		});
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  Slerp クォータニオンの球面線形補間
+ * \param  q1 t = 0 の回転
+ * \param  q2 t = 1 の回転
+ * \param  t 補間係数
+ * \return Quaternion
+ * \note   2つがほぼ同じ向きのときはsinが0に近づくのでNlerpで代用する
+ */
+inline Quaternion Slerp(const Quaternion& q1, const Quaternion& q2, float t) {
+	float dot = DotQuaternion(q1, q2);
+	Quaternion end = q2;
+	if(dot < 0.0f) {
+		dot = -dot;
+		end = { -q2.x, -q2.y, -q2.z, -q2.w };
+	}
+	if(dot > 0.9995f) {
+		return Nlerp(q1, end, t);
+	}
+	float theta = std::acos(dot);
+	float inverseSin = 1.0f / std::sin(theta);
+	float t1 = std::sin(( 1.0f - t ) * theta) * inverseSin;
+	float t2 = std::sin(t * theta) * inverseSin;
+	return {
+		q1.x * t1 + end.x * t2,
+		q1.y * t1 + end.y * t2,
+		q1.z * t1 + end.z * t2,
+		q1.w * t1 + end.w * t2,
+	};
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeAffineMatrix クォータニオンの回転でアフィン行列を作る
+ * \param  scale
+ * \param  rotate 単位クォータニオン
+ * \param  translate
+ * \return Matrix4x4
+ * \note   三角関数を使わず、回転行列の各行に拡大縮小をかけて平行移動を置く
+ */
+inline constexpr Matrix4x4 MakeAffineMatrix(const Vector3& scale, const Quaternion& rotate, const Vector3& translate) {
+	Matrix4x4 result = MakeRotateMatrix(rotate);
+	for(int i = 0; i < 3; ++i) {
+		result.m[0][i] *= scale.x;
+		result.m[1][i] *= scale.y;
+		result.m[2][i] *= scale.z;
+	}
+	result.m[3][0] = translate.x;
+	result.m[3][1] = translate.y;
+	result.m[3][2] = translate.z;
+	return result;
+}
+
+/**----------------------------------------------------------------------------
+ * \brief  MakeAffineMatrix QuaternionTransformからアフィン行列を作る
+ * \param  transform
+ * \return Matrix4x4
+ */
+inline constexpr Matrix4x4 MakeAffineMatrix(const QuaternionTransform& transform) {
+	return MakeAffineMatrix(transform.scale, transform.rotate, transform.translate);
+}
+
+///=============================================================================
+///						コンパイル時の確認
+// i * j = k
+static_assert(DotQuaternion(MultiplyQuaternion({ 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }), { 0.0f, 0.0f, 1.0f, 0.0f }) == 1.0f);
+// Z軸まわりに180度回すとXが反転する
+static_assert(RotateVector({ 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }) == Vector3{ -1.0f, 0.0f, 0.0f });
+static_assert(MakeRotateMatrix(IdentityQuaternion()).m[0][0] == 1.0f && MakeRotateMatrix(IdentityQuaternion()).m[1][2] == 0.0f);
@@ -14,7 +14,7 @@
 /// <param name="nearClip"></param>
 /// <param name="farClip"></param>
 /// <returns></returns>
-inline Matrix4x4 MakeOrthographicMatrix(float left, float top, float right, float bottom, float nearClip, float farClip) {
+inline constexpr Matrix4x4 MakeOrthographicMatrix(float left, float top, float right, float bottom, float nearClip, float farClip) {
 	// 単位行列で初期化
 	Matrix4x4 result = Identity4x4();
 
@@ -66,7 +66,7 @@ inline Matrix4x4 MakePerspectiveFovMatrix(float fovY, float aspectRatio, float n
 /// <param name="minDepth"></param>
 /// <param name="maxDepth"></param>
 /// <returns></returns>
-inline Matrix4x4 MakeViewportMatrix(float left, float top, float width, float height, float minDepth, float maxDepth) {
+inline constexpr Matrix4x4 MakeViewportMatrix(float left, float top, float width, float height, float minDepth, float maxDepth) {
 	// 単位行列で初期化
 	Matrix4x4 result = Identity4x4();
 
@@ -81,3 +81,9 @@ inline Matrix4x4 MakeViewportMatrix(float left, float top, float width, float he
 	return result;
 }
 
+///=============================================================================
+///						コンパイル時の確認
+// 画面の左上が(-1, 1)、右下が(1, -1)になる
+static_assert(MakeOrthographicMatrix(0.0f, 0.0f, 1280.0f, 720.0f, 0.0f, 100.0f).m[3][0] == -1.0f);
+static_assert(MakeOrthographicMatrix(0.0f, 0.0f, 1280.0f, 720.0f, 0.0f, 100.0f).m[3][1] == 1.0f);
+static_assert(MakeViewportMatrix(0.0f, 0.0f, 1280.0f, 720.0f, 0.0f, 1.0f).m[3][0] == 640.0f);
@@ -0,0 +1,196 @@
+/*********************************************************************
+ * \file   TransformBatch.cpp
+ * \brief  Transformの配列からGPU用の行列をまとめて書き込む
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TransformBatch.h"
+#include "MathSimd.h"
+#include "FastMath.h"
+#include "MathFunc4x4.h"
+#include "AffineTransformations.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+namespace {
+	///=============================================================================
+	///						書き込み先の並び
+	struct OutputLayout {
+		std::byte* base = nullptr;	// 先頭の要素
+		size_t stride = 0;			// 1要素の大きさ
+		size_t wvpOffset = 0;		// WVPの位置
+		size_t worldOffset = 0;		// Worldの位置
+	};
+
+	/// \brief 1行(4要素)の書き込み先
+	float* RowAddress(const OutputLayout& layout, size_t index, size_t offset, int row) {
+		return reinterpret_cast<float*>( layout.base + index * layout.stride + offset ) + row * 4;
+	}
+
+	///=============================================================================
+	///						1つずつ求める(端数とSIMDのない環境用)
+	void WriteOne(const Transform& transform, const Matrix4x4& billboard, const Matrix4x4& viewProjection,
+		const OutputLayout& layout, size_t index) {
+		Matrix4x4 world = Multiply4x4(billboard, MakeAffineMatrix(transform.scale, transform.rotate, transform.translate));
+		Matrix4x4 worldViewProjection = Multiply4x4(world, viewProjection);
+		for(int row = 0; row < 4; ++row) {
+			std::copy_n(worldViewProjection.m[row], 4, RowAddress(layout, index, layout.wvpOffset, row));
+			std::copy_n(world.m[row], 4, RowAddress(layout, index, layout.worldOffset, row));
+		}
+	}
+
+#ifdef MATH_SIMD_SSE
+	/// \brief 4行4列(各要素が4レーン)の行列を、レーンごとの行に並べ替えて書き込む
+	void StoreMatrices(const __m128 (&e)[4][4], const OutputLayout& layout, size_t index, size_t offset) {
+		__m128 rows[4][4];
+		for(int row = 0; row < 4; ++row) {
+			__m128 r0 = e[row][0];
+			__m128 r1 = e[row][1];
+			__m128 r2 = e[row][2];
+			__m128 r3 = e[row][3];
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			rows[0][row] = r0;
+			rows[1][row] = r1;
+			rows[2][row] = r2;
+			rows[3][row] = r3;
+		}
+		//1つの行列を前から順に書く(書き込み結合されるメモリ向け)
+		for(int lane = 0; lane < 4; ++lane) {
+			for(int row = 0; row < 4; ++row) {
+				_mm_storeu_ps(RowAddress(layout, index + lane, offset, row), rows[lane][row]);
+			}
+		}
+	}
+
+	///=============================================================================
+	///						4つ同時に求める
+	void WriteFour(const Transform* transforms, const Matrix4x4& billboard, const Matrix4x4& viewProjection,
+		const OutputLayout& layout, size_t index) {
+		//========================================
+		// SoAに並べる
+		auto gather = [&](auto member) {
+			return _mm_setr_ps(member(transforms[0]), member(transforms[1]), member(transforms[2]), member(transforms[3]));
+		};
+		__m128 scaleX = gather([](const Transform& t) { return t.scale.x; });
+		__m128 scaleY = gather([](const Transform& t) { return t.scale.y; });
+		__m128 scaleZ = gather([](const Transform& t) { return t.scale.z; });
+		__m128 sinX, cosX, sinY, cosY, sinZ, cosZ;
+		MathSimd::SinCos(gather([](const Transform& t) { return t.rotate.x; }), sinX, cosX);
+		MathSimd::SinCos(gather([](const Transform& t) { return t.rotate.y; }), sinY, cosY);
+		MathSimd::SinCos(gather([](const Transform& t) { return t.rotate.z; }), sinZ, cosZ);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		//========================================
+		// MakeAffineMatrixと同じ式で4つのワールド行列を作る
+		__m128 sinXsinY = _mm_mul_ps(sinX, sinY);
+		__m128 cosXsinY = _mm_mul_ps(cosX, sinY);
+		__m128 world[4][4] = {
+			{ _mm_mul_ps(scaleX, _mm_mul_ps(cosY, cosZ)), _mm_mul_ps(scaleX, _mm_mul_ps(cosY, sinZ)), _mm_mul_ps(scaleX, _mm_sub_ps(zero, sinY)), zero },
+			{ _mm_mul_ps(scaleY, _mm_sub_ps(_mm_mul_ps(sinXsinY, cosZ), _mm_mul_ps(cosX, sinZ))),
+				_mm_mul_ps(scaleY, MathSimd::MultiplyAdd(sinXsinY, sinZ, _mm_mul_ps(cosX, cosZ))),
+				_mm_mul_ps(scaleY, _mm_mul_ps(sinX, cosY)), zero },
+			{ _mm_mul_ps(scaleZ, MathSimd::MultiplyAdd(cosXsinY, cosZ, _mm_mul_ps(sinX, sinZ))),
+				_mm_mul_ps(scaleZ, _mm_sub_ps(_mm_mul_ps(cosXsinY, sinZ), _mm_mul_ps(sinX, cosZ))),
+				_mm_mul_ps(scaleZ, _mm_mul_ps(cosX, cosY)), zero },
+			{ gather([](const Transform& t) { return t.translate.x; }), gather([](const Transform& t) { return t.translate.y; }),
+				gather([](const Transform& t) { return t.translate.z; }), one },
+		};
+
+		//========================================
+		// 先にかける行列(ビルボード)
+		__m128 local[4][4];
+		std::copy(&world[0][0], &world[0][0] + 16, &local[0][0]);
+		for(int row = 0; row < 4; ++row) {
+			for(int column = 0; column < 3; ++column) {
+				__m128 value = _mm_mul_ps(_mm_set1_ps(billboard.m[row][0]), local[0][column]);
+				value = MathSimd::MultiplyAdd(_mm_set1_ps(billboard.m[row][1]), local[1][column], value);
+				value = MathSimd::MultiplyAdd(_mm_set1_ps(billboard.m[row][2]), local[2][column], value);
+				if(row == 3) {
+					value = _mm_add_ps(value, local[3][column]);
+				}
+				world[row][column] = value;
+			}
+		}
+
+		//========================================
+		// WVP = World * ViewProjection(Worldの4列目は(0, 0, 0, 1))
+		__m128 worldViewProjection[4][4];
+		for(int row = 0; row < 4; ++row) {
+			for(int column = 0; column < 4; ++column) {
+				__m128 value = _mm_mul_ps(world[row][0], _mm_set1_ps(viewProjection.m[0][column]));
+				value = MathSimd::MultiplyAdd(world[row][1], _mm_set1_ps(viewProjection.m[1][column]), value);
+				value = MathSimd::MultiplyAdd(world[row][2], _mm_set1_ps(viewProjection.m[2][column]), value);
+				if(row == 3) {
+					value = _mm_add_ps(value, _mm_set1_ps(viewProjection.m[3][column]));
+				}
+				worldViewProjection[row][column] = value;
+			}
+		}
+
+		//========================================
+		// 書き込み
+		StoreMatrices(worldViewProjection, layout, index, layout.wvpOffset);
+		StoreMatrices(world, layout, index, layout.worldOffset);
+	}
+#endif
+
+	///=============================================================================
+	///						範囲の処理
+	void WriteRange(std::span<const Transform> transforms, size_t begin, size_t end, const Matrix4x4& billboard,
+		const Matrix4x4& viewProjection, const OutputLayout& layout) {
+		size_t index = begin;
+#ifdef MATH_SIMD_SSE
+		for(; index + 4 <= end; index += 4) {
+			WriteFour(&transforms[index], billboard, viewProjection, layout, index);
+		}
+#endif
+		for(; index < end; ++index) {
+			WriteOne(transforms[index], billboard, viewProjection, layout, index);
+		}
+	}
+
+	///=============================================================================
+	///						スレッドへの振り分け
+	void Dispatch(std::span<const Transform> transforms, const Matrix4x4& billboard, const Matrix4x4& viewProjection,
+		const OutputLayout& layout, uint32_t threadCount) {
+		size_t count = transforms.size();
+		size_t maxThreadCount = ( std::max )( count / TransformBatch::kMinCountPerThread, size_t(1) );
+		size_t useThreadCount = ( std::min )( static_cast<size_t>( ( std::max )( threadCount, 1u ) ), maxThreadCount );
+		if(useThreadCount == 1) {
+			WriteRange(transforms, 0, count, billboard, viewProjection, layout);
+			return;
+		}
+		//========================================
+		// 4の倍数で区切り、最後の区間は呼び出したスレッドで処理する
+		size_t chunk = ( ( count + useThreadCount - 1 ) / useThreadCount + 3 ) & ~size_t(3);
+		std::vector<std::future<void>> futures;
+		futures.reserve(useThreadCount - 1);
+		size_t begin = 0;
+		for(size_t i = 0; i + 1 < useThreadCount && begin + chunk < count; ++i, begin += chunk) {
+			futures.push_back(std::async(std::launch::async, WriteRange, transforms, begin, begin + chunk, std::cref(billboard), std::cref(viewProjection), std::cref(layout)));
+		}
+		WriteRange(transforms, begin, count, billboard, viewProjection, layout);
+		for(std::future<void>& future : futures) {
+			future.get();
+		}
+	}
+}
+
+///=============================================================================
+///						パーティクル用
+void TransformBatch::WriteParticleMatrices(std::span<const Transform> transforms, const Matrix4x4& billboardMatrix,
+	const Matrix4x4& viewProjection, std::span<ParticleForGPU> output, uint32_t threadCount) {
+	assert(output.size() >= transforms.size());
+	OutputLayout layout;
+	layout.base = reinterpret_cast<std::byte*>( output.data() );
+	layout.stride = sizeof(ParticleForGPU);
+	layout.wvpOffset = offsetof(ParticleForGPU, WVP);
+	layout.worldOffset = offsetof(ParticleForGPU, World);
+	Dispatch(transforms, billboardMatrix, viewProjection, layout, threadCount);
+}
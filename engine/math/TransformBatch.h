@@ -0,0 +1,35 @@
+/*********************************************************************
+ * \file   TransformBatch.h
+ * \brief  Transformの配列からGPU用の行列をまとめて書き込む
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   4つのTransformを成分ごとのレジスタ(SoA)に並べ、sin・cos・SRTの合成・
+ *         ビュープロジェクションとの積を4つ同時に求める。
+ *         書き込み先はマップしたGPUメモリでもよい(1行ずつ前から順に書く)
+ *********************************************************************/
+#pragma once
+#include "Transform.h"
+#include "Matrix4x4.h"
+#include "ParticleForGPU.h"
+#include <cstdint>
+#include <span>
+
+///=============================================================================
+///						まとめて行列を求める関数
+namespace TransformBatch {
+	/// \brief 1スレッドに割り当てる最小の数(これより少なければスレッドを増やさない)
+	constexpr size_t kMinCountPerThread = 2048;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  WriteParticleMatrices パーティクル用の行列をまとめて書き込む
+	 * \param  transforms 各パーティクルのTransform
+	 * \param  billboardMatrix 先にかけるアフィン行列(ビルボード。使わないなら単位行列)
+	 * \param  viewProjection ビュープロジェクション行列
+	 * \param  output 書き込み先(transformsと同じ数以上。colorは書き換えない)
+	 * \param  threadCount 使うスレッド数の上限
+	 * \note   World = billboardMatrix * MakeAffineMatrix、WVP = World * viewProjection
+	 */
+	void WriteParticleMatrices(std::span<const Transform> transforms, const Matrix4x4& billboardMatrix,
+		const Matrix4x4& viewProjection, std::span<ParticleForGPU> output, uint32_t threadCount = 1);
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cmath>
+#include "Vector3.h"
+#include "Matrix4x4.h"
+
+/// <summary>
+/// 軸並行境界ボックス
+/// </summary>
+struct AABB {
+	Vector3 min;
+	Vector3 max;
+};
+
+/// <summary>
+/// 境界球
+/// </summary>
+struct BoundingSphere {
+	Vector3 center;
+	float radius;
+};
+
+// AABBの中心
+inline constexpr Vector3 GetCenter(const AABB& aabb) {
+	return { ( aabb.min.x + aabb.max.x ) * 0.5f, ( aabb.min.y + aabb.max.y ) * 0.5f, ( aabb.min.z + aabb.max.z ) * 0.5f };
+}
+
+// AABBの半分の大きさ
+inline constexpr Vector3 GetExtent(const AABB& aabb) {
+	return { ( aabb.max.x - aabb.min.x ) * 0.5f, ( aabb.max.y - aabb.min.y ) * 0.5f, ( aabb.max.z - aabb.min.z ) * 0.5f };
+}
+
+// AABBをアフィン行列で変換し、それを囲むAABBを求める
+// NOTE:8頂点を変換する代わりに、中心を変換して半分の大きさを行列の絶対値で広げる
+inline AABB TransformAABB(const AABB& aabb, const Matrix4x4& matrix) {
+	Vector3 center = GetCenter(aabb);
+	Vector3 extent = GetExtent(aabb);
+	Vector3 worldCenter = {
+		center.x * matrix.m[0][0] + center.y * matrix.m[1][0] + center.z * matrix.m[2][0] + matrix.m[3][0],
+		center.x * matrix.m[0][1] + center.y * matrix.m[1][1] + center.z * matrix.m[2][1] + matrix.m[3][1],
+		center.x * matrix.m[0][2] + center.y * matrix.m[1][2] + center.z * matrix.m[2][2] + matrix.m[3][2],
+	};
+	Vector3 worldExtent = {
+		extent.x * std::fabs(matrix.m[0][0]) + extent.y * std::fabs(matrix.m[1][0]) + extent.z * std::fabs(matrix.m[2][0]),
+		extent.x * std::fabs(matrix.m[0][1]) + extent.y * std::fabs(matrix.m[1][1]) + extent.z * std::fabs(matrix.m[2][1]),
+		extent.x * std::fabs(matrix.m[0][2]) + extent.y * std::fabs(matrix.m[1][2]) + extent.z * std::fabs(matrix.m[2][2]),
+	};
+	return { worldCenter - worldExtent, worldCenter + worldExtent };
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "Quaternion.h"
+
+/// <summary>
+/// デュアルクォータニオン(回転と平行移動をまとめて表す。スキニングのブレンド用)
+/// </summary>
+struct DualQuaternion {
+	// 回転
+	Quaternion real;
+	// 平行移動(0.5 * t * real)
+	Quaternion dual;
+};
@@ -4,12 +4,13 @@
 /// <summary>
 /// 4x4行列
 /// </summary>
-struct Matrix4x4 {
+/// NOTE:行ごとにSIMDレジスタへそのまま読み書きできるよう16バイト境界にそろえる
+struct alignas(16) Matrix4x4 {
     float m[4][4];
 
     // 行列の加算
-    Matrix4x4 operator+(const Matrix4x4& other) const {
-        Matrix4x4 result;
+    constexpr Matrix4x4 operator+(const Matrix4x4& other) const {
+        Matrix4x4 result = {};
         for (int i = 0; i < 4; ++i) {
             for (int j = 0; j < 4; ++j) {
                 result.m[i][j] = this->m[i][j] + other.m[i][j];
@@ -19,8 +20,8 @@ struct Matrix4x4 {
     }
 
     // 行列の減算
-    Matrix4x4 operator-(const Matrix4x4& other) const {
-        Matrix4x4 result;
+    constexpr Matrix4x4 operator-(const Matrix4x4& other) const {
+        Matrix4x4 result = {};
         for (int i = 0; i < 4; ++i) {
             for (int j = 0; j < 4; ++j) {
                 result.m[i][j] = this->m[i][j] - other.m[i][j];
@@ -30,7 +31,7 @@ struct Matrix4x4 {
     }
 
     // 行列の乗算
-    Matrix4x4 operator*(const Matrix4x4& other) const {
+    constexpr Matrix4x4 operator*(const Matrix4x4& other) const {
         Matrix4x4 result = {};
         for (int i = 0; i < 4; ++i) {
             for (int j = 0; j < 4; ++j) {
@@ -43,8 +44,8 @@ struct Matrix4x4 {
     }
 
     // 行列のスカラー乗算
-    Matrix4x4 operator*(float scalar) const {
-        Matrix4x4 result;
+    constexpr Matrix4x4 operator*(float scalar) const {
+        Matrix4x4 result = {};
         for (int i = 0; i < 4; ++i) {
             for (int j = 0; j < 4; ++j) {
                 result.m[i][j] = this->m[i][j] * scalar;
@@ -54,7 +55,7 @@ struct Matrix4x4 {
     }
 
     // 行列の等価比較
-    bool operator==(const Matrix4x4& other) const {
+    constexpr bool operator==(const Matrix4x4& other) const {
         for (int i = 0; i < 4; ++i) {
             for (int j = 0; j < 4; ++j) {
                 if (this->m[i][j] != other.m[i][j]) {
@@ -66,7 +67,7 @@ struct Matrix4x4 {
     }
 
     // 行列の非等価比較
-    bool operator!=(const Matrix4x4& other) const {
+    constexpr bool operator!=(const Matrix4x4& other) const {
         return !(*this == other);
     }
 };
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+/// <summary>
+/// クォータニオン(x, y, z: 虚部  w: 実部)
+/// </summary>
+/// NOTE:4成分をそのままSIMDレジスタへ読み書きできるよう16バイト境界にそろえる
+struct alignas(16) Quaternion {
+	float x;
+	float y;
+	float z;
+	float w;
+};
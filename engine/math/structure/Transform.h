@@ -1,8 +1,18 @@
 #pragma once
 #include "Vector3.h"
+#include "Quaternion.h"
 
 struct Transform {
 	Vector3 scale;
 	Vector3 rotate;
 	Vector3 translate;
-};
\ No newline at end of file
+};
+
+/// <summary>
+/// 回転をクォータニオンで持つTransform
+/// </summary>
+struct QuaternionTransform {
+	Vector3 scale;
+	Quaternion rotate;
+	Vector3 translate;
+};
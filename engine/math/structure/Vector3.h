@@ -10,38 +10,38 @@ struct Vector3 final{
 	float z;
 
 	// 加算演算子
-	Vector3 operator+(const Vector3& other) const {
+	constexpr Vector3 operator+(const Vector3& other) const {
 		return { x + other.x, y + other.y, z + other.z };
 	}
 
 	// 減算演算子
-	Vector3 operator-(const Vector3& other) const {
+	constexpr Vector3 operator-(const Vector3& other) const {
 		return { x - other.x, y - other.y, z - other.z };
 	}
 
 	// スカラー乗算演算子
-	Vector3 operator*(float scalar) const {
+	constexpr Vector3 operator*(float scalar) const {
 		return { x * scalar, y * scalar, z * scalar };
 	}
 
 	// スカラー除算演算子
-	Vector3 operator/(float scalar) const {
+	constexpr Vector3 operator/(float scalar) const {
 		return { x / scalar, y / scalar, z / scalar };
 	}
 
 	// 等価演算子
-	bool operator==(const Vector3& other) const {
+	constexpr bool operator==(const Vector3& other) const {
 		return x == other.x && y == other.y && z == other.z;
 	}
 
 	// 非等価演算子
-	bool operator!=(const Vector3& other) const {
+	constexpr bool operator!=(const Vector3& other) const {
 		return !(*this == other);
 	}
 };
 
 // 内積
-inline float Dot(const Vector3& v1, const Vector3& v2) {
+inline constexpr float Dot(const Vector3& v1, const Vector3& v2) {
 	return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
 }
 
@@ -60,11 +60,11 @@ inline Vector3 Normalize(const Vector3& v) {
 	return v;
 }
 
-inline Vector3 AddVec3(const Vector3& v1, const Vector3& v2) {
+inline constexpr Vector3 AddVec3(const Vector3& v1, const Vector3& v2) {
 	return { v1.x + v2.x, v1.y + v2.y, v1.z + v2.z };
 }
 
-inline Vector3 MultiplyVec3(float scalar, const Vector3& v) {
+inline constexpr Vector3 MultiplyVec3(float scalar, const Vector3& v) {
 	return { scalar * v.x, scalar * v.y, scalar * v.z };
 }
 
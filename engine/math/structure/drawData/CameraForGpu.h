@@ -0,0 +1,10 @@
+#pragma once
+#include "Vector3.h"
+
+/// <summary>
+/// シェーダーに渡すカメラ
+/// NOTE:フレームに1回だけ書き込み、そのフレームのObject3dすべてで共有する
+/// </summary>
+struct CameraForGpu {
+	Vector3 worldPosition;
+};
@@ -2,6 +2,7 @@
 #include <vector>
 #include "MaterialData.h"
 #include "VertexData.h"
+#include "BoundingVolume.h"
 
 /// <summary>
 /// ModelData
@@ -9,4 +10,6 @@
 struct ModelData {
 	std::vector<VertexData> vertices;
 	MaterialData material;
+	AABB bounds = {};					// ローカル空間のAABB
+	BoundingSphere boundingSphere = {};	// ローカル空間の境界球
 };
\ No newline at end of file
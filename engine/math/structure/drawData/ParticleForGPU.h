@@ -0,0 +1,12 @@
+#pragma once
+#include "Matrix4x4.h"
+#include "Vector4.h"
+
+/// <summary>
+/// パーティクル1つ分のインスタンシングデータ
+/// </summary>
+struct ParticleForGPU {
+	Matrix4x4 WVP;
+	Matrix4x4 World;
+	Vector4 color;
+};
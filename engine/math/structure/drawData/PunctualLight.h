@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include "Vector3.h"
+#include "Vector4.h"
+
+/// <summary>
+/// 点光源・スポットライトの種類
+/// </summary>
+enum class PunctualLightType : uint32_t {
+	kPoint,
+	kSpot,
+};
+
+/// <summary>
+/// 点光源・スポットライト
+/// NOTE:構造化バッファにそのまま並べるので、シェーダー側と同じ並び(64バイト)にしておくこと
+/// </summary>
+struct PunctualLight {
+	Vector4 color;			//ライトの色
+	Vector3 position;		//ライトの位置
+	float intensity;		//光度
+	Vector3 direction;		//スポットライトの向き(正規化しておくこと)
+	float radius;			//光が届く距離
+	float decay;			//減衰率
+	float cosAngle;			//スポットライトの外側の角度のcos
+	float cosFalloffStart;	//スポットライトの減衰が始まる角度のcos
+	PunctualLightType type;	//種類
+};
+static_assert(sizeof(PunctualLight) == 64);
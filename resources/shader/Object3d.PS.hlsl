@@ -26,6 +26,39 @@ struct Camera
 };
 ConstantBuffer<Camera> gCamera : register(b2);
 
+//点光源・スポットライト
+struct PunctualLight
+{
+    float4 color;
+    float3 position;
+    float intensity;
+    float3 direction;
+    float radius;
+    float decay;
+    float cosAngle;
+    float cosFalloffStart;
+    uint type; //0:点光源 1:スポットライト
+};
+StructuredBuffer<PunctualLight> gPunctualLights : register(t1);
+
+//クラスタ(画面のタイル×奥行きの区切り)
+struct LightCluster
+{
+    float4 viewZ;
+    uint countX;
+    uint countY;
+    uint countZ;
+    uint lightCount;
+    float tileScaleX;
+    float tileScaleY;
+    float sliceScale;
+    float sliceBias;
+};
+ConstantBuffer<LightCluster> gLightCluster : register(b3);
+//クラスタごとのライトの範囲(x:先頭 y:数)とライトの番号
+StructuredBuffer<uint2> gClusterRanges : register(t2);
+StructuredBuffer<uint> gClusterLightIndices : register(t3);
+
 Texture2D<float4> gTexture : register(t0); //SRVのRegister
 
 SamplerState gSampler : register(s0); //SamplerのRegister
@@ -71,6 +104,35 @@ PixelShaderOutput main(VertexShaderOutput input)
         gDirectionalLight.color.rgb * gDirectionalLight.intensity * specularPow * float3(1.0f, 1.0f, 1.0f);
         //拡散反射と鏡面反射
         output.color.rgb = diffuse + specular;
+
+        //========================================
+        //点光源・スポットライト(このピクセルのクラスタに割り当てたものだけ)
+        uint2 tile = min(uint2(input.position.xy * float2(gLightCluster.tileScaleX, gLightCluster.tileScaleY)),
+            uint2(gLightCluster.countX - 1, gLightCluster.countY - 1));
+        float viewDepth = dot(float4(input.worldPosition, 1.0f), gLightCluster.viewZ);
+        float slice = log(max(viewDepth, 1e-4f)) * gLightCluster.sliceScale + gLightCluster.sliceBias;
+        uint sliceIndex = (uint) clamp(slice, 0.0f, (float) (gLightCluster.countZ - 1));
+        uint2 range = gClusterRanges[tile.x + gLightCluster.countX * (tile.y + gLightCluster.countY * sliceIndex)];
+        float3 normal = normalize(input.normal);
+        for (uint i = 0; i < range.y; ++i)
+        {
+            PunctualLight light = gPunctualLights[gClusterLightIndices[range.x + i]];
+            float3 toLight = light.position - input.worldPosition;
+            float distance = length(toLight);
+            float3 lightDirection = toLight / max(distance, 1e-4f);
+            //距離による減衰
+            float factor = pow(saturate(1.0f - distance / light.radius), light.decay);
+            //スポットライトの角度による減衰
+            if (light.type == 1)
+            {
+                float cosTheta = dot(-lightDirection, light.direction);
+                factor *= saturate((cosTheta - light.cosAngle) / max(light.cosFalloffStart - light.cosAngle, 1e-4f));
+            }
+            float3 lightColor = light.color.rgb * light.intensity * factor;
+            float lightCos = pow(dot(normal, lightDirection) * 0.5f + 0.5f, 2.0f);
+            float lightSpecular = pow(saturate(dot(normal, normalize(lightDirection + toEye))), gMaterial.shininess);
+            output.color.rgb += gMaterial.color.rgb * textureColor.rgb * lightColor * lightCos + lightColor * lightSpecular;
+        }
         //アルファはテクスチャのアルファ値を使用
         output.color.a = gMaterial.color.a * textureColor.a;
     }
@@ -0,0 +1,28 @@
+#include "Object3d.hlsli"
+
+struct TransformationMatrix{
+    float4x4 WVP;
+    float4x4 World;
+    float4x4 WorldInverseTranspose;
+};
+
+//NOTE:インスタンスごとの行列。t0はピクセルシェーダーのテクスチャが使っているのでt1
+StructuredBuffer<TransformationMatrix> gTransformationMatrices : register(t1);
+
+struct VertexShaderInput{
+    float4 position : POSITION0;
+    float2 texcoord : TEXCOORD0;
+    float3 normal : NORMAL0;
+};
+
+VertexShaderOutput main(VertexShaderInput input, uint instanceId : SV_InstanceID){
+    TransformationMatrix transformationMatrix = gTransformationMatrices[instanceId];
+    VertexShaderOutput output;
+    output.texcoord = input.texcoord;
+    output.position = mul(input.position, transformationMatrix.WVP);
+    //NOTE:法線の変換には拡縮回転情報のみが必要なため取り出す処理を行っている
+    output.normal = normalize(mul(input.normal, (float3x3) transformationMatrix.WorldInverseTranspose));
+    output.worldPosition = (float3) mul(input.position, transformationMatrix.World).xyz;
+    
+    return output;
+}
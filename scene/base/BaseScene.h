@@ -10,6 +10,7 @@
 #include "SpriteSetup.h"
 #include "Object3dSetup.h"
 #include "ParticleSetup.h"
+#include "GameTime.h"
 // シーンの種類
 enum SCENE { DEBUG, TITLE, GAMEPLAY, CLEAR };
 
@@ -27,8 +28,12 @@ public:
 	/// \brief 終了処理
 	virtual void Finalize() = 0;
 
-	/// \brief 更新
-	virtual void Update() = 0;
+	/**----------------------------------------------------------------------------
+	* \brief  Update 更新
+	* \param  gameTime ゲームの時間
+	* NOTE: 移動や当たり判定は gameTime.GetFixedStepCount() 回の固定ステップで進めると描画のフレームレートに依存しない
+	*/
+	virtual void Update(const GameTime &gameTime) = 0;
 
 	/// \brief 2D描画
 	virtual void Object2DDraw() = 0;
@@ -42,6 +47,13 @@ public:
 	/// \brief ImGui描画
 	virtual void ImGuiDraw() = 0;
 
+	/**----------------------------------------------------------------------------
+	* \brief  GetParticleBlendModes シーンで使うパーティクルのブレンドモード
+	* \return ブレンドモードの一覧
+	* NOTE: ここで宣言したブレンドモードのPSOは初期化前に生成される。既定のブレンドなしは常に生成済み
+	*/
+	virtual std::vector<BlendMode> GetParticleBlendModes() const { return {}; }
+
 	/**----------------------------------------------------------------------------
 	* \brief  ~IScene 抽象クラスのデストラクタ
 	* NOTE: 仮想デストラクタを用意することで、継承先のクラスのデストラクタが呼ばれるようにする。
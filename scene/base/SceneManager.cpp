@@ -19,6 +19,7 @@ void SceneManager::Initialize(SpriteSetup *spriteSetup, Object3dSetup *object3dS
 	particleSetup_ = particleSetup;
 	// 初期シーンを設定（例としてDebugSceneを設定）
 	nowScene_ = std::make_unique<DebugScene>();
+	particleSetup_->PrecompileBlendModes(nowScene_->GetParticleBlendModes());
 	nowScene_->Initialize(spriteSetup_, object3dSetup_, particleSetup_);
 
 	// シーンの初期設定
@@ -36,7 +37,7 @@ void SceneManager::Finalize() {
 
 ///=============================================================================
 ///						更新
-void SceneManager::Update() {
+void SceneManager::Update(const GameTime &gameTime) {
 	//========================================
 	// シーンの切り替え
 	prevSceneNo_ = currentSceneNo_;
@@ -45,12 +46,16 @@ void SceneManager::Update() {
 	//========================================
 	// シーンが切り替わった場合
 	if(prevSceneNo_ != currentSceneNo_) {
+		// 前のフレームがまだGPUで実行中のため、旧シーンのリソースを破棄する前に待つ
+		spriteSetup_->GetDXManager()->WaitForGpu();
 		if(nowScene_) {
 			// 現在のシーンの終了処理
 			nowScene_->Finalize();
 		}
 		// シーンの生成
 		nowScene_ = sceneFactory_->CreateScene(currentSceneNo_);
+		// シーンで使うPSOを先に生成
+		particleSetup_->PrecompileBlendModes(nowScene_->GetParticleBlendModes());
 		// シーンの初期化
 		nowScene_->Initialize(spriteSetup_, object3dSetup_, particleSetup_);
 	}
@@ -58,7 +63,7 @@ void SceneManager::Update() {
 	//========================================
 	// シーンの更新
 	if(nowScene_) {
-		nowScene_->Update();
+		nowScene_->Update(gameTime);
 	}
 }
 
@@ -25,7 +25,7 @@ public:
 	void Finalize();
 
 	/// @brief 更新処理
-	void Update();
+	void Update(const GameTime &gameTime);
 
 	/// @brief 描画
 	void Object2DDraw();
@@ -7,6 +7,7 @@
  * \note   
  *********************************************************************/
 #include "DebugScene.h"
+#include "FastMath.h"
 
 ///=============================================================================
 ///						初期化
@@ -33,6 +34,7 @@ void DebugScene::Initialize(SpriteSetup *spriteSetup, Object3dSetup *object3dSet
 	ModelManager::GetInstance()->LoadMedel("ball.obj");
 	//========================================
 	// 3Dオブジェクトクラス
+	object3dSetup_ = object3dSetup;
 	object3d_ = std::make_unique<Object3d>();
 	//3Dオブジェクトの初期化
 	object3d_->Initialize(object3dSetup);
@@ -60,12 +62,14 @@ void DebugScene::Finalize() {
 
 ///=============================================================================
 ///						更新
-void DebugScene::Update() {
+void DebugScene::Update(const GameTime &gameTime) {
+	//引数を使用しない場合は警告を出さないようにする
+	gameTime;
 	///--------------------------------------------------------------
 	///						更新処理
 	//========================================
 	// カメラの更新
-	//CameraManager::GetInstance()->UpdateAll();
+	//CameraManager::GetInstance()->Update();
 
 	//========================================
 	// 2D更新
@@ -81,6 +85,8 @@ void DebugScene::Update() {
 	object3d_->SetPosition(Vector3{ transform.translate.x,transform.translate.y,transform.translate.z });
 	//更新
 	object3d_->Update();
+	//点光源・スポットライトのセット
+	object3dSetup_->SetPunctualLights(punctualLights_);
 
 	//========================================
 	// パーティクル系
@@ -146,6 +152,28 @@ void DebugScene::ImGuiDraw() {
 	//光沢度の設定
 	ImGui::SliderFloat("Shininess", &lightIntensity, 1.0f, 100.0f);
 	object3d_->SetShininess(lightIntensity);
+	//セパレート
+	ImGui::Separator();
+	//点光源・スポットライトの設定
+	ImGui::Text("PunctualLightSetting");
+	for(int i = 0; i < 2; ++i) {
+		PunctualLight &light = punctualLights_[i];
+		ImGui::PushID(i);
+		ImGui::TextUnformatted(light.type == PunctualLightType::kPoint ? "PointLight" : "SpotLight");
+		ImGui::ColorEdit4("Color", &light.color.x);
+		ImGui::SliderFloat3("Position", &light.position.x, -10.0f, 10.0f);
+		ImGui::SliderFloat("Intensity", &light.intensity, 0.0f, 20.0f);
+		ImGui::SliderFloat("Radius", &light.radius, 0.1f, 30.0f);
+		ImGui::SliderFloat("Decay", &light.decay, 0.1f, 4.0f);
+		if(light.type == PunctualLightType::kSpot) {
+			if(ImGui::SliderFloat3("Direction", &light.direction.x, -1.0f, 1.0f)) {
+				light.direction = FastMath::Normalize(light.direction);
+			}
+			ImGui::SliderFloat("CosAngle", &light.cosAngle, 0.0f, 1.0f);
+			ImGui::SliderFloat("CosFalloffStart", &light.cosFalloffStart, light.cosAngle, 1.0f);
+		}
+		ImGui::PopID();
+	}
 	ImGui::End();
 
 }
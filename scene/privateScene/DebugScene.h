@@ -16,6 +16,7 @@
 #include "ParticleEmitter.h"
 #include "Object3d.h"
 #include "Model.h"
+#include "PunctualLight.h"
 #include "MAudioG.h"
 
 class DebugScene : public BaseScene {
@@ -29,7 +30,7 @@ public:
 	void Finalize() override;
 
 	/// \brief 更新
-	void Update() override;
+	void Update(const GameTime &gameTime) override;
 
 	/// @brie 2D描画
 	void Object2DDraw() override;
@@ -64,6 +65,8 @@ private:
 	//========================================
 	// 3dオブジェクト
 	std::unique_ptr<Object3d> object3d_;
+	// 点光源・スポットライトの設定先
+	Object3dSetup *object3dSetup_ = nullptr;
 	//========================================
 	// パーティクル
 
@@ -76,5 +79,10 @@ private:
 	Vector4 lightColor = { 1.0f,1.0f,1.0f,1.0f };
 	Vector3 lightDirection = { 0.0f,0.0f,0.0f };
 	float lightIntensity = 16.0f;
+	// 点光源とスポットライト(0:点光源 1:スポットライト)
+	PunctualLight punctualLights_[2] = {
+		{ { 1.0f,0.4f,0.2f,1.0f }, { 2.0f,1.0f,-2.0f }, 4.0f, { 0.0f,-1.0f,0.0f }, 8.0f, 2.0f, 0.0f, 0.0f, PunctualLightType::kPoint },
+		{ { 0.2f,0.4f,1.0f,1.0f }, { -2.0f,3.0f,0.0f }, 4.0f, { 0.0f,-1.0f,0.0f }, 10.0f, 2.0f, 0.8f, 0.9f, PunctualLightType::kSpot },
+	};
 };
 
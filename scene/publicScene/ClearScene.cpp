@@ -26,7 +26,9 @@ void ClearScene::Finalize() {
 
 ///=============================================================================
 ///						更新
-void ClearScene::Update() {
+void ClearScene::Update(const GameTime &gameTime) {
+	//引数を使用しない場合は警告を出さないようにする
+	gameTime;
 	//========================================
 	// シーン遷移
 	if(Input::GetInstance()->PushKey(DIK_SPACE)) {
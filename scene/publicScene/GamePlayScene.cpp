@@ -102,7 +102,7 @@ void GamePlayScene::Finalize() {
 
 ///=============================================================================
 ///						更新
-void GamePlayScene::Update() {
+void GamePlayScene::Update(const GameTime &gameTime) {
 	//========================================
 	// BGMの再生
 	if(MAudioG::GetInstance()->IsWavPlaying("Beast-Mode.wav") == false) {
@@ -120,22 +120,31 @@ void GamePlayScene::Update() {
 	ground_->Update();
 
 	//========================================
-	// プレイヤー
-	player_->Update();
+	// プレイヤーの入力
+	player_->HandleInput();
 
 	//========================================
-	// 敵
-	enemy_->Update(player_->GetPosition());
+	// 移動と当たり判定は固定ステップで進める
+	// NOTE:描画のフレームレートが変わっても1ステップあたりの移動量はそのまま
+	for(uint32_t step = 0; step < gameTime.GetFixedStepCount(); ++step) {
+		//========================================
+		// プレイヤー
+		player_->Update();
 
-	//========================================
-	// 当たり判定
-	//リセット
-	collisionManager_->Reset();
-	//追加
-	collisionManager_->AddCollider(enemy_.get());
-	collisionManager_->AddCollider(player_.get());
-	//更新
-	collisionManager_->Update();
+		//========================================
+		// 敵
+		enemy_->Update(player_->GetPosition());
+
+		//========================================
+		// 当たり判定
+		//リセット
+		collisionManager_->Reset();
+		//追加
+		collisionManager_->AddCollider(enemy_.get());
+		collisionManager_->AddCollider(player_.get());
+		//更新
+		collisionManager_->Update();
+	}
 
 	if(enemy_->GetIsAlive() == false) {
 		//敵が死んだら
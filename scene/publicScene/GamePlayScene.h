@@ -36,7 +36,7 @@ public:
 	void Finalize() override;
 
 	/// \brief 更新
-	void Update() override;
+	void Update(const GameTime &gameTime) override;
 
 	/// @brie 2D描画
 	void Object2DDraw() override;
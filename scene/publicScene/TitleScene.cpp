@@ -34,7 +34,9 @@ void TitleScene::Finalize() {
 
 ///=============================================================================
 ///						更新
-void TitleScene::Update() {
+void TitleScene::Update(const GameTime &gameTime) {
+	//引数を使用しない場合は警告を出さないようにする
+	gameTime;
 	//========================================
 	// シーン遷移
 	if(Input::GetInstance()->TriggerKey(DIK_SPACE)) {
@@ -0,0 +1,206 @@
+/*********************************************************************
+ * \file   DescriptorAllocatorTest.cpp
+ * \brief  DescriptorAllocatorのテスト(D3D12を使わずインデックスだけを確かめる)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "DescriptorAllocator.h"
+
+///=============================================================================
+///						先頭から最初に収まる空きを使う
+TEST_CASE(DescriptorAllocator_AllocateRangeIsFirstFit) {
+	DescriptorAllocator allocator;
+	allocator.Initialize(16);
+	CHECK(allocator.AllocateRange(4) == 0);
+	CHECK(allocator.AllocateRange(4) == 4);
+	CHECK(allocator.AllocateRange(4) == 8);
+	allocator.Free(0, 4);
+
+	//========================================
+	// 空き {0:4} {12:4}
+	CHECK(allocator.AllocateRange(3) == 0);
+	// 残り {3:1} には入らないので次の空きから
+	CHECK(allocator.AllocateRange(2) == 12);
+	CHECK(allocator.AllocateRange(5) == DescriptorAllocator::kInvalidIndex);
+
+	DescriptorAllocator::Stats stats = allocator.GetStats();
+	CHECK(stats.capacity == 16);
+	CHECK(stats.allocatedCount == 13);
+	CHECK(stats.peakAllocatedCount == 13);
+	CHECK(stats.freeBlockCount == 2);
+	CHECK(stats.largestFreeBlock == 2);
+	CHECK(stats.allocationCount == 5);
+	CHECK(stats.freeCount == 1);
+	CHECK(stats.failedAllocationCount == 1);
+
+	//========================================
+	// 1つずつの確保も先頭の隙間から埋める
+	CHECK(allocator.Allocate() == 3);
+	CHECK(!allocator.IsFull());
+	CHECK(allocator.AllocateRange(2) == 14);
+	CHECK(allocator.IsFull());
+	CHECK(allocator.Allocate() == DescriptorAllocator::kInvalidIndex);
+	stats = allocator.GetStats();
+	CHECK(stats.allocatedCount == 16);
+	CHECK(stats.freeBlockCount == 0);
+	CHECK(stats.largestFreeBlock == 0);
+	CHECK(stats.failedAllocationCount == 2);
+}
+
+///=============================================================================
+///						解放した範囲は前後の空きとつながる
+TEST_CASE(DescriptorAllocator_FreeMergesNeighbours) {
+	DescriptorAllocator allocator;
+	allocator.Initialize(12);
+	for(uint32_t i = 0; i < 6; ++i) {
+		CHECK(allocator.AllocateRange(2) == i * 2);
+	}
+	CHECK(allocator.IsFull());
+
+	allocator.Free(2, 2);
+	allocator.Free(6, 2);
+	DescriptorAllocator::Stats stats = allocator.GetStats();
+	CHECK(stats.freeBlockCount == 2);
+	CHECK(stats.largestFreeBlock == 2);
+
+	//========================================
+	// 前後両方とつながる
+	allocator.Free(4, 2);
+	stats = allocator.GetStats();
+	CHECK(stats.freeBlockCount == 1);
+	CHECK(stats.largestFreeBlock == 6);
+
+	// 後ろとだけつながる(先頭)
+	allocator.Free(0, 2);
+	stats = allocator.GetStats();
+	CHECK(stats.freeBlockCount == 1);
+	CHECK(stats.largestFreeBlock == 8);
+
+	// 離れた空き、その後で間を埋める
+	allocator.Free(10, 2);
+	CHECK(allocator.GetStats().freeBlockCount == 2);
+	allocator.Free(8, 2);
+	stats = allocator.GetStats();
+	CHECK(stats.freeBlockCount == 1);
+	CHECK(stats.largestFreeBlock == 12);
+	CHECK(stats.allocatedCount == 0);
+	CHECK(stats.peakAllocatedCount == 12);
+	CHECK(stats.freeCount == 6);
+
+	// つながった空きから全体を確保し直せる
+	CHECK(allocator.AllocateRange(12) == 0);
+}
+
+///=============================================================================
+///						二重解放はassertで止まる(後ろの空きと重なる)
+DEATH_TEST(DescriptorAllocator_DoubleFreeAsserts) {
+	DescriptorAllocator allocator;
+	allocator.Initialize(8);
+	allocator.AllocateRange(8);
+	allocator.Free(2, 2);
+	allocator.Free(2, 2);
+}
+
+///=============================================================================
+///						二重解放はassertで止まる(前の空きと重なる)
+DEATH_TEST(DescriptorAllocator_OverlappingFreeAsserts) {
+	DescriptorAllocator allocator;
+	allocator.Initialize(8);
+	allocator.AllocateRange(8);
+	allocator.Free(0, 2);
+	allocator.Free(1, 1);
+}
+
+///=============================================================================
+///						一時確保は末尾から切り出し、フェンスの完了で戻る
+TEST_CASE(DescriptorAllocator_TransientAndDeferredFree) {
+	DescriptorAllocator allocator;
+	allocator.Initialize(16);
+	CHECK(allocator.AllocateRange(4) == 0);
+
+	//========================================
+	// 末尾から切り出す
+	CHECK(allocator.AllocateTransient(3, 5) == 13);
+	CHECK(allocator.AllocateTransient(2, 6) == 11);
+	// 常駐確保は先頭側のまま
+	CHECK(allocator.AllocateRange(2) == 4);
+	CHECK(allocator.AllocateTransient(6, 7) == DescriptorAllocator::kInvalidIndex);
+	DescriptorAllocator::Stats stats = allocator.GetStats();
+	CHECK(stats.allocatedCount == 11);
+	CHECK(stats.peakAllocatedCount == 11);
+	CHECK(stats.transientCount == 5);
+	// 一時確保は解放待ちに数えない
+	CHECK(stats.pendingFreeCount == 0);
+	CHECK(stats.freeBlockCount == 1);
+	CHECK(stats.largestFreeBlock == 5);
+	CHECK(stats.allocationCount == 4);
+	CHECK(stats.failedAllocationCount == 1);
+
+	//========================================
+	// 遅延解放はフェンスが完了するまで使用中のまま
+	allocator.FreeDeferred(0, 4, 5);
+	allocator.FreeDeferred(4, 2, 7);
+	stats = allocator.GetStats();
+	CHECK(stats.allocatedCount == 11);
+	CHECK(stats.pendingFreeCount == 6);
+	allocator.ReleaseCompleted(4);
+	stats = allocator.GetStats();
+	CHECK(stats.allocatedCount == 11);
+	CHECK(stats.freeCount == 0);
+
+	//========================================
+	// フェンス5: [0, 4)と一時確保[13, 16)
+	allocator.ReleaseCompleted(5);
+	stats = allocator.GetStats();
+	CHECK(stats.allocatedCount == 4);
+	CHECK(stats.transientCount == 2);
+	CHECK(stats.pendingFreeCount == 2);
+	CHECK(stats.freeBlockCount == 3);
+	CHECK(stats.freeCount == 2);
+
+	// フェンス6: 一時確保[11, 13)。前後の空きとつながる
+	allocator.ReleaseCompleted(6);
+	stats = allocator.GetStats();
+	CHECK(stats.allocatedCount == 2);
+	CHECK(stats.transientCount == 0);
+	CHECK(stats.freeBlockCount == 2);
+	CHECK(stats.largestFreeBlock == 10);
+
+	// フェンス7: [4, 6)。全体が1つの空きに戻る
+	allocator.ReleaseCompleted(7);
+	stats = allocator.GetStats();
+	CHECK(stats.allocatedCount == 0);
+	CHECK(stats.pendingFreeCount == 0);
+	CHECK(stats.freeBlockCount == 1);
+	CHECK(stats.largestFreeBlock == 16);
+	CHECK(stats.freeCount == 4);
+	CHECK(stats.peakAllocatedCount == 11);
+
+	// 回収済みの範囲は2回目で戻らない
+	allocator.ReleaseCompleted(100);
+	CHECK(allocator.GetStats().freeCount == 4);
+}
+
+///=============================================================================
+///						初期化で状態が消える
+TEST_CASE(DescriptorAllocator_InitializeResets) {
+	DescriptorAllocator allocator;
+	allocator.Initialize(4);
+	allocator.AllocateRange(4);
+	allocator.AllocateTransient(1, 1);
+	allocator.FreeDeferred(0, 2, 3);
+	allocator.Initialize(8);
+	DescriptorAllocator::Stats stats = allocator.GetStats();
+	CHECK(stats.capacity == 8);
+	CHECK(stats.allocatedCount == 0);
+	CHECK(stats.peakAllocatedCount == 0);
+	CHECK(stats.pendingFreeCount == 0);
+	CHECK(stats.failedAllocationCount == 0);
+	CHECK(stats.largestFreeBlock == 8);
+	// 前の解放待ちは捨てられている
+	allocator.ReleaseCompleted(10);
+	CHECK(allocator.GetStats().freeCount == 0);
+}
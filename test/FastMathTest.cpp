@@ -0,0 +1,126 @@
+/*********************************************************************
+ * \file   FastMathTest.cpp
+ * \brief  近似のsin・cos・逆平方根のテスト(誤差の上限の確認)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "FastMath.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+	constexpr uint32_t kValueCount = 4099;
+
+	/// \brief 範囲内のばらばらな角度(4の倍数でない数にして端数も通す)
+	std::vector<float> MakeAngles(float maxAngle) {
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> angle(-maxAngle, maxAngle);
+		std::vector<float> angles(kValueCount);
+		for(float& value : angles) {
+			value = angle(random);
+		}
+		return angles;
+	}
+
+	/// \brief sin・cosの倍精度の値との差の最大
+	double GetSinCosMaxError(const std::vector<float>& angles, const std::vector<float>& sinResults, const std::vector<float>& cosResults) {
+		double maxError = 0.0;
+		for(size_t i = 0; i < angles.size(); ++i) {
+			maxError = ( std::max )( maxError, std::fabs(sinResults[i] - std::sin(static_cast<double>( angles[i] ))) );
+			maxError = ( std::max )( maxError, std::fabs(cosResults[i] - std::cos(static_cast<double>( angles[i] ))) );
+		}
+		return maxError;
+	}
+}
+
+///=============================================================================
+///						SinCosの誤差
+TEST_CASE(FastMath_SinCosWithinMaxError) {
+	for(float maxAngle : { 100.0f, FastMath::kSinCosMaxInput }) {
+		std::vector<float> angles = MakeAngles(maxAngle);
+		std::vector<float> sinResults(kValueCount);
+		std::vector<float> cosResults(kValueCount);
+
+		//========================================
+		// 1つずつ
+		for(uint32_t i = 0; i < kValueCount; ++i) {
+			FastMath::SinCos(angles[i], sinResults[i], cosResults[i]);
+		}
+		CHECK(GetSinCosMaxError(angles, sinResults, cosResults) <= FastMath::kSinCosMaxError);
+
+		//========================================
+		// まとめて(SIMD版)
+		std::fill(sinResults.begin(), sinResults.end(), 2.0f);
+		std::fill(cosResults.begin(), cosResults.end(), 2.0f);
+		FastMath::SinCos(angles, sinResults, cosResults);
+		CHECK(GetSinCosMaxError(angles, sinResults, cosResults) <= FastMath::kSinCosMaxError);
+	}
+
+	// 象限の境目と0
+	const float kPiOver2 = 1.57079632679f;
+	for(int quadrant = -8; quadrant <= 8; ++quadrant) {
+		float x = kPiOver2 * static_cast<float>( quadrant );
+		float s, c;
+		FastMath::SinCos(x, s, c);
+		CHECK(std::fabs(s - std::sin(static_cast<double>( x ))) <= FastMath::kSinCosMaxError);
+		CHECK(std::fabs(c - std::cos(static_cast<double>( x ))) <= FastMath::kSinCosMaxError);
+	}
+	CHECK(FastMath::Sin(0.0f) == 0.0f);
+	CHECK(FastMath::Cos(0.0f) == 1.0f);
+}
+
+///=============================================================================
+///						InverseSqrtの相対誤差
+TEST_CASE(FastMath_InverseSqrtWithinMaxRelativeError) {
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> exponent(-20.0f, 20.0f);
+	std::vector<float> values(kValueCount);
+	for(float& value : values) {
+		value = std::exp(exponent(random));
+	}
+	std::vector<float> results(kValueCount);
+	FastMath::InverseSqrt(values, results);
+
+	double maxError = 0.0;
+	double maxScalarError = 0.0;
+	for(uint32_t i = 0; i < kValueCount; ++i) {
+		double expected = 1.0 / std::sqrt(static_cast<double>( values[i] ));
+		maxError = ( std::max )( maxError, std::fabs(results[i] - expected) / expected );
+		maxScalarError = ( std::max )( maxScalarError, std::fabs(FastMath::InverseSqrt(values[i]) - expected) / expected );
+	}
+	CHECK(maxError <= FastMath::kInverseSqrtMaxRelativeError);
+	CHECK(maxScalarError <= FastMath::kInverseSqrtMaxRelativeError);
+	CHECK(FastMath::Sqrt(0.0f) == 0.0f);
+	CHECK(FastMath::Sqrt(-1.0f) == 0.0f);
+}
+
+///=============================================================================
+///						Normalize
+TEST_CASE(FastMath_NormalizeKeepsZeroVectors) {
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> element(-50.0f, 50.0f);
+	std::vector<Vector3> vectors(kValueCount);
+	for(Vector3& v : vectors) {
+		v = { element(random), element(random), element(random) };
+	}
+	vectors[1] = { 0.0f, 0.0f, 0.0f };
+	vectors[kValueCount - 1] = { 0.0f, 0.0f, 0.0f };
+	std::vector<Vector3> normalized = vectors;
+	FastMath::Normalize(normalized);
+
+	for(uint32_t i = 0; i < kValueCount; ++i) {
+		if(Dot(vectors[i], vectors[i]) == 0.0f) {
+			CHECK(Dot(normalized[i], normalized[i]) == 0.0f);
+			continue;
+		}
+		// 長さは1、向きは元のまま
+		double length = std::sqrt(static_cast<double>( Dot(normalized[i], normalized[i]) ));
+		CHECK(std::fabs(length - 1.0) <= 2.0 * FastMath::kInverseSqrtMaxRelativeError + 1.0e-6);
+		CHECK(Dot(normalized[i], vectors[i]) > 0.0f);
+	}
+}
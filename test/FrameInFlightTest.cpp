@@ -0,0 +1,163 @@
+/*********************************************************************
+ * \file   FrameInFlightTest.cpp
+ * \brief  FrameInFlightのテスト(GPUのタイムラインを模擬する)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "FrameInFlight.h"
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+namespace {
+	/**----------------------------------------------------------------------------
+	 * \brief  FakeGpu シグナルされたフェンス値を順番に完了させるだけのGPU
+	 */
+	struct FakeGpu {
+		std::deque<uint64_t> queue;		// シグナル待ちのフェンス値
+		uint64_t completedValue = 0;	// GetCompletedValue相当
+
+		/// \brief キューにシグナルを積む
+		void Signal(uint64_t value) { queue.push_back(value); }
+
+		/// \brief 1つ完了させる
+		bool Step() {
+			if(queue.empty()) {
+				return false;
+			}
+			completedValue = queue.front();
+			queue.pop_front();
+			return true;
+		}
+
+		/// \brief 値に届くまで完了させる(WaitForFenceValue相当)
+		void WaitFor(uint64_t value) {
+			while(completedValue < value && Step()) {
+			}
+		}
+	};
+}
+
+///=============================================================================
+///						スロットの巡回と待つフェンス値
+TEST_CASE(FrameInFlight_RotatesSlotsAndWaitsForOldestFrame) {
+	for(uint32_t frameCount = 1; frameCount <= FrameInFlight::kMaxFrameCount; ++frameCount) {
+		FrameInFlight frameInFlight;
+		frameInFlight.Initialize(frameCount);
+		CHECK(frameInFlight.GetFrameCount() == frameCount);
+		CHECK(frameInFlight.GetFrameIndex() == 0);
+		CHECK(frameInFlight.GetLastFenceValue() == 0);
+
+		std::vector<uint64_t> submittedValues;
+		for(uint32_t frame = 0; frame < 10; ++frame) {
+			CHECK(frameInFlight.GetFrameIndex() == frame % frameCount);
+			uint64_t fenceValue = frameInFlight.Submit();
+			CHECK(fenceValue == frame + 1);
+			CHECK(frameInFlight.GetFrameFenceValue(frame % frameCount) == fenceValue);
+			submittedValues.push_back(fenceValue);
+
+			//========================================
+			// 次に使うスロットはframeCountフレーム前に提出したもの
+			uint64_t waitValue = frameInFlight.Advance();
+			size_t nextFrame = frame + 1;
+			uint64_t expected = nextFrame >= frameCount ? submittedValues[nextFrame - frameCount] : 0;
+			CHECK(waitValue == expected);
+			CHECK(frameInFlight.GetFrameIndex() == nextFrame % frameCount);
+		}
+	}
+}
+
+///=============================================================================
+///						GPUが遅くても同時に進むのはframeCountフレームまで
+TEST_CASE(FrameInFlight_LimitsFramesAheadOfGpu) {
+	for(uint32_t frameCount = 1; frameCount <= FrameInFlight::kMaxFrameCount; ++frameCount) {
+		FrameInFlight frameInFlight;
+		frameInFlight.Initialize(frameCount);
+		FakeGpu gpu;
+		uint32_t maxInFlight = 0;
+		for(uint32_t frame = 0; frame < 20; ++frame) {
+			gpu.Signal(frameInFlight.Submit());
+			// GPUはCPUより遅く、数フレームに1回しか進まない
+			if(frame % 3 == 0) {
+				gpu.Step();
+			}
+			uint64_t inFlight = frameInFlight.GetLastFenceValue() - gpu.completedValue;
+			maxInFlight = ( std::max )( maxInFlight, static_cast<uint32_t>( inFlight ) );
+			CHECK(inFlight <= frameCount);
+
+			//========================================
+			// 次のスロットを使う前に待つ
+			uint64_t waitValue = frameInFlight.Advance();
+			CHECK(frameInFlight.IsFrameReusable(gpu.completedValue) == ( gpu.completedValue >= waitValue ));
+			gpu.WaitFor(waitValue);
+			CHECK(frameInFlight.IsFrameReusable(gpu.completedValue));
+			CHECK(frameInFlight.GetLastFenceValue() - gpu.completedValue < frameCount);
+		}
+		// GPUが遅いので上限まで先行している
+		CHECK(maxInFlight == frameCount);
+	}
+}
+
+///=============================================================================
+///						フレーム以外の待機を挟んでもフェンス値は増え続ける
+TEST_CASE(FrameInFlight_ExtraIssueStaysMonotonic) {
+	FrameInFlight frameInFlight;
+	frameInFlight.Initialize(2);
+	FakeGpu gpu;
+	uint64_t previousValue = 0;
+	auto checkIncreasing = [&](uint64_t value) {
+		CHECK(value > previousValue);
+		previousValue = value;
+	};
+	for(uint32_t frame = 0; frame < 8; ++frame) {
+		uint64_t frameValue = frameInFlight.Submit();
+		checkIncreasing(frameValue);
+		gpu.Signal(frameValue);
+		//========================================
+		// WaitForGpuと同じく、別の値を発行して全部終わるまで待つ
+		if(frame % 3 == 1) {
+			uint64_t flushValue = frameInFlight.IssueFenceValue();
+			checkIncreasing(flushValue);
+			gpu.Signal(flushValue);
+			gpu.WaitFor(flushValue);
+			CHECK(gpu.completedValue == flushValue);
+			CHECK(frameInFlight.GetLastFenceValue() == flushValue);
+			// 全スロットが再利用できる
+			for(uint32_t slot = 0; slot < frameInFlight.GetFrameCount(); ++slot) {
+				CHECK(frameInFlight.GetFrameFenceValue(slot) <= gpu.completedValue);
+			}
+		}
+		uint64_t waitValue = frameInFlight.Advance();
+		// 待つのは前に提出したフレームの値で、挟んだ値ではない
+		CHECK(waitValue <= frameValue);
+		gpu.WaitFor(waitValue);
+		CHECK(frameInFlight.IsFrameReusable(gpu.completedValue));
+	}
+	CHECK(frameInFlight.GetLastFenceValue() == previousValue);
+}
+
+///=============================================================================
+///						初期化でフェンス値が戻る
+TEST_CASE(FrameInFlight_InitializeResets) {
+	FrameInFlight frameInFlight;
+	frameInFlight.Initialize(3);
+	frameInFlight.Submit();
+	frameInFlight.Advance();
+	frameInFlight.Submit();
+	frameInFlight.Initialize(2);
+	CHECK(frameInFlight.GetFrameIndex() == 0);
+	CHECK(frameInFlight.GetLastFenceValue() == 0);
+	CHECK(frameInFlight.GetFrameFenceValue(0) == 0);
+	CHECK(frameInFlight.GetFrameFenceValue(1) == 0);
+	CHECK(frameInFlight.IsFrameReusable(0));
+}
+
+///=============================================================================
+///						上限を超えるフレーム数はassertで止まる
+DEATH_TEST(FrameInFlight_TooManyFramesAsserts) {
+	FrameInFlight frameInFlight;
+	frameInFlight.Initialize(FrameInFlight::kMaxFrameCount + 1);
+}
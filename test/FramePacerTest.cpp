@@ -0,0 +1,300 @@
+/*********************************************************************
+ * \file   FramePacerTest.cpp
+ * \brief  FramePacerのテスト(偽の時計で待ち方と計測を確かめる)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	using Duration = FrameClock::Duration;
+	using std::chrono::microseconds;
+	using std::chrono::milliseconds;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  FakeClock 呼ばれたときだけ進む時計
+	 * \note   スリープは常にoversleepだけ寝過ごし、スピンは1回でspinStepだけ進む
+	 */
+	struct FakeClock : public FrameClock {
+		Duration now{};						// 現在時刻
+		Duration oversleep{};				// スリープ1回の寝過ごし量
+		Duration spinStep = microseconds(1);	// スピン1回で進む時間
+		uint32_t sleepCount = 0;			// スリープした回数
+		uint32_t spinCount = 0;				// スピンした回数
+
+		Duration Now() override { return now; }
+		void Sleep(Duration duration) override {
+			++sleepCount;
+			now += duration + oversleep;
+		}
+		void Spin() override {
+			++spinCount;
+			now += spinStep;
+		}
+	};
+
+	/// \brief 近い値か
+	bool IsNear(float value, float expected, float tolerance = 1.0e-3f) {
+		return std::fabs(value - expected) <= tolerance;
+	}
+
+	/// \brief 100FPS(1フレーム10ms)
+	constexpr uint32_t k100Fps = 100;
+	constexpr Duration kPeriod = milliseconds(10);
+}
+
+///=============================================================================
+///						寝過ごすと見込みがすぐ増え、その後は1/16ずつ戻る
+TEST_CASE(FramePacer_SleepErrorRisesThenDecays) {
+	FakeClock clock;
+	clock.oversleep = milliseconds(3);
+	FramePacer pacer;
+	pacer.Initialize(&clock, k100Fps);
+	CHECK(pacer.GetSleepErrorEstimate() == milliseconds(1));
+
+	//========================================
+	// 見込み(1ms)より多く寝過ごしたので、その量まで一気に上がる
+	pacer.WaitForNextFrame();
+	CHECK(clock.sleepCount == 1);
+	CHECK(pacer.GetSleepErrorEstimate() == milliseconds(3));
+	// 締め切りを過ぎて起きたのでスピンしない
+	CHECK(clock.spinCount == 0);
+	CHECK(clock.now == kPeriod - microseconds(200) - milliseconds(1) + milliseconds(3));
+
+	//========================================
+	// 寝過ごしが減ると、差の1/16ずつ近づく(1フレーム1回のスリープ)
+	clock.oversleep = microseconds(500);
+	Duration expected = pacer.GetSleepErrorEstimate();
+	for(uint32_t frame = 2; frame <= 100; ++frame) {
+		uint32_t sleepCount = clock.sleepCount;
+		pacer.WaitForNextFrame();
+		CHECK(clock.sleepCount == sleepCount + 1);
+		Duration previous = expected;
+		expected += ( clock.oversleep - expected ) / 16;
+		CHECK(pacer.GetSleepErrorEstimate() == expected);
+		CHECK(expected < previous);
+		// 早めに起きた残りはスピンで詰めて、締め切りから1歩以内で区切る
+		CHECK(clock.now >= kPeriod * frame);
+		CHECK(clock.now < kPeriod * frame + clock.spinStep);
+	}
+	// 実際の寝過ごし量に収束する
+	CHECK(pacer.GetSleepErrorEstimate() - clock.oversleep < microseconds(10));
+
+	//========================================
+	// 1フレームより長い寝過ごしは1フレームで頭打ち
+	clock.oversleep = milliseconds(50);
+	pacer.WaitForNextFrame();
+	CHECK(pacer.GetSleepErrorEstimate() == kPeriod);
+}
+
+///=============================================================================
+///						スピンは締め切りちょうどで止まり、ずれを積み重ねない
+TEST_CASE(FramePacer_SpinFinishesAtDeadline) {
+	//========================================
+	// 見込みどおりに寝過ごすので、スピンに残るのはspinMarginだけ
+	FakeClock clock;
+	clock.oversleep = milliseconds(1);
+	FramePacer pacer;
+	pacer.Initialize(&clock, k100Fps);
+	pacer.WaitForNextFrame();
+	CHECK(clock.sleepCount == 1);
+	CHECK(clock.spinCount == 200);
+	CHECK(clock.now == kPeriod);
+	CHECK(IsNear(pacer.GetDeltaTime(), 0.01f, 1.0e-6f));
+	pacer.WaitForNextFrame();
+	CHECK(clock.spinCount == 400);
+	CHECK(clock.now == kPeriod * 2);
+	CHECK(pacer.GetSleepErrorEstimate() == milliseconds(1));
+
+	//========================================
+	// 割り切れない歩幅では締め切りを少し越えるが、次の締め切りは越えた分だけずれない
+	clock.spinStep = microseconds(3);
+	for(uint32_t frame = 3; frame <= 10; ++frame) {
+		pacer.WaitForNextFrame();
+		CHECK(clock.now >= kPeriod * frame);
+		CHECK(clock.now < kPeriod * frame + clock.spinStep);
+	}
+
+	//========================================
+	// スピンに残す時間を増やすとその分スリープが短くなる
+	clock.spinStep = microseconds(1);
+	pacer.SetSpinMargin(microseconds(500));
+	uint32_t spinCount = clock.spinCount;
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == kPeriod * 11);
+	CHECK(clock.spinCount - spinCount == 500);
+}
+
+///=============================================================================
+///						1フレームより遅れたら締め切りを今に合わせる
+TEST_CASE(FramePacer_ResyncsWhenMoreThanOneFrameLate) {
+	FakeClock clock;
+	clock.oversleep = milliseconds(1);
+	FramePacer pacer;
+	pacer.Initialize(&clock, k100Fps);
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == kPeriod);
+
+	//========================================
+	// 重い処理で2.5フレーム遅れた(締め切り20msに対して35ms)
+	clock.now += milliseconds(25);
+	uint32_t sleepCount = clock.sleepCount;
+	uint32_t spinCount = clock.spinCount;
+	pacer.WaitForNextFrame();
+	// 待たずに区切る
+	CHECK(clock.sleepCount == sleepCount);
+	CHECK(clock.spinCount == spinCount);
+	CHECK(clock.now == milliseconds(35));
+	CHECK(IsNear(pacer.GetDeltaTime(), 0.025f, 1.0e-6f));
+	// 取り戻そうとせず、今から1フレーム後に区切る
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == milliseconds(45));
+
+	//========================================
+	// 1フレーム以内の遅れは合わせ直さず、次のフレームで取り戻す
+	clock.now += milliseconds(18);
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == milliseconds(63));
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == milliseconds(65));
+
+	//========================================
+	// ちょうど1フレームの遅れもまだ合わせ直さない
+	clock.now += milliseconds(20);
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == milliseconds(85));
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == milliseconds(85));
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == milliseconds(95));
+}
+
+///=============================================================================
+///						制限なしでは待たずに区切る
+TEST_CASE(FramePacer_UncappedOnlyMarksFrame) {
+	FakeClock clock;
+	FramePacer pacer;
+	pacer.Initialize(&clock, FramePacer::kUncapped);
+	CHECK(pacer.GetTargetFrameRate() == FramePacer::kUncapped);
+	for(uint32_t frame = 1; frame <= 5; ++frame) {
+		clock.now += milliseconds(frame);
+		pacer.WaitForNextFrame();
+		CHECK(IsNear(pacer.GetDeltaTime(), static_cast<float>( frame ) * 0.001f, 1.0e-6f));
+	}
+	CHECK(clock.sleepCount == 0);
+	CHECK(clock.spinCount == 0);
+	CHECK(clock.now == milliseconds(15));
+	CHECK(pacer.GetStats().frameCount == 5);
+
+	//========================================
+	// 途中で制限すると、直前のフレームから1フレーム後に区切る
+	clock.oversleep = milliseconds(1);
+	pacer.SetTargetFrameRate(k100Fps);
+	pacer.WaitForNextFrame();
+	CHECK(clock.now == milliseconds(25));
+	// 制限を外すとまた待たない
+	pacer.SetTargetFrameRate(FramePacer::kUncapped);
+	uint32_t sleepCount = clock.sleepCount;
+	pacer.WaitForNextFrame();
+	CHECK(clock.sleepCount == sleepCount);
+	CHECK(clock.now == milliseconds(25));
+}
+
+///=============================================================================
+///						デルタタイムは上限で頭打ちになる(統計は実際の時間)
+TEST_CASE(FramePacer_DeltaTimeIsClamped) {
+	FakeClock clock;
+	FramePacer pacer;
+	pacer.Initialize(&clock, FramePacer::kUncapped);
+	clock.now += milliseconds(500);
+	pacer.MarkFrame();
+	CHECK(pacer.GetDeltaTime() == FramePacer::kMaxDeltaTime);
+	CHECK(IsNear(pacer.GetStats().lastFrameMs, 500.0f));
+
+	// ちょうど上限は変わらない、下回ればそのまま
+	clock.now += milliseconds(100);
+	pacer.MarkFrame();
+	CHECK(IsNear(pacer.GetDeltaTime(), FramePacer::kMaxDeltaTime, 1.0e-6f));
+	clock.now += milliseconds(99);
+	pacer.MarkFrame();
+	CHECK(IsNear(pacer.GetDeltaTime(), 0.099f, 1.0e-6f));
+
+	//========================================
+	// 制限ありで1フレーム以上止まっても同じ
+	clock.oversleep = milliseconds(1);
+	pacer.SetTargetFrameRate(k100Fps);
+	clock.now += std::chrono::seconds(2);
+	pacer.WaitForNextFrame();
+	CHECK(pacer.GetDeltaTime() == FramePacer::kMaxDeltaTime);
+	CHECK(IsNear(pacer.GetStats().lastFrameMs, 2000.0f, 1.0e-2f));
+}
+
+///=============================================================================
+///						統計は直近kStatsSampleCountフレームから求める
+TEST_CASE(FramePacer_StatsUseSampleWindow) {
+	FakeClock clock;
+	FramePacer pacer;
+	pacer.Initialize(&clock, FramePacer::kUncapped);
+
+	//========================================
+	// 窓が埋まるまでは記録した分だけで求める
+	for(uint32_t frame = 0; frame < 10; ++frame) {
+		clock.now += milliseconds(50);
+		pacer.MarkFrame();
+	}
+	const FramePacer::FrameStats& stats = pacer.GetStats();
+	CHECK(stats.frameCount == 10);
+	CHECK(IsNear(stats.averageFrameMs, 50.0f));
+	CHECK(IsNear(stats.minFrameMs, 50.0f));
+	CHECK(IsNear(stats.maxFrameMs, 50.0f));
+	CHECK(IsNear(stats.averageFps, 20.0f));
+
+	//========================================
+	// 窓より多く記録すると古い50msは外れる
+	float sum = 0.0f;
+	for(uint32_t frame = 0; frame < FramePacer::kStatsSampleCount; ++frame) {
+		uint32_t frameMs = 1 + frame % 7;
+		sum += static_cast<float>( frameMs );
+		clock.now += milliseconds(frameMs);
+		pacer.MarkFrame();
+	}
+	float average = sum / FramePacer::kStatsSampleCount;
+	CHECK(stats.frameCount == 10 + FramePacer::kStatsSampleCount);
+	CHECK(IsNear(stats.lastFrameMs, static_cast<float>( 1 + ( FramePacer::kStatsSampleCount - 1 ) % 7 )));
+	CHECK(IsNear(stats.averageFrameMs, average));
+	CHECK(IsNear(stats.minFrameMs, 1.0f));
+	CHECK(IsNear(stats.maxFrameMs, 7.0f));
+	CHECK(IsNear(stats.averageFps, 1000.0f / average, 1.0e-2f));
+
+	//========================================
+	// 1フレームだけ長いと最長に出て、窓を抜けると消える
+	clock.now += milliseconds(30);
+	pacer.MarkFrame();
+	CHECK(IsNear(stats.maxFrameMs, 30.0f));
+	for(uint32_t frame = 0; frame < FramePacer::kStatsSampleCount - 1; ++frame) {
+		clock.now += milliseconds(2);
+		pacer.MarkFrame();
+	}
+	CHECK(IsNear(stats.maxFrameMs, 30.0f));
+	clock.now += milliseconds(2);
+	pacer.MarkFrame();
+	CHECK(IsNear(stats.maxFrameMs, 2.0f));
+	CHECK(IsNear(stats.minFrameMs, 2.0f));
+	CHECK(IsNear(stats.averageFrameMs, 2.0f));
+
+	//========================================
+	// リセットで空に戻る
+	pacer.ResetStats();
+	CHECK(stats.frameCount == 0);
+	CHECK(stats.averageFps == 0.0f);
+	clock.now += milliseconds(4);
+	pacer.MarkFrame();
+	CHECK(stats.frameCount == 1);
+	CHECK(IsNear(stats.averageFrameMs, 4.0f));
+	CHECK(IsNear(stats.minFrameMs, 4.0f));
+}
@@ -0,0 +1,85 @@
+/*********************************************************************
+ * \file   FrustumCullerTest.cpp
+ * \brief  視錐台カリングのテスト
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "FrustumCuller.h"
+#include "RenderingMatrices.h"
+#include <random>
+
+namespace {
+	/// \brief 中心と半分の大きさからAABBを作る
+	AABB MakeAABB(const Vector3& center, float halfSize) {
+		Vector3 extent = { halfSize, halfSize, halfSize };
+		return { center - extent, center + extent };
+	}
+
+	/// \brief 1つずつ判定した見えている添え字
+	std::vector<uint32_t> CullOneByOne(const Frustum& frustum, const std::vector<AABB>& bounds) {
+		std::vector<uint32_t> visibleIndices;
+		for(uint32_t i = 0; i < bounds.size(); ++i) {
+			if(frustum.Intersects(bounds[i])) {
+				visibleIndices.push_back(i);
+			}
+		}
+		return visibleIndices;
+	}
+}
+
+///=============================================================================
+///						SoA+SSE版は1つずつの判定と同じ結果になる
+TEST_CASE(FrustumCuller_MatchesIntersects) {
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+	std::uniform_real_distribution<float> size(0.1f, 3.0f);
+	// 4の倍数でない数にして詰め物の扱いも確かめる
+	std::vector<AABB> bounds(10001);
+	for(AABB& aabb : bounds) {
+		aabb = MakeAABB({ position(random), position(random), position(random) }, size(random));
+	}
+	FrustumCuller culler;
+	culler.Reserve(bounds.size());
+	for(const AABB& aabb : bounds) {
+		culler.Push(aabb);
+	}
+	CHECK(culler.GetSize() == bounds.size());
+
+	//========================================
+	// 原点から+Zを向くカメラと、回転して移動したカメラ
+	Matrix4x4 projection = MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 100.0f);
+	Matrix4x4 cameraMatrix = MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, { 0.3f, 2.0f, 0.1f }, { 20.0f, -5.0f, 40.0f });
+	for(const Matrix4x4& viewProjection : { projection, Multiply4x4(Inverse4x4(cameraMatrix), projection) }) {
+		Frustum frustum = Frustum::FromViewProjection(viewProjection);
+		culler.Cull(frustum);
+		std::vector<uint32_t> expected = CullOneByOne(frustum, bounds);
+		CHECK(!expected.empty());
+		CHECK(expected.size() < bounds.size());
+		CHECK(culler.GetVisibleIndices() == expected);
+	}
+}
+
+///=============================================================================
+///						視錐台の内外
+TEST_CASE(FrustumCuller_CullsOutsideBounds) {
+	Frustum frustum = Frustum::FromViewProjection(MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 100.0f));
+	FrustumCuller culler;
+	culler.Push(MakeAABB({ 0.0f, 0.0f, 10.0f }, 1.0f));		// 0:正面
+	culler.Push(MakeAABB({ 0.0f, 0.0f, -10.0f }, 1.0f));	// 1:後ろ
+	culler.Push(MakeAABB({ 0.0f, 0.0f, 150.0f }, 1.0f));	// 2:ファークリップより奥
+	culler.Push(MakeAABB({ 60.0f, 0.0f, 10.0f }, 1.0f));	// 3:右の外
+	culler.Push(MakeAABB({ 0.0f, 0.0f, 100.0f }, 2.0f));	// 4:ファークリップをまたぐ
+	culler.Push(MakeAABB({ 0.0f, 0.0f, 0.0f }, 0.5f));		// 5:カメラを含む
+	culler.Cull(frustum);
+	CHECK(( culler.GetVisibleIndices() == std::vector<uint32_t>{ 0, 4, 5 } ));
+
+	//========================================
+	// 空にすると何も残らない
+	culler.Clear();
+	CHECK(culler.GetSize() == 0);
+	culler.Cull(frustum);
+	CHECK(culler.GetVisibleIndices().empty());
+}
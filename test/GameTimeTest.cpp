@@ -0,0 +1,196 @@
+/*********************************************************************
+ * \file   GameTimeTest.cpp
+ * \brief  GameTimeのテスト(固定ステップの刻み方・補間係数・ポーズ・時間倍率)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "GameTime.h"
+#include <cmath>
+#include <random>
+
+namespace {
+	/// \brief 2進で割り切れる固定ステップ(誤差なしで比べられる)
+	constexpr float kFixedDeltaTime = 0.25f;
+
+	/// \brief 近い値か
+	bool IsNear(double value, double expected, double tolerance = 1.0e-6) {
+		return std::fabs(value - expected) <= tolerance;
+	}
+}
+
+///=============================================================================
+///						固定ステップに分け、余りは次のフレームへ持ち越す
+TEST_CASE(GameTime_AdvanceSplitsStepsAndCarriesRemainder) {
+	GameTime gameTime;
+	gameTime.Initialize(kFixedDeltaTime, 10);
+	CHECK(gameTime.GetFixedDeltaTime() == kFixedDeltaTime);
+	CHECK(gameTime.GetFixedStepCount() == 0);
+
+	//========================================
+	// 1ステップに満たない分は持ち越す
+	gameTime.Advance(0.125f);
+	CHECK(gameTime.GetFixedStepCount() == 0);
+	CHECK(gameTime.GetInterpolationAlpha() == 0.5f);
+	// 持ち越した分と合わせて1ステップ
+	gameTime.Advance(0.125f);
+	CHECK(gameTime.GetFixedStepCount() == 1);
+	CHECK(gameTime.GetInterpolationAlpha() == 0.0f);
+	// 複数ステップと余り
+	gameTime.Advance(0.875f);
+	CHECK(gameTime.GetFixedStepCount() == 3);
+	CHECK(gameTime.GetInterpolationAlpha() == 0.5f);
+	gameTime.Advance(0.375f);
+	CHECK(gameTime.GetFixedStepCount() == 2);
+	CHECK(gameTime.GetInterpolationAlpha() == 0.0f);
+	CHECK(gameTime.GetTotalTime() == 1.5);
+	CHECK(gameTime.GetRealTotalTime() == 1.5);
+
+	//========================================
+	// 負の経過は0として扱う
+	gameTime.Advance(-1.0f);
+	CHECK(gameTime.GetRealDeltaTime() == 0.0f);
+	CHECK(gameTime.GetDeltaTime() == 0.0f);
+	CHECK(gameTime.GetFixedStepCount() == 0);
+	CHECK(gameTime.GetTotalTime() == 1.5);
+}
+
+///=============================================================================
+///						ばらつくフレーム時間でもステップの合計はゲーム内時間と一致する
+TEST_CASE(GameTime_StepsTrackTotalTimeWithJitter) {
+	GameTime gameTime;
+	gameTime.Initialize(GameTime::kDefaultFixedDeltaTime, 1000);
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> frameTime(0.0f, 0.05f);
+	uint64_t totalSteps = 0;
+	bool isAlphaInRange = true;
+	for(uint32_t frame = 0; frame < 100000; ++frame) {
+		// 固定ステップのちょうど整数倍も混ぜる
+		float realDeltaTime = frame % 5 == 0 ? GameTime::kDefaultFixedDeltaTime * static_cast<float>( frame % 3 ) : frameTime(random);
+		gameTime.Advance(realDeltaTime);
+		totalSteps += gameTime.GetFixedStepCount();
+		float alpha = gameTime.GetInterpolationAlpha();
+		isAlphaInRange &= alpha >= 0.0f && alpha < 1.0f;
+	}
+	CHECK(isAlphaInRange);
+	CHECK(gameTime.GetDroppedStepCount() == 0);
+
+	//========================================
+	// 進めたステップと持ち越し分でゲーム内時間になる
+	double steppedTime = static_cast<double>( totalSteps ) * GameTime::kDefaultFixedDeltaTime
+		+ gameTime.GetInterpolationAlpha() * GameTime::kDefaultFixedDeltaTime;
+	CHECK(IsNear(steppedTime, gameTime.GetTotalTime(), 1.0e-6));
+}
+
+///=============================================================================
+///						1フレームのステップ数は上限で止め、超えた分は捨てる
+TEST_CASE(GameTime_MaxFixedStepsDropsExcess) {
+	GameTime gameTime;
+	gameTime.Initialize(kFixedDeltaTime, 3);
+
+	//========================================
+	// 10ステップ分止まった(余りは残す)
+	gameTime.Advance(2.5f + 0.125f);
+	CHECK(gameTime.GetFixedStepCount() == 3);
+	CHECK(gameTime.GetDroppedStepCount() == 7);
+	CHECK(gameTime.GetInterpolationAlpha() == 0.5f);
+	// 捨てた分は次のフレームに持ち越さない
+	gameTime.Advance(0.125f);
+	CHECK(gameTime.GetFixedStepCount() == 1);
+	CHECK(gameTime.GetInterpolationAlpha() == 0.0f);
+	CHECK(gameTime.GetDroppedStepCount() == 7);
+
+	//========================================
+	// ちょうど上限は捨てない
+	gameTime.Advance(0.75f);
+	CHECK(gameTime.GetFixedStepCount() == 3);
+	CHECK(gameTime.GetDroppedStepCount() == 7);
+	// 捨てた数は累計
+	gameTime.Advance(1.0f);
+	CHECK(gameTime.GetFixedStepCount() == 3);
+	CHECK(gameTime.GetDroppedStepCount() == 8);
+	// ゲーム内時間は捨てたステップも含めて進む
+	CHECK(gameTime.GetTotalTime() == 4.5);
+}
+
+///=============================================================================
+///						ポーズ中はステップもデルタタイムも0
+TEST_CASE(GameTime_PauseStopsGameTime) {
+	GameTime gameTime;
+	gameTime.Initialize(kFixedDeltaTime, 10);
+	gameTime.Advance(0.125f);
+	gameTime.SetPaused(true);
+	CHECK(gameTime.IsPaused());
+	for(uint32_t frame = 0; frame < 4; ++frame) {
+		gameTime.Advance(1.0f);
+		CHECK(gameTime.GetFixedStepCount() == 0);
+		CHECK(gameTime.GetDeltaTime() == 0.0f);
+		// 実時間は進む
+		CHECK(gameTime.GetRealDeltaTime() == 1.0f);
+		// 持ち越し分は保たれる
+		CHECK(gameTime.GetInterpolationAlpha() == 0.5f);
+	}
+	CHECK(gameTime.GetTotalTime() == 0.125);
+	CHECK(gameTime.GetRealTotalTime() == 4.125);
+
+	//========================================
+	// 再開すると持ち越し分から続ける
+	gameTime.SetPaused(false);
+	gameTime.Advance(0.125f);
+	CHECK(gameTime.GetFixedStepCount() == 1);
+	CHECK(gameTime.GetDeltaTime() == 0.125f);
+	CHECK(gameTime.GetDroppedStepCount() == 0);
+}
+
+///=============================================================================
+///						時間倍率はゲーム内時間とステップ数にかかる
+TEST_CASE(GameTime_TimeScaleScalesGameTime) {
+	GameTime gameTime;
+	gameTime.Initialize(kFixedDeltaTime, 10);
+
+	//========================================
+	// 倍速
+	gameTime.SetTimeScale(2.0f);
+	CHECK(gameTime.GetTimeScale() == 2.0f);
+	gameTime.Advance(0.5f);
+	CHECK(gameTime.GetDeltaTime() == 1.0f);
+	CHECK(gameTime.GetRealDeltaTime() == 0.5f);
+	CHECK(gameTime.GetFixedStepCount() == 4);
+
+	//========================================
+	// スロー(4フレームで1ステップ)
+	gameTime.SetTimeScale(0.25f);
+	uint32_t steps = 0;
+	for(uint32_t frame = 0; frame < 8; ++frame) {
+		gameTime.Advance(0.25f);
+		steps += gameTime.GetFixedStepCount();
+		CHECK(gameTime.GetDeltaTime() == 0.0625f);
+	}
+	CHECK(steps == 2);
+
+	//========================================
+	// 0倍は止まるがポーズではない
+	gameTime.SetTimeScale(0.0f);
+	gameTime.Advance(1.0f);
+	CHECK(gameTime.GetDeltaTime() == 0.0f);
+	CHECK(gameTime.GetFixedStepCount() == 0);
+	CHECK(!gameTime.IsPaused());
+	CHECK(gameTime.GetTotalTime() == 1.5);
+	CHECK(gameTime.GetRealTotalTime() == 3.5);
+
+	//========================================
+	// 初期化で等速に戻る
+	gameTime.Initialize(kFixedDeltaTime, 10);
+	CHECK(gameTime.GetTimeScale() == 1.0f);
+	CHECK(gameTime.GetTotalTime() == 0.0);
+}
+
+///=============================================================================
+///						負の時間倍率はassertで止まる
+DEATH_TEST(GameTime_NegativeTimeScaleAsserts) {
+	GameTime gameTime;
+	gameTime.Initialize();
+	gameTime.SetTimeScale(-1.0f);
+}
@@ -0,0 +1,215 @@
+/*********************************************************************
+ * \file   LightClusterTest.cpp
+ * \brief  LightClusterのテスト(1つずつ判定する版との比較)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "LightCluster.h"
+#include "AffineTransformations.h"
+#include "MathFunc4x4.h"
+#include "RenderingMatrices.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+	constexpr float kNearClip = 0.1f;
+	constexpr float kFarClip = 100.0f;
+
+	/// \brief カメラの前方に散らばったライト
+	std::vector<PunctualLight> MakeLights(uint32_t count, float maxRadius) {
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+		std::uniform_real_distribution<float> radius(0.5f, maxRadius);
+		std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+		std::vector<PunctualLight> lights(count);
+		for(PunctualLight& light : lights) {
+			light.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+			light.position = { position(random), position(random) * 0.3f, position(random) + 60.0f };
+			light.intensity = 1.0f;
+			light.direction = Normalize(Vector3{ direction(random), direction(random), direction(random) });
+			light.radius = radius(random);
+			light.decay = 2.0f;
+			light.cosAngle = random() % 2 ? 0.8f : 0.3f;
+			light.cosFalloffStart = 0.9f;
+			light.type = random() % 2 ? PunctualLightType::kSpot : PunctualLightType::kPoint;
+		}
+		return lights;
+	}
+
+	/// \brief 少し傾けたカメラのビュー行列
+	Matrix4x4 MakeView() {
+		return InverseAffine(MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, { 0.1f, -0.2f, 0.05f }, { 3.0f, 1.0f, -2.0f }));
+	}
+
+	/// \brief 透視投影行列
+	Matrix4x4 MakeProjection() {
+		return MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, kNearClip, kFarClip);
+	}
+
+	/// \brief ワールド座標の点をビュー空間へ
+	Vector3 ToView(const Vector3& point, const Matrix4x4& view) {
+		return {
+			point.x * view.m[0][0] + point.y * view.m[1][0] + point.z * view.m[2][0] + view.m[3][0],
+			point.x * view.m[0][1] + point.y * view.m[1][1] + point.z * view.m[2][1] + view.m[3][1],
+			point.x * view.m[0][2] + point.y * view.m[1][2] + point.z * view.m[2][2] + view.m[3][2],
+		};
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  MatchesIntersects Buildの結果をクラスタごとに総当たりの判定と比べる
+	 * \return 割り当てがIntersectsの真のライトを番号順に上限まで並べたものと一致するか
+	 * \note   落とした数もクラスタごとの差の合計と比べる
+	 */
+	bool MatchesIntersects(const LightCluster& cluster, const std::vector<PunctualLight>& lights, const Matrix4x4& view) {
+		std::vector<Vector4> spheres;
+		for(const PunctualLight& light : lights) {
+			Vector4 sphere = LightCluster::GetBoundingSphere(light);
+			Vector3 center = ToView({ sphere.x, sphere.y, sphere.z }, view);
+			spheres.push_back({ center.x, center.y, center.z, sphere.w });
+		}
+		uint32_t droppedCount = 0;
+		uint32_t maxLightsPerCluster = 0;
+		std::vector<uint32_t> expected;
+		for(uint32_t z = 0; z < LightCluster::kCountZ; ++z) {
+			for(uint32_t y = 0; y < LightCluster::kCountY; ++y) {
+				for(uint32_t x = 0; x < LightCluster::kCountX; ++x) {
+					expected.clear();
+					for(uint32_t i = 0; i < spheres.size(); ++i) {
+						if(cluster.Intersects({ spheres[i].x, spheres[i].y, spheres[i].z }, spheres[i].w, x, y, z)) {
+							expected.push_back(i);
+						}
+					}
+					uint32_t keptCount = static_cast<uint32_t>( ( std::min )( expected.size(), size_t(LightCluster::kMaxLightsPerCluster) ) );
+					droppedCount += static_cast<uint32_t>( expected.size() ) - keptCount;
+					maxLightsPerCluster = ( std::max )( maxLightsPerCluster, keptCount );
+					const LightCluster::Range& range = cluster.GetRanges()[LightCluster::GetClusterIndex(x, y, z)];
+					if(range.count != keptCount) {
+						return false;
+					}
+					for(uint32_t i = 0; i < keptCount; ++i) {
+						if(cluster.GetLightIndices()[range.offset + i] != expected[i]) {
+							return false;
+						}
+					}
+				}
+			}
+		}
+		return droppedCount == cluster.GetDroppedCount() && maxLightsPerCluster == cluster.GetMaxLightsPerCluster();
+	}
+}
+
+///=============================================================================
+///						割り当ては総当たりの判定と一致する
+TEST_CASE(LightCluster_BuildMatchesIntersects) {
+	const Matrix4x4 view = MakeView();
+	const Matrix4x4 projection = MakeProjection();
+
+	//========================================
+	// 上限に届かない数(端数が出る数にする)
+	std::vector<PunctualLight> lights = MakeLights(203, 6.0f);
+	LightCluster cluster;
+	cluster.Build(lights, view, projection, kNearClip, kFarClip);
+	CHECK(cluster.GetLightCount() == lights.size());
+	CHECK(cluster.GetDroppedCount() == 0);
+	CHECK(MatchesIntersects(cluster, lights, view));
+
+	//========================================
+	// 上限を超えるクラスタがある数(番号の小さいものから残る)
+	lights = MakeLights(1024, 12.0f);
+	cluster.Build(lights, view, projection, kNearClip, kFarClip);
+	CHECK(cluster.GetDroppedCount() > 0);
+	CHECK(cluster.GetMaxLightsPerCluster() == LightCluster::kMaxLightsPerCluster);
+	CHECK(MatchesIntersects(cluster, lights, view));
+
+	//========================================
+	// カメラの面をまたぐ・後ろにあるライト
+	lights = MakeLights(64, 6.0f);
+	for(uint32_t i = 0; i < lights.size(); ++i) {
+		lights[i].position.z = -8.0f + static_cast<float>( i % 16 );
+		lights[i].radius = 3.0f + static_cast<float>( i % 5 );
+	}
+	cluster.Build(lights, Identity4x4(), projection, kNearClip, kFarClip);
+	CHECK(MatchesIntersects(cluster, lights, Identity4x4()));
+}
+
+///=============================================================================
+///						スレッド数によらず同じ結果になる
+TEST_CASE(LightCluster_ThreadCountDoesNotChangeResult) {
+	const Matrix4x4 view = MakeView();
+	const Matrix4x4 projection = MakeProjection();
+	std::vector<PunctualLight> lights = MakeLights(1024, 12.0f);
+	REQUIRE(lights.size() >= LightCluster::kMinLightCountForThreads);
+
+	LightCluster reference;
+	reference.Build(lights, view, projection, kNearClip, kFarClip, 1);
+	for(uint32_t threadCount : { 2u, 5u, LightCluster::kCountZ, 64u }) {
+		LightCluster cluster;
+		cluster.Build(lights, view, projection, kNearClip, kFarClip, threadCount);
+		REQUIRE(cluster.GetRanges().size() == reference.GetRanges().size());
+		bool isSameRanges = true;
+		for(size_t i = 0; i < reference.GetRanges().size(); ++i) {
+			isSameRanges &= cluster.GetRanges()[i].offset == reference.GetRanges()[i].offset
+				&& cluster.GetRanges()[i].count == reference.GetRanges()[i].count;
+		}
+		CHECK(isSameRanges);
+		CHECK(cluster.GetLightIndices() == reference.GetLightIndices());
+		CHECK(cluster.GetDroppedCount() == reference.GetDroppedCount());
+		CHECK(cluster.GetMaxLightsPerCluster() == reference.GetMaxLightsPerCluster());
+	}
+}
+
+///=============================================================================
+///						ライトがなければ全クラスタが空
+TEST_CASE(LightCluster_EmptyLights) {
+	LightCluster cluster;
+	cluster.Build({}, MakeView(), MakeProjection(), kNearClip, kFarClip, 4);
+	CHECK(cluster.GetLightCount() == 0);
+	CHECK(cluster.GetLightIndices().empty());
+	REQUIRE(cluster.GetRanges().size() == LightCluster::kClusterCount);
+	for(const LightCluster::Range& range : cluster.GetRanges()) {
+		CHECK(range.count == 0);
+	}
+	CHECK(cluster.GetDroppedCount() == 0);
+	CHECK(cluster.GetMaxLightsPerCluster() == 0);
+}
+
+///=============================================================================
+///						スポットライトを包む球は頂点と縁を含む
+TEST_CASE(LightCluster_SpotBoundingSphereContainsCone) {
+	const Vector3 kPosition = { 1.0f, -2.0f, 5.0f };
+	const float kRadius = 4.0f;
+	const Vector3 direction = Normalize(Vector3{ 0.3f, -0.5f, 0.8f });
+	// 軸と直交する2つの向き
+	const Vector3 side = Normalize(Vector3{ direction.y, -direction.x, 0.0f });
+	const Vector3 up = { direction.y * side.z - direction.z * side.y, direction.z * side.x - direction.x * side.z, direction.x * side.y - direction.y * side.x };
+	for(float cosAngle : { 0.95f, 0.8f, 0.5f, 0.3f }) {
+		PunctualLight light = {};
+		light.position = kPosition;
+		light.direction = direction;
+		light.radius = kRadius;
+		light.cosAngle = cosAngle;
+		light.type = PunctualLightType::kSpot;
+		Vector4 sphere = LightCluster::GetBoundingSphere(light);
+		Vector3 center = { sphere.x, sphere.y, sphere.z };
+		float tolerance = sphere.w * 1.0e-5f;
+		auto contains = [&](const Vector3& point) { return Length(point - center) <= sphere.w + tolerance; };
+
+		//========================================
+		// 頂点・軸の先・縁
+		CHECK(contains(kPosition));
+		CHECK(contains(kPosition + direction * kRadius));
+		float sinAngle = std::sqrt(1.0f - cosAngle * cosAngle);
+		for(int k = 0; k < 16; ++k) {
+			float phi = 6.28318531f * static_cast<float>( k ) / 16.0f;
+			Vector3 across = side * std::cos(phi) + up * std::sin(phi);
+			CHECK(contains(kPosition + ( direction * cosAngle + across * sinAngle ) * kRadius));
+		}
+		// 点光源の球より大きくならない
+		CHECK(sphere.w <= kRadius + tolerance);
+	}
+}
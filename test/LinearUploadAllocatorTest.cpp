@@ -0,0 +1,190 @@
+/*********************************************************************
+ * \file   LinearUploadAllocatorTest.cpp
+ * \brief  LinearUploadAllocatorのテスト(CPUのメモリを領域として使う)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "LinearUploadAllocator.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace {
+	// GPUアドレスの代わりに使う先頭(CPUのアドレスとずらして対応を確認する)
+	constexpr uint64_t kGpuBase = 0x10000000ull;
+
+	/// \brief 確保結果のオフセット(CPUとGPUで一致しなければ~0)
+	size_t GetOffset(const UploadAllocation& allocation, const uint8_t* cpuBase) {
+		size_t cpuOffset = static_cast<size_t>( static_cast<const uint8_t*>( allocation.cpuAddress ) - cpuBase );
+		size_t gpuOffset = static_cast<size_t>( allocation.gpuAddress - kGpuBase );
+		return cpuOffset == gpuOffset ? cpuOffset : ~size_t(0);
+	}
+}
+
+///=============================================================================
+///						アライメント
+TEST_CASE(LinearUploadAllocator_AlignsOffsets) {
+	std::vector<uint8_t> buffer(4096);
+	LinearUploadAllocator allocator;
+	allocator.Reset(buffer.data(), kGpuBase, buffer.size());
+
+	//========================================
+	// 既定は定数バッファのアライメント
+	UploadAllocation first = allocator.Allocate(10);
+	REQUIRE(first.cpuAddress != nullptr);
+	CHECK(GetOffset(first, buffer.data()) == 0);
+	CHECK(first.size == 10);
+	UploadAllocation second = allocator.Allocate(4);
+	REQUIRE(second.cpuAddress != nullptr);
+	CHECK(GetOffset(second, buffer.data()) == 256);
+
+	//========================================
+	// 小さいアライメントなら直後に詰める
+	UploadAllocation third = allocator.Allocate(3, 16);
+	REQUIRE(third.cpuAddress != nullptr);
+	CHECK(GetOffset(third, buffer.data()) == 272);
+	UploadAllocation fourth = allocator.Allocate(8, 1);
+	REQUIRE(fourth.cpuAddress != nullptr);
+	CHECK(GetOffset(fourth, buffer.data()) == 275);
+	CHECK(allocator.GetUsedSize() == 283);
+
+	// 大きいアライメント
+	UploadAllocation fifth = allocator.Allocate(1, 1024);
+	REQUIRE(fifth.cpuAddress != nullptr);
+	CHECK(GetOffset(fifth, buffer.data()) == 1024);
+	CHECK(allocator.GetOverflowCount() == 0);
+}
+
+///=============================================================================
+///						容量不足
+TEST_CASE(LinearUploadAllocator_CountsOverflow) {
+	std::vector<uint8_t> buffer(1024);
+	LinearUploadAllocator allocator;
+	allocator.Reset(buffer.data(), kGpuBase, buffer.size());
+
+	for(uint32_t i = 0; i < 4; ++i) {
+		CHECK(allocator.Allocate(200).cpuAddress != nullptr);
+	}
+	CHECK(allocator.GetUsedSize() == 968);
+
+	//========================================
+	// 入り切らない確保は失敗し、使用量は変わらない
+	UploadAllocation overflow = allocator.Allocate(200);
+	CHECK(overflow.cpuAddress == nullptr);
+	CHECK(overflow.gpuAddress == 0);
+	CHECK(overflow.size == 0);
+	CHECK(allocator.GetOverflowCount() == 1);
+	CHECK(allocator.GetUsedSize() == 968);
+	// アライメント後の位置で判定する(残り56バイトでも256揃えでは入らない)
+	CHECK(allocator.Allocate(16).cpuAddress == nullptr);
+	CHECK(allocator.GetOverflowCount() == 2);
+	// 残りに収まる確保はまだできる
+	UploadAllocation tail = allocator.Allocate(56, 8);
+	REQUIRE(tail.cpuAddress != nullptr);
+	CHECK(GetOffset(tail, buffer.data()) == 968);
+	CHECK(allocator.GetUsedSize() == buffer.size());
+}
+
+///=============================================================================
+///						巻き戻し
+TEST_CASE(LinearUploadAllocator_ResetRewindsAndKeepsPeak) {
+	std::vector<uint8_t> frame0(2048);
+	std::vector<uint8_t> frame1(512);
+	LinearUploadAllocator allocator;
+	allocator.Reset(frame0.data(), kGpuBase, frame0.size());
+	CHECK(allocator.GetCapacity() == frame0.size());
+
+	allocator.Allocate(1000, 8);
+	allocator.Allocate(4096);
+	CHECK(allocator.GetUsedSize() == 1000);
+	CHECK(allocator.GetPeakUsedSize() == 0);
+
+	//========================================
+	// 別の領域で使い直す。前のフレームの使用量が最大値に残る
+	allocator.Reset(frame1.data(), kGpuBase, frame1.size());
+	CHECK(allocator.GetUsedSize() == 0);
+	CHECK(allocator.GetPeakUsedSize() == 1000);
+	CHECK(allocator.GetCapacity() == frame1.size());
+	UploadAllocation allocation = allocator.Allocate(64);
+	REQUIRE(allocation.cpuAddress != nullptr);
+	CHECK(allocation.cpuAddress == frame1.data());
+	CHECK(GetOffset(allocation, frame1.data()) == 0);
+	// 失敗回数はリセットで消えない(累計)
+	CHECK(allocator.GetOverflowCount() == 1);
+
+	// 最大値は小さいフレームで下がらない
+	allocator.Reset(frame0.data(), kGpuBase, frame0.size());
+	CHECK(allocator.GetPeakUsedSize() == 1000);
+}
+
+///=============================================================================
+///						複数スレッドからの同時確保
+TEST_CASE(LinearUploadAllocator_ConcurrentAllocationsDoNotOverlap) {
+	constexpr uint32_t kThreadCount = 8;
+	constexpr uint32_t kAllocationCount = 2000;
+	// 全部は入り切らない大きさにして、失敗も同時に起こす
+	std::vector<uint8_t> buffer(kThreadCount * kAllocationCount * 24);
+	LinearUploadAllocator allocator;
+	allocator.Reset(buffer.data(), kGpuBase, buffer.size());
+
+	//========================================
+	// 各スレッドが確保した領域を自分の番号で埋める
+	struct Range {
+		size_t offset;
+		size_t size;
+		uint8_t owner;
+	};
+	std::vector<std::vector<Range>> ranges(kThreadCount);
+	std::vector<uint32_t> failedCounts(kThreadCount, 0);
+	std::vector<std::thread> threads;
+	for(uint32_t t = 0; t < kThreadCount; ++t) {
+		threads.emplace_back([&, t] {
+			for(uint32_t i = 0; i < kAllocationCount; ++i) {
+				size_t size = 1 + ( i * 7 + t * 13 ) % 64;
+				size_t alignment = size_t(1) << ( ( i + t ) % 6 );
+				UploadAllocation allocation = allocator.Allocate(size, alignment);
+				if(!allocation.cpuAddress) {
+					++failedCounts[t];
+					continue;
+				}
+				std::fill_n(static_cast<uint8_t*>( allocation.cpuAddress ), size, static_cast<uint8_t>( t + 1 ));
+				ranges[t].push_back({ GetOffset(allocation, buffer.data()), size, static_cast<uint8_t>( t + 1 ) });
+				if(ranges[t].back().offset % alignment != 0) {
+					ranges[t].back().owner = 0;
+				}
+			}
+		});
+	}
+	for(auto& thread : threads) {
+		thread.join();
+	}
+
+	//========================================
+	// 領域内に収まり、重ならず、書いた内容が残っている
+	std::vector<Range> allRanges;
+	uint32_t failedCount = 0;
+	for(uint32_t t = 0; t < kThreadCount; ++t) {
+		allRanges.insert(allRanges.end(), ranges[t].begin(), ranges[t].end());
+		failedCount += failedCounts[t];
+	}
+	CHECK(failedCount > 0);
+	CHECK(allocator.GetOverflowCount() == failedCount);
+	std::sort(allRanges.begin(), allRanges.end(), [](const Range& a, const Range& b) { return a.offset < b.offset; });
+	REQUIRE(!allRanges.empty());
+	for(size_t i = 0; i < allRanges.size(); ++i) {
+		const Range& range = allRanges[i];
+		// アライメント違反はownerを0にしてある
+		REQUIRE(range.owner != 0);
+		REQUIRE(range.offset + range.size <= buffer.size());
+		if(i + 1 < allRanges.size()) {
+			REQUIRE(range.offset + range.size <= allRanges[i + 1].offset);
+		}
+		bool isIntact = std::all_of(buffer.begin() + range.offset, buffer.begin() + range.offset + range.size,
+			[&](uint8_t value) { return value == range.owner; });
+		REQUIRE(isIntact);
+	}
+	CHECK(allocator.GetUsedSize() == allRanges.back().offset + allRanges.back().size);
+}
@@ -0,0 +1,233 @@
+/*********************************************************************
+ * \file   MathFunc4x4Test.cpp
+ * \brief  4x4行列の乗算・逆行列のテスト(SIMD版とスカラー版の比較)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   MATH_NO_SIMDを定義した構成でも同じテストが通ること(CIで両方実行する)
+ *********************************************************************/
+#include "TestFramework.h"
+#include "MathFunc4x4.h"
+#include "AffineTransformations.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+
+namespace {
+	//========================================
+	// 倍精度の行列(誤差の基準)
+	struct Matrix4x4d {
+		double m[4][4];
+	};
+
+	/// \brief 倍精度へ
+	Matrix4x4d ToDouble(const Matrix4x4& matrix) {
+		Matrix4x4d result;
+		for(int row = 0; row < 4; ++row) {
+			for(int column = 0; column < 4; ++column) {
+				result.m[row][column] = matrix.m[row][column];
+			}
+		}
+		return result;
+	}
+
+	/// \brief 行ごとの絶対値の和の最大(∞ノルム)
+	double Norm(const Matrix4x4d& matrix) {
+		double norm = 0.0;
+		for(int row = 0; row < 4; ++row) {
+			double sum = 0.0;
+			for(int column = 0; column < 4; ++column) {
+				sum += std::fabs(matrix.m[row][column]);
+			}
+			norm = ( std::max )( norm, sum );
+		}
+		return norm;
+	}
+
+	/// \brief 倍精度の逆行列(部分ピボット付きの掃き出し法)
+	Matrix4x4d InverseDouble(const Matrix4x4d& matrix) {
+		Matrix4x4d a = matrix;
+		Matrix4x4d inverse = {};
+		for(int i = 0; i < 4; ++i) {
+			inverse.m[i][i] = 1.0;
+		}
+		for(int column = 0; column < 4; ++column) {
+			int pivot = column;
+			for(int row = column + 1; row < 4; ++row) {
+				if(std::fabs(a.m[row][column]) > std::fabs(a.m[pivot][column])) {
+					pivot = row;
+				}
+			}
+			for(int k = 0; k < 4; ++k) {
+				std::swap(a.m[column][k], a.m[pivot][k]);
+				std::swap(inverse.m[column][k], inverse.m[pivot][k]);
+			}
+			double scale = 1.0 / a.m[column][column];
+			for(int k = 0; k < 4; ++k) {
+				a.m[column][k] *= scale;
+				inverse.m[column][k] *= scale;
+			}
+			for(int row = 0; row < 4; ++row) {
+				if(row == column) {
+					continue;
+				}
+				double factor = a.m[row][column];
+				for(int k = 0; k < 4; ++k) {
+					a.m[row][k] -= factor * a.m[column][k];
+					inverse.m[row][k] -= factor * inverse.m[column][k];
+				}
+			}
+		}
+		return inverse;
+	}
+
+	/// \brief 行列の差の最大(∞ノルム)を基準の大きさで割ったもの
+	double RelativeError(const Matrix4x4& actual, const Matrix4x4d& expected) {
+		Matrix4x4d difference;
+		for(int row = 0; row < 4; ++row) {
+			for(int column = 0; column < 4; ++column) {
+				difference.m[row][column] = actual.m[row][column] - expected.m[row][column];
+			}
+		}
+		return Norm(difference) / Norm(expected);
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  InverseErrorBound 逆行列の誤差の上限
+	 * \note   単精度で求めた逆行列の相対誤差は 条件数 * 機械イプシロン 程度になる。
+	 *         求め方(余因子・ブロック分割)による差を見込んで係数をかける
+	 */
+	double InverseErrorBound(const Matrix4x4d& matrix, const Matrix4x4d& inverse) {
+		return 8.0 * Norm(matrix) * Norm(inverse) * FLT_EPSILON;
+	}
+
+	/// \brief 成分が一様乱数の行列
+	Matrix4x4 MakeRandomMatrix(std::mt19937& random) {
+		std::uniform_real_distribution<float> element(-10.0f, 10.0f);
+		Matrix4x4 matrix;
+		for(int row = 0; row < 4; ++row) {
+			for(int column = 0; column < 4; ++column) {
+				matrix.m[row][column] = element(random);
+			}
+		}
+		return matrix;
+	}
+
+	/// \brief 拡大縮小・回転・平行移動の行列
+	Matrix4x4 MakeRandomAffine(std::mt19937& random) {
+		std::uniform_real_distribution<float> scale(0.1f, 10.0f);
+		std::uniform_real_distribution<float> angle(-3.14159265f, 3.14159265f);
+		std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+		return MakeAffineMatrix({ scale(random), scale(random), scale(random) },
+			{ angle(random), angle(random), angle(random) },
+			{ position(random), position(random), position(random) });
+	}
+
+	/// \brief 4行目がほかの行の組み合わせにほぼ等しい(特異に近い)行列
+	Matrix4x4 MakeNearSingular(std::mt19937& random, float epsilon) {
+		std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+		Matrix4x4 matrix = MakeRandomMatrix(random);
+		for(int column = 0; column < 4; ++column) {
+			matrix.m[3][column] = matrix.m[0][column] + matrix.m[1][column] - matrix.m[2][column] + epsilon * noise(random);
+		}
+		return matrix;
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  CheckInverse SIMD版・スカラー版の逆行列を倍精度の逆行列と比べる
+	 * \return 両方とも誤差の上限に収まり、互いの差も上限の2倍以内か
+	 */
+	bool CheckInverse(const Matrix4x4& matrix) {
+		Matrix4x4d matrixd = ToDouble(matrix);
+		Matrix4x4d expected = InverseDouble(matrixd);
+		double bound = InverseErrorBound(matrixd, expected);
+		Matrix4x4 simd = Inverse4x4(matrix);
+		Matrix4x4 scalar = Inverse4x4Scalar(matrix);
+		return RelativeError(simd, expected) <= bound &&
+			RelativeError(scalar, expected) <= bound &&
+			RelativeError(simd, ToDouble(scalar)) <= 2.0 * bound;
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  CheckMultiply SIMD版とスカラー版の積を比べる
+	 * \note   積和の順番は同じだが、FMAを使う構成では丸めが1回少ないので、
+	 *         成分ごとに 絶対値の積の和 * 機械イプシロン の数倍まで許す
+	 */
+	bool CheckMultiply(const Matrix4x4& m1, const Matrix4x4& m2) {
+		Matrix4x4 simd = Multiply4x4(m1, m2);
+		Matrix4x4 scalar = Multiply4x4Scalar(m1, m2);
+		for(int row = 0; row < 4; ++row) {
+			for(int column = 0; column < 4; ++column) {
+				double magnitude = 0.0;
+				for(int k = 0; k < 4; ++k) {
+					magnitude += std::fabs(static_cast<double>( m1.m[row][k] ) * m2.m[k][column]);
+				}
+				double tolerance = 4.0 * magnitude * FLT_EPSILON;
+				if(!( std::fabs(static_cast<double>( simd.m[row][column] ) - scalar.m[row][column]) <= tolerance )) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+///=============================================================================
+///						乗算はスカラー版と一致する
+TEST_CASE(MathFunc4x4_MultiplyMatchesScalar) {
+	std::mt19937 random(1234);
+	bool isMatched = true;
+	for(int i = 0; i < 1000; ++i) {
+		isMatched &= CheckMultiply(MakeRandomMatrix(random), MakeRandomMatrix(random));
+		isMatched &= CheckMultiply(MakeRandomAffine(random), MakeRandomAffine(random));
+		isMatched &= CheckMultiply(MakeRandomMatrix(random), MakeRandomAffine(random));
+		isMatched &= CheckMultiply(MakeNearSingular(random, 1.0e-3f), MakeRandomMatrix(random));
+	}
+	CHECK(isMatched);
+
+	//========================================
+	// 単位行列をかけても変わらない
+	Matrix4x4 matrix = MakeRandomMatrix(random);
+	CHECK(Multiply4x4(matrix, Identity4x4()) == matrix);
+	CHECK(Multiply4x4(Identity4x4(), matrix) == matrix);
+}
+
+///=============================================================================
+///						逆行列は倍精度の逆行列と誤差の範囲で一致する
+TEST_CASE(MathFunc4x4_InverseMatchesScalar) {
+	std::mt19937 random(1234);
+	bool isRandomMatched = true;
+	bool isAffineMatched = true;
+	for(int i = 0; i < 1000; ++i) {
+		isRandomMatched &= CheckInverse(MakeRandomMatrix(random));
+		Matrix4x4 affine = MakeRandomAffine(random);
+		isAffineMatched &= CheckInverse(affine);
+		// アフィン専用の逆行列とも一致する
+		isAffineMatched &= RelativeError(Inverse4x4(affine), ToDouble(InverseAffine(affine))) <= InverseErrorBound(ToDouble(affine), ToDouble(InverseAffine(affine)));
+	}
+	CHECK(isRandomMatched);
+	CHECK(isAffineMatched);
+}
+
+///=============================================================================
+///						特異に近い行列でも条件数に見合った誤差に収まる
+TEST_CASE(MathFunc4x4_InverseNearSingular) {
+	std::mt19937 random(1234);
+	for(float epsilon : { 1.0e-1f, 1.0e-2f, 1.0e-3f }) {
+		bool isMatched = true;
+		for(int i = 0; i < 1000; ++i) {
+			isMatched &= CheckInverse(MakeNearSingular(random, epsilon));
+		}
+		CHECK(isMatched);
+	}
+
+	//========================================
+	// ちょうど特異な行列はどちらも例外を投げる
+	Matrix4x4 singular = MakeRandomMatrix(random);
+	for(int column = 0; column < 4; ++column) {
+		singular.m[2][column] = 0.0f;
+	}
+	CHECK_THROWS_AS(Inverse4x4(singular), std::runtime_error);
+	CHECK_THROWS_AS(Inverse4x4Scalar(singular), std::runtime_error);
+}
@@ -0,0 +1,212 @@
+/*********************************************************************
+ * \file   ParallelPassRecorderTest.cpp
+ * \brief  ParallelPassRecorderのテスト(NullCommandRecorderで記録を確認する)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "NullCommandRecorder.h"
+#include "ParallelPassRecorder.h"
+#include <array>
+#include <chrono>
+#include <set>
+#include <stdexcept>
+
+namespace {
+	using EventType = NullCommandRecorder::Event::Type;
+
+	/// \brief 指定した種類の呼び出しの数
+	size_t CountEvents(const std::vector<NullCommandRecorder::Event>& events, EventType type) {
+		size_t count = 0;
+		for(const auto& event : events) {
+			count += event.type == type ? 1 : 0;
+		}
+		return count;
+	}
+}
+
+///=============================================================================
+///						全パスが1回ずつ記録され、登録順で1回提出される
+TEST_CASE(ParallelPassRecorder_SubmitsInRegistrationOrder) {
+	NullCommandRecorder recorder;
+	ParallelPassRecorder passRecorder;
+	passRecorder.Initialize(&recorder, 3);
+
+	constexpr uint32_t kPassCount = 16;
+	std::array<std::atomic<uint32_t>, kPassCount> recordCounts = {};
+	for(uint32_t i = 0; i < kPassCount; ++i) {
+		passRecorder.AddPass("Pass" + std::to_string(i), [&recordCounts, i] {
+			// 後ろのパスほど早く終わるようにして、記録の完了順と提出順をずらす
+			std::this_thread::sleep_for(std::chrono::microseconds(( kPassCount - i ) * 50));
+			++recordCounts[i];
+		});
+	}
+	passRecorder.Execute();
+
+	//========================================
+	// 記録
+	for(uint32_t i = 0; i < kPassCount; ++i) {
+		CHECK(recordCounts[i] == 1);
+	}
+	CHECK(passRecorder.GetPassCount() == 0);
+
+	//========================================
+	// 呼び出し順
+	const auto events = recorder.GetEvents();
+	REQUIRE(events.size() == 2 + kPassCount * 2);
+	CHECK(events.front().type == EventType::BeginFrame);
+	CHECK(events.front().value == kPassCount);
+	CHECK(events.back().type == EventType::Submit);
+	// BeginFrameとSubmitはメインスレッドから呼ばれる
+	CHECK(events.front().threadId == std::this_thread::get_id());
+	CHECK(events.back().threadId == std::this_thread::get_id());
+	// 各パスはBeginPassとEndPassが同じスレッドで1回ずつ、この順番で呼ばれる
+	for(uint32_t i = 0; i < kPassCount; ++i) {
+		int beginPosition = -1;
+		int endPosition = -1;
+		for(size_t e = 0; e < events.size(); ++e) {
+			if(events[e].value != i) {
+				continue;
+			}
+			if(events[e].type == EventType::BeginPass) {
+				CHECK(beginPosition < 0);
+				beginPosition = static_cast<int>( e );
+			} else if(events[e].type == EventType::EndPass) {
+				CHECK(endPosition < 0);
+				endPosition = static_cast<int>( e );
+			}
+		}
+		REQUIRE(0 <= beginPosition && beginPosition < endPosition);
+		CHECK(events[beginPosition].threadId == events[endPosition].threadId);
+	}
+
+	//========================================
+	// 提出順
+	CHECK(recorder.GetSubmitCount() == 1);
+	const auto submitOrder = recorder.GetLastSubmitOrder();
+	REQUIRE(submitOrder.size() == kPassCount);
+	for(uint32_t i = 0; i < kPassCount; ++i) {
+		CHECK(submitOrder[i] == i);
+	}
+}
+
+///=============================================================================
+///						複数のスレッドで同時に記録する
+TEST_CASE(ParallelPassRecorder_RecordsOnWorkerThreads) {
+	NullCommandRecorder recorder;
+	ParallelPassRecorder passRecorder;
+	constexpr uint32_t kWorkerCount = 3;
+	passRecorder.Initialize(&recorder, kWorkerCount);
+	CHECK(passRecorder.GetWorkerCount() == kWorkerCount);
+
+	//========================================
+	// 全パスが記録に入るまで各パスを待たせる。
+	// 1つのスレッドは同時に1パスしか記録できないので、全スレッドが1パスずつ受け持つ
+	constexpr uint32_t kPassCount = kWorkerCount + 1;
+	std::mutex mutex;
+	std::condition_variable condition;
+	uint32_t startedCount = 0;
+	bool isTimeout = false;
+	for(uint32_t i = 0; i < kPassCount; ++i) {
+		passRecorder.AddPass("Pass" + std::to_string(i), [&] {
+			std::unique_lock<std::mutex> lock(mutex);
+			++startedCount;
+			condition.notify_all();
+			if(!condition.wait_for(lock, std::chrono::seconds(10), [&] { return startedCount == kPassCount; })) {
+				isTimeout = true;
+			}
+		});
+	}
+	passRecorder.Execute();
+	CHECK(!isTimeout);
+
+	std::set<std::thread::id> threadIds;
+	for(const auto& event : recorder.GetEvents()) {
+		if(event.type == EventType::BeginPass) {
+			threadIds.insert(event.threadId);
+		}
+	}
+	CHECK(threadIds.size() == kPassCount);
+}
+
+///=============================================================================
+///						ワーカーなしならメインスレッドだけで記録する
+TEST_CASE(ParallelPassRecorder_WithoutWorkersRecordsOnMainThread) {
+	NullCommandRecorder recorder;
+	ParallelPassRecorder passRecorder;
+	passRecorder.Initialize(&recorder, 0);
+
+	std::vector<uint32_t> recordOrder;
+	for(uint32_t i = 0; i < 4; ++i) {
+		passRecorder.AddPass("Pass" + std::to_string(i), [&recordOrder, i] { recordOrder.push_back(i); });
+	}
+	passRecorder.Execute();
+
+	CHECK(( recordOrder == std::vector<uint32_t>{ 0, 1, 2, 3 } ));
+	for(const auto& event : recorder.GetEvents()) {
+		CHECK(event.threadId == std::this_thread::get_id());
+	}
+	CHECK(( recorder.GetLastSubmitOrder() == std::vector<uint32_t>{ 0, 1, 2, 3 } ));
+}
+
+///=============================================================================
+///						記録中の例外はメインスレッドへ送られ、提出しない
+TEST_CASE(ParallelPassRecorder_RethrowsAndSkipsSubmit) {
+	NullCommandRecorder recorder;
+	ParallelPassRecorder passRecorder;
+	passRecorder.Initialize(&recorder, 2);
+
+	constexpr uint32_t kPassCount = 8;
+	constexpr uint32_t kThrowPass = 5;
+	std::atomic<uint32_t> recordCount = 0;
+	for(uint32_t i = 0; i < kPassCount; ++i) {
+		passRecorder.AddPass("Pass" + std::to_string(i), [&recordCount, i] {
+			++recordCount;
+			if(i == kThrowPass) {
+				throw std::runtime_error("record failed");
+			}
+		});
+	}
+	CHECK_THROWS_AS(passRecorder.Execute(), std::runtime_error);
+
+	// 他のパスは最後まで記録され、提出はされない
+	CHECK(recordCount == kPassCount);
+	const auto events = recorder.GetEvents();
+	CHECK(CountEvents(events, EventType::Submit) == 0);
+	CHECK(CountEvents(events, EventType::BeginPass) == kPassCount);
+	// 例外を投げたパスはEndPassまで進まない
+	CHECK(CountEvents(events, EventType::EndPass) == kPassCount - 1);
+	CHECK(recorder.GetSubmitCount() == 0);
+	CHECK(passRecorder.GetPassCount() == 0);
+
+	//========================================
+	// 例外の後も次のフレームは記録できる
+	recorder.Clear();
+	passRecorder.AddPass("Next", [] {});
+	passRecorder.Execute();
+	CHECK(recorder.GetSubmitCount() == 1);
+	CHECK(( recorder.GetLastSubmitOrder() == std::vector<uint32_t>{ 0 } ));
+}
+
+///=============================================================================
+///						フレームごとに提出する
+TEST_CASE(ParallelPassRecorder_SubmitsEveryFrame) {
+	NullCommandRecorder recorder;
+	ParallelPassRecorder passRecorder;
+	passRecorder.Initialize(&recorder, 2);
+
+	for(uint32_t frame = 1; frame <= 3; ++frame) {
+		for(uint32_t i = 0; i < frame; ++i) {
+			passRecorder.AddPass("Pass" + std::to_string(i), [] {});
+		}
+		passRecorder.Execute();
+		CHECK(recorder.GetSubmitCount() == frame);
+		CHECK(recorder.GetLastSubmitOrder().size() == frame);
+	}
+	// パスがなければ何も呼ばない
+	recorder.Clear();
+	passRecorder.Execute();
+	CHECK(recorder.GetEvents().empty());
+}
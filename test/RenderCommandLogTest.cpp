@@ -0,0 +1,182 @@
+/*********************************************************************
+ * \file   RenderCommandLogTest.cpp
+ * \brief  RenderCommandLogのテスト(保存・読み込み・再生の往復と壊れたファイル)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   テスト用のファイルは一時ディレクトリに書いて最後に消す
+ *********************************************************************/
+#include "TestFramework.h"
+#include "RenderCommandLog.h"
+#include "NullCommandList.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+	/// \brief 記録値として使うだけの偽のポインタ
+	template<class T>
+	T* FakePointer(uintptr_t value) {
+		return reinterpret_cast<T*>( value );
+	}
+
+	/// \brief テスト用のファイルのパス
+	std::filesystem::path GetTestPath(const char* name) {
+		return std::filesystem::temp_directory_path() / "EngineTest" / name;
+	}
+
+	/// \brief コマンド列が同じか(固定長で詰め物も明示しているのでバイトで比べる)
+	bool IsSameCommands(const std::vector<RenderCommand>& a, const std::vector<RenderCommand>& b) {
+		return a.size() == b.size() && ( a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(RenderCommand)) == 0 );
+	}
+
+	/// \brief ファイルの中身をすべて読む
+	std::vector<char> ReadBytes(const std::filesystem::path& path) {
+		std::ifstream file(path, std::ios::binary);
+		return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	/// \brief ファイルに書く
+	void WriteBytes(const std::filesystem::path& path, const std::vector<char>& bytes) {
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(bytes.data(), static_cast<std::streamsize>( bytes.size() ));
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  RecordSampleFrame すべての種類のコマンドを含む1フレーム分を記録する
+	 */
+	std::vector<RenderCommand> RecordSampleFrame() {
+		NullCommandList commandList;
+		ID3D12DescriptorHeap* heap = FakePointer<ID3D12DescriptorHeap>(0x1000);
+		ID3D12Resource* target = FakePointer<ID3D12Resource>(0x2000);
+		ID3D12Resource* transient = FakePointer<ID3D12Resource>(0x3000);
+
+		ResourceBarrierDesc barrier;
+		barrier.resource = target;
+		barrier.before = ResourceState::kPresent;
+		barrier.after = ResourceState::kRenderTarget;
+		commandList.ResourceBarriers(1, &barrier);
+		commandList.SetDescriptorHeaps(1, &heap);
+		commandList.SetGraphicsRootSignature(FakePointer<ID3D12RootSignature>(0x4000));
+		commandList.SetPipelineState(FakePointer<ID3D12PipelineState>(0x5000));
+		commandList.IASetPrimitiveTopology(PrimitiveTopology::kTriangleList);
+		VertexBufferView vertexBuffers[2] = { { 0x10000, 4096, 32 }, { 0x20000, 1024, 16 } };
+		commandList.IASetVertexBuffers(0, 2, vertexBuffers);
+		commandList.IASetIndexBuffer({ 0x30000, 768, IndexFormat::kUint16 });
+		commandList.SetGraphicsRootConstantBufferView(0, 0x40000);
+		commandList.SetGraphicsRootShaderResourceView(1, 0x50000);
+		commandList.SetGraphicsRootDescriptorTable(2, 0x60000);
+		commandList.DrawInstanced(6, 128, 0, 0);
+		commandList.DrawIndexedInstanced(36, 4, 12, -8, 2);
+
+		ResourceBarrierDesc aliasing;
+		aliasing.type = ResourceBarrierDesc::Type::kAliasing;
+		aliasing.resource = transient;
+		aliasing.resourceBefore = target;
+		commandList.ResourceBarriers(1, &aliasing);
+		return commandList.TakeCommands();
+	}
+}
+
+///=============================================================================
+///						保存して読み込み、再生すると元と同じ列になる
+TEST_CASE(RenderCommandLog_SaveLoadReplayRoundTrip) {
+	const std::vector<RenderCommand> captured = RecordSampleFrame();
+	// 13種類すべて含む(頂点バッファは2スロット分)
+	REQUIRE(captured.size() == static_cast<size_t>( RenderCommandType::kCount ) + 1);
+	const std::filesystem::path path = GetTestPath("RoundTrip.mrcl");
+	REQUIRE(RenderCommandLog::Save(path, captured));
+	CHECK(std::filesystem::file_size(path) > captured.size() * sizeof(RenderCommand));
+
+	//========================================
+	// 読み込んだ列はそのまま一致する
+	std::vector<RenderCommand> loaded;
+	REQUIRE(RenderCommandLog::Load(path, loaded));
+	CHECK(IsSameCommands(loaded, captured));
+
+	//========================================
+	// 再生した先で記録し直しても一致する
+	NullCommandList replayed;
+	RenderCommandLog::Replay(loaded, &replayed);
+	CHECK(IsSameCommands(replayed.GetCommands(), captured));
+
+	//========================================
+	// 空の列も往復できる
+	REQUIRE(RenderCommandLog::Save(path, {}));
+	loaded = captured;
+	REQUIRE(RenderCommandLog::Load(path, loaded));
+	CHECK(loaded.empty());
+
+	std::filesystem::remove_all(path.parent_path());
+}
+
+///=============================================================================
+///						複数のヒープは先頭の1つとして再生する
+TEST_CASE(RenderCommandLog_ReplaysFirstDescriptorHeapOnly) {
+	NullCommandList commandList;
+	ID3D12DescriptorHeap* heaps[2] = { FakePointer<ID3D12DescriptorHeap>(0x1000), FakePointer<ID3D12DescriptorHeap>(0x2000) };
+	commandList.SetDescriptorHeaps(2, heaps);
+	commandList.SetDescriptorHeaps(0, nullptr);
+
+	NullCommandList replayed;
+	RenderCommandLog::Replay(commandList.GetCommands(), &replayed);
+	REQUIRE(replayed.GetCommands().size() == 2);
+	CHECK(replayed.GetCommands()[0].value == 0x1000);
+	CHECK(replayed.GetCommands()[0].args[0] == 1);
+	CHECK(replayed.GetCommands()[1].value == 0);
+	CHECK(replayed.GetCommands()[1].args[0] == 0);
+}
+
+///=============================================================================
+///						途中で切れた・バージョンや形式が違うファイルは読み込まない
+TEST_CASE(RenderCommandLog_LoadRejectsBrokenFiles) {
+	const std::vector<RenderCommand> captured = RecordSampleFrame();
+	const std::filesystem::path path = GetTestPath("Broken.mrcl");
+	REQUIRE(RenderCommandLog::Save(path, captured));
+	const std::vector<char> bytes = ReadBytes(path);
+	const size_t headerSize = bytes.size() - captured.size() * sizeof(RenderCommand);
+
+	// 失敗したときは受け取る列を書き換えない
+	const std::vector<RenderCommand> untouched(3);
+	auto isRejected = [&](const std::vector<char>& broken) {
+		WriteBytes(path, broken);
+		std::vector<RenderCommand> loaded = untouched;
+		return !RenderCommandLog::Load(path, loaded) && IsSameCommands(loaded, untouched);
+	};
+
+	//========================================
+	// 途中で切れている(コマンドの途中・コマンドの境目・ヘッダーの途中)
+	CHECK(isRejected(std::vector<char>(bytes.begin(), bytes.end() - 10)));
+	CHECK(isRejected(std::vector<char>(bytes.begin(), bytes.end() - sizeof(RenderCommand))));
+	CHECK(isRejected(std::vector<char>(bytes.begin(), bytes.begin() + headerSize - 1)));
+	CHECK(isRejected({}));
+
+	//========================================
+	// バージョン違い(マジックの直後の4バイト)
+	std::vector<char> wrongVersion = bytes;
+	wrongVersion[4] = static_cast<char>( wrongVersion[4] + 1 );
+	CHECK(isRejected(wrongVersion));
+
+	// 形式違い
+	std::vector<char> wrongMagic = bytes;
+	wrongMagic[0] = 'X';
+	CHECK(isRejected(wrongMagic));
+
+	// 知らない種類のコマンド
+	std::vector<char> wrongType = bytes;
+	const uint32_t invalidType = static_cast<uint32_t>( RenderCommandType::kCount );
+	std::memcpy(wrongType.data() + headerSize, &invalidType, sizeof(invalidType));
+	CHECK(isRejected(wrongType));
+
+	// ファイルがない
+	std::filesystem::remove(path);
+	std::vector<RenderCommand> loaded = untouched;
+	CHECK(!RenderCommandLog::Load(path, loaded));
+	CHECK(IsSameCommands(loaded, untouched));
+
+	//========================================
+	// 壊れていないものは読める(比較の土台が正しいことの確認)
+	CHECK(!isRejected(bytes));
+
+	std::filesystem::remove_all(path.parent_path());
+}
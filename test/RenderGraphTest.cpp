@@ -0,0 +1,319 @@
+/*********************************************************************
+ * \file   RenderGraphTest.cpp
+ * \brief  RenderGraph::Compileのテスト
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "RenderGraph.h"
+#include <algorithm>
+
+namespace {
+	using CompiledGraph = RenderGraph::CompiledGraph;
+	using TransitionBarrier = RenderGraph::TransitionBarrier;
+
+	/// \brief 実行順のパスの並び
+	std::vector<RenderGraph::PassHandle> GetOrder(const CompiledGraph& compiled) {
+		std::vector<RenderGraph::PassHandle> order;
+		for(const auto& pass : compiled.passes) {
+			order.push_back(pass.pass);
+		}
+		return order;
+	}
+
+	/// \brief 遷移バリアが一致するか
+	bool IsSameBarrier(const TransitionBarrier& barrier, RenderGraph::ResourceHandle resource, ResourceState before, ResourceState after) {
+		return barrier.resource == resource && barrier.before == before && barrier.after == after;
+	}
+
+	/// \brief 一時リソースの配置の取得
+	const RenderGraph::TransientPlacement* FindPlacement(const CompiledGraph& compiled, RenderGraph::ResourceHandle resource) {
+		for(const auto& placement : compiled.placements) {
+			if(placement.resource == resource) {
+				return &placement;
+			}
+		}
+		return nullptr;
+	}
+}
+
+///=============================================================================
+///						出力に繋がらないパスの除外
+TEST_CASE(RenderGraph_CullsPassesWithoutConsumers) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	auto used = graph.CreateTransientResource("Used", 256, 256);
+	auto unused = graph.CreateTransientResource("Unused", 256, 256);
+	auto orphan = graph.CreateTransientResource("Orphan", 256, 256);
+
+	auto producer = graph.AddPass("Producer");
+	graph.Write(producer, used, ResourceState::kRenderTarget);
+	// 誰も読まない一時リソースだけを書くパス
+	auto deadEnd = graph.AddPass("DeadEnd");
+	graph.Write(deadEnd, unused, ResourceState::kRenderTarget);
+	// 除外されるパスだけが読む一時リソースを書くパス(連鎖して除外される)
+	auto deadChain = graph.AddPass("DeadChain");
+	graph.Write(deadChain, orphan, ResourceState::kRenderTarget);
+	auto deadReader = graph.AddPass("DeadReader");
+	graph.Read(deadReader, orphan, ResourceState::kShaderResource);
+	graph.Write(deadReader, unused, ResourceState::kRenderTarget);
+	// 外部リソースへの書き込みは出力
+	auto composite = graph.AddPass("Composite");
+	graph.Read(composite, used, ResourceState::kShaderResource);
+	graph.Write(composite, backBuffer, ResourceState::kRenderTarget);
+	// 出力がなくても副作用があれば残す
+	auto sideEffect = graph.AddPass("SideEffect", true);
+
+	CompiledGraph compiled = graph.Compile();
+	CHECK(( GetOrder(compiled) == std::vector<RenderGraph::PassHandle>{ producer, composite, sideEffect } ));
+	CHECK(( compiled.culledPasses == std::vector<RenderGraph::PassHandle>{ deadEnd, deadChain, deadReader } ));
+	// 除外されたパスだけが使う一時リソースは配置しない
+	CHECK(FindPlacement(compiled, used) != nullptr);
+	CHECK(FindPlacement(compiled, unused) == nullptr);
+	CHECK(FindPlacement(compiled, orphan) == nullptr);
+}
+
+///=============================================================================
+///						書き込みの重ね合わせ
+TEST_CASE(RenderGraph_KeepsEarlierWritersOfUsedResource) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	auto color = graph.CreateTransientResource("Color", 256, 256);
+
+	// 後のパスが同じリソースに重ねて描くので、前のパスの書き込みも必要
+	auto clear = graph.AddPass("Clear");
+	graph.Write(clear, color, ResourceState::kRenderTarget);
+	auto draw = graph.AddPass("Draw");
+	graph.Write(draw, color, ResourceState::kRenderTarget);
+	auto composite = graph.AddPass("Composite");
+	graph.Read(composite, color, ResourceState::kShaderResource);
+	graph.Write(composite, backBuffer, ResourceState::kRenderTarget);
+
+	CompiledGraph compiled = graph.Compile();
+	CHECK(( GetOrder(compiled) == std::vector<RenderGraph::PassHandle>{ clear, draw, composite } ));
+	CHECK(compiled.culledPasses.empty());
+}
+
+///=============================================================================
+///						依存関係に沿った実行順
+TEST_CASE(RenderGraph_OrdersByDependencies) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	auto a = graph.CreateTransientResource("A", 256, 256);
+	auto b = graph.CreateTransientResource("B", 256, 256);
+	auto c = graph.CreateTransientResource("C", 256, 256);
+
+	// ひし形: Source -> (Left, Right) -> Merge
+	auto source = graph.AddPass("Source");
+	graph.Write(source, a, ResourceState::kRenderTarget);
+	auto left = graph.AddPass("Left");
+	graph.Read(left, a, ResourceState::kShaderResource);
+	graph.Write(left, b, ResourceState::kRenderTarget);
+	auto right = graph.AddPass("Right");
+	graph.Read(right, a, ResourceState::kShaderResource);
+	graph.Write(right, c, ResourceState::kRenderTarget);
+	// 読み取った後に書き戻すパスは、全ての読み手の後に並ぶ
+	auto overwrite = graph.AddPass("Overwrite");
+	graph.Write(overwrite, a, ResourceState::kRenderTarget);
+	auto merge = graph.AddPass("Merge");
+	graph.Read(merge, b, ResourceState::kShaderResource);
+	graph.Read(merge, c, ResourceState::kShaderResource);
+	graph.Read(merge, a, ResourceState::kShaderResource);
+	graph.Write(merge, backBuffer, ResourceState::kRenderTarget);
+
+	CompiledGraph compiled = graph.Compile();
+	auto order = GetOrder(compiled);
+	REQUIRE(order.size() == 5);
+	auto positionOf = [&](RenderGraph::PassHandle pass) {
+		return std::find(order.begin(), order.end(), pass) - order.begin();
+	};
+	CHECK(positionOf(source) < positionOf(left));
+	CHECK(positionOf(source) < positionOf(right));
+	CHECK(positionOf(left) < positionOf(overwrite));
+	CHECK(positionOf(right) < positionOf(overwrite));
+	CHECK(positionOf(overwrite) < positionOf(merge));
+	CHECK(positionOf(left) < positionOf(merge));
+	CHECK(positionOf(right) < positionOf(merge));
+	// 依存のないパス同士は宣言順
+	CHECK(positionOf(left) < positionOf(right));
+}
+
+///=============================================================================
+///						不要な遷移の省略
+TEST_CASE(RenderGraph_SkipsRedundantAndReadOnlyTransitions) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kRenderTarget, ResourceState::kRenderTarget);
+	auto texture = graph.ImportResource("Texture", ResourceState::kShaderResource, ResourceState::kShaderResource);
+
+	// 同じ状態での書き込みが続いても遷移しない
+	auto first = graph.AddPass("First");
+	graph.Read(first, texture, ResourceState::kShaderResource);
+	graph.Write(first, backBuffer, ResourceState::kRenderTarget);
+	auto second = graph.AddPass("Second");
+	graph.Read(second, texture, ResourceState::kShaderResource);
+	graph.Write(second, backBuffer, ResourceState::kRenderTarget);
+	// 足りない読み取り状態は合成する(読み取り状態の往復を避ける)
+	auto copy = graph.AddPass("Copy");
+	graph.Read(copy, texture, ResourceState::kCopySource);
+	graph.Write(copy, backBuffer, ResourceState::kRenderTarget);
+	// 合成した状態に含まれる読み取りは遷移しない
+	auto third = graph.AddPass("Third");
+	graph.Read(third, texture, ResourceState::kShaderResource);
+	graph.Read(third, texture, ResourceState::kCopySource);
+	graph.Write(third, backBuffer, ResourceState::kRenderTarget);
+
+	CompiledGraph compiled = graph.Compile();
+	REQUIRE(compiled.passes.size() == 4);
+	CHECK(compiled.passes[0].barriers.empty());
+	CHECK(compiled.passes[1].barriers.empty());
+	REQUIRE(compiled.passes[2].barriers.size() == 1);
+	CHECK(IsSameBarrier(compiled.passes[2].barriers[0], texture,
+		ResourceState::kShaderResource, ResourceState::kShaderResource | ResourceState::kCopySource));
+	CHECK(compiled.passes[3].barriers.empty());
+	// 最後は指定の状態へ戻す
+	REQUIRE(compiled.finalBarriers.size() == 1);
+	CHECK(IsSameBarrier(compiled.finalBarriers[0], texture,
+		ResourceState::kShaderResource | ResourceState::kCopySource, ResourceState::kShaderResource));
+}
+
+///=============================================================================
+///						書き込みと読み取りの切り替えと最後の遷移
+TEST_CASE(RenderGraph_PlacesTransitionsAndFinalBarriers) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	auto depth = graph.ImportResource("Depth", ResourceState::kDepthWrite, ResourceState::kDepthWrite);
+	auto shadow = graph.ImportResource("Shadow", ResourceState::kShaderResource, ResourceState::kShaderResource);
+
+	auto shadowPass = graph.AddPass("Shadow");
+	graph.Write(shadowPass, shadow, ResourceState::kDepthWrite);
+	auto scene = graph.AddPass("Scene");
+	graph.Read(scene, shadow, ResourceState::kShaderResource);
+	graph.Write(scene, depth, ResourceState::kDepthWrite);
+	graph.Write(scene, backBuffer, ResourceState::kRenderTarget);
+	// 同じパス内の深度の読み取りは書き込みにまとめる
+	graph.Read(scene, depth, ResourceState::kDepthRead);
+
+	CompiledGraph compiled = graph.Compile();
+	REQUIRE(compiled.passes.size() == 2);
+	REQUIRE(compiled.passes[0].barriers.size() == 1);
+	CHECK(IsSameBarrier(compiled.passes[0].barriers[0], shadow, ResourceState::kShaderResource, ResourceState::kDepthWrite));
+	REQUIRE(compiled.passes[1].barriers.size() == 2);
+	CHECK(IsSameBarrier(compiled.passes[1].barriers[0], shadow, ResourceState::kDepthWrite, ResourceState::kShaderResource));
+	CHECK(IsSameBarrier(compiled.passes[1].barriers[1], backBuffer, ResourceState::kPresent, ResourceState::kRenderTarget));
+	// 深度は最初から最後まで同じ状態、影は元の状態で終わるので戻すのは描画先だけ
+	REQUIRE(compiled.finalBarriers.size() == 1);
+	CHECK(IsSameBarrier(compiled.finalBarriers[0], backBuffer, ResourceState::kRenderTarget, ResourceState::kPresent));
+}
+
+///=============================================================================
+///						寿命の重ならない一時リソースのメモリ共有
+TEST_CASE(RenderGraph_AliasesOnlyNonOverlappingTransients) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	auto first = graph.CreateTransientResource("First", 1024, 256);
+	auto second = graph.CreateTransientResource("Second", 1024, 256);
+	auto middle = graph.CreateTransientResource("Middle", 300, 512);
+
+	// 寿命 First:[0,1]  Middle:[1,2]  Second:[2,3]
+	auto pass0 = graph.AddPass("Pass0");
+	graph.Write(pass0, first, ResourceState::kRenderTarget);
+	auto pass1 = graph.AddPass("Pass1");
+	graph.Read(pass1, first, ResourceState::kShaderResource);
+	graph.Write(pass1, middle, ResourceState::kRenderTarget);
+	auto pass2 = graph.AddPass("Pass2");
+	graph.Read(pass2, middle, ResourceState::kShaderResource);
+	graph.Write(pass2, second, ResourceState::kRenderTarget);
+	auto pass3 = graph.AddPass("Pass3");
+	graph.Read(pass3, second, ResourceState::kShaderResource);
+	graph.Write(pass3, backBuffer, ResourceState::kRenderTarget);
+
+	CompiledGraph compiled = graph.Compile();
+	REQUIRE(compiled.passes.size() == 4);
+	const auto* firstPlacement = FindPlacement(compiled, first);
+	const auto* secondPlacement = FindPlacement(compiled, second);
+	const auto* middlePlacement = FindPlacement(compiled, middle);
+	REQUIRE(firstPlacement && secondPlacement && middlePlacement);
+
+	//========================================
+	// 寿命の重ならない2つは同じ位置、重なるものは別の位置(アライメントに揃える)
+	CHECK(firstPlacement->heapOffset == 0);
+	CHECK(secondPlacement->heapOffset == 0);
+	CHECK(middlePlacement->heapOffset == 1024);
+	CHECK(middlePlacement->heapOffset % 512 == 0);
+	CHECK(compiled.transientHeapSize == 1324);
+
+	//========================================
+	// 共有するリソースを最初に使うパスの前でだけエイリアシングバリアを張る
+	CHECK(compiled.passes[0].aliasingBarriers.empty());
+	CHECK(compiled.passes[1].aliasingBarriers.empty());
+	REQUIRE(compiled.passes[2].aliasingBarriers.size() == 1);
+	CHECK(compiled.passes[2].aliasingBarriers[0].before == first);
+	CHECK(compiled.passes[2].aliasingBarriers[0].after == second);
+	CHECK(compiled.passes[3].aliasingBarriers.empty());
+
+	//========================================
+	// 一時リソースは前のフレームの最後の状態で待ち、最初に使うパスの先頭で遷移する
+	CHECK(firstPlacement->initialState == ResourceState::kShaderResource);
+	REQUIRE(!compiled.passes[0].barriers.empty());
+	CHECK(IsSameBarrier(compiled.passes[0].barriers[0], first, ResourceState::kShaderResource, ResourceState::kRenderTarget));
+	REQUIRE(!compiled.passes[2].barriers.empty());
+	CHECK(IsSameBarrier(compiled.passes[2].barriers[0], second, ResourceState::kShaderResource, ResourceState::kRenderTarget));
+	// 一時リソースは最後に戻さない
+	for(const auto& barrier : compiled.finalBarriers) {
+		CHECK(!graph.IsTransient(barrier.resource));
+	}
+}
+
+///=============================================================================
+///						寿命の重なる一時リソースはメモリを共有しない
+TEST_CASE(RenderGraph_DoesNotAliasOverlappingTransients) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	std::vector<RenderGraph::ResourceHandle> transients;
+	auto writer = graph.AddPass("Writer");
+	auto reader = graph.AddPass("Reader");
+	for(uint32_t i = 0; i < 4; ++i) {
+		transients.push_back(graph.CreateTransientResource("T" + std::to_string(i), 256 * ( i + 1 ), 256));
+		graph.Write(writer, transients.back(), ResourceState::kRenderTarget);
+		graph.Read(reader, transients.back(), ResourceState::kShaderResource);
+	}
+	graph.Write(reader, backBuffer, ResourceState::kRenderTarget);
+
+	CompiledGraph compiled = graph.Compile();
+	REQUIRE(compiled.placements.size() == transients.size());
+	for(size_t i = 0; i < compiled.placements.size(); ++i) {
+		const auto& a = compiled.placements[i];
+		uint64_t aEnd = a.heapOffset + 256 * ( a.resource - transients.front() + 1 );
+		CHECK(aEnd <= compiled.transientHeapSize);
+		for(size_t j = i + 1; j < compiled.placements.size(); ++j) {
+			const auto& b = compiled.placements[j];
+			uint64_t bEnd = b.heapOffset + 256 * ( b.resource - transients.front() + 1 );
+			CHECK(( aEnd <= b.heapOffset || bEnd <= a.heapOffset ));
+		}
+	}
+	CHECK(compiled.transientHeapSize == 256 * ( 1 + 2 + 3 + 4 ));
+	for(const auto& pass : compiled.passes) {
+		CHECK(pass.aliasingBarriers.empty());
+	}
+}
+
+///=============================================================================
+///						宣言の破棄
+TEST_CASE(RenderGraph_ClearRemovesDeclarations) {
+	RenderGraph graph;
+	auto backBuffer = graph.ImportResource("BackBuffer", ResourceState::kPresent, ResourceState::kPresent);
+	auto pass = graph.AddPass("Pass");
+	graph.Write(pass, backBuffer, ResourceState::kRenderTarget);
+	CHECK(graph.GetPassCount() == 1);
+	CHECK(graph.GetResourceCount() == 1);
+
+	graph.Clear();
+	CHECK(graph.GetPassCount() == 0);
+	CHECK(graph.GetResourceCount() == 0);
+	CompiledGraph compiled = graph.Compile();
+	CHECK(compiled.passes.empty());
+	CHECK(compiled.finalBarriers.empty());
+	CHECK(compiled.transientHeapSize == 0);
+}
@@ -0,0 +1,182 @@
+/*********************************************************************
+ * \file   RenderQueueTest.cpp
+ * \brief  描画キューのソートキーと基数ソートのテスト
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "RenderQueue.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+	/// \brief std::stable_sortでの結果
+	std::vector<RenderPacket> StableSort(std::vector<RenderPacket> packets) {
+		std::stable_sort(packets.begin(), packets.end(), [](const RenderPacket& a, const RenderPacket& b) { return a.key < b.key; });
+		return packets;
+	}
+
+	/// \brief 基数ソートの結果がstd::stable_sortと一致するか
+	bool IsSameAsStableSort(const std::vector<RenderPacket>& packets) {
+		std::vector<RenderPacket> sorted = packets;
+		std::vector<RenderPacket> scratch(packets.size());
+		const RenderPacket* result = RadixSortRenderPackets(sorted.data(), scratch.data(), sorted.size());
+		std::vector<RenderPacket> expected = StableSort(packets);
+		for(size_t i = 0; i < packets.size(); ++i) {
+			if(result[i].key != expected[i].key || result[i].index != expected[i].index) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// \brief キーから描画キューで並べ替えた添え字の並び
+	std::vector<uint32_t> SortIndices(const std::vector<uint64_t>& keys) {
+		RenderQueue queue;
+		for(uint32_t i = 0; i < keys.size(); ++i) {
+			queue.Push(keys[i], i);
+		}
+		queue.Sort();
+		std::vector<uint32_t> indices;
+		for(const RenderPacket& packet : queue.GetPackets()) {
+			indices.push_back(packet.index);
+		}
+		return indices;
+	}
+}
+
+///=============================================================================
+///						基数ソートはstd::stable_sortと同じ結果になる
+TEST_CASE(RenderQueue_RadixSortMatchesStableSort) {
+	std::mt19937_64 random(1234);
+	std::vector<RenderPacket> packets(20000);
+
+	//========================================
+	// 重複の多いキー(安定性が結果に出る)
+	for(uint32_t i = 0; i < packets.size(); ++i) {
+		packets[i] = { ( ( random() % 64 ) << 40 ) | ( random() % 4 ), i, 0 };
+	}
+	CHECK(IsSameAsStableSort(packets));
+
+	//========================================
+	// 全ビットがばらばらのキー
+	for(uint32_t i = 0; i < packets.size(); ++i) {
+		packets[i] = { random(), i, 0 };
+	}
+	CHECK(IsSameAsStableSort(packets));
+
+	//========================================
+	// 下位の桁だけが違うキー(上位の桁は飛ばす)
+	for(uint32_t i = 0; i < packets.size(); ++i) {
+		packets[i] = { 0xABCD000000000000ull | ( random() % 512 ), i, 0 };
+	}
+	CHECK(IsSameAsStableSort(packets));
+
+	//========================================
+	// 全部同じキー(全桁を飛ばして元の並びのまま)
+	for(uint32_t i = 0; i < packets.size(); ++i) {
+		packets[i] = { 0x0123456789ABCDEFull, i, 0 };
+	}
+	CHECK(IsSameAsStableSort(packets));
+
+	//========================================
+	// 少ない数
+	for(size_t count : { size_t(0), size_t(1), size_t(2), size_t(3) }) {
+		std::vector<RenderPacket> fewPackets(packets.begin(), packets.begin() + count);
+		for(uint32_t i = 0; i < fewPackets.size(); ++i) {
+			fewPackets[i].key = random() % 2;
+		}
+		CHECK(IsSameAsStableSort(fewPackets));
+	}
+}
+
+///=============================================================================
+///						同じキーは追加順のまま
+TEST_CASE(RenderQueue_SortIsStable) {
+	std::vector<uint64_t> keys = { 5, 3, 5, 1, 3, 5, 1 };
+	CHECK(( SortIndices(keys) == std::vector<uint32_t>{ 3, 6, 1, 4, 0, 2, 5 } ));
+}
+
+///=============================================================================
+///						不透明は手前から奥へ
+TEST_CASE(RenderQueue_OpaqueSortsFrontToBack) {
+	const float kFarClip = 100.0f;
+	std::vector<float> depths = { 40.0f, 2.0f, 99.0f, 0.5f, 13.0f, 70.0f };
+	std::vector<uint64_t> keys;
+	for(float depth : depths) {
+		RenderSortKeyDesc desc;
+		desc.pass = RenderQueuePass::kOpaque;
+		desc.pipeline = 1;
+		desc.material = 2;
+		desc.texture = 3;
+		desc.depth = RenderSortKey::QuantizeDepth(depth, kFarClip);
+		keys.push_back(RenderSortKey::Make(desc));
+	}
+	CHECK(( SortIndices(keys) == std::vector<uint32_t>{ 3, 1, 4, 0, 5, 2 } ));
+}
+
+///=============================================================================
+///						不透明はステートでまとめてから深度順
+TEST_CASE(RenderQueue_OpaqueGroupsByStateBeforeDepth) {
+	std::vector<uint64_t> keys;
+	auto push = [&](uint32_t pipeline, uint32_t material, float depth) {
+		RenderSortKeyDesc desc;
+		desc.pipeline = pipeline;
+		desc.material = material;
+		desc.depth = RenderSortKey::QuantizeDepth(depth, 100.0f);
+		keys.push_back(RenderSortKey::Make(desc));
+	};
+	push(1, 0, 1.0f);
+	push(0, 1, 50.0f);
+	push(0, 0, 90.0f);
+	push(0, 1, 10.0f);
+	push(1, 0, 0.5f);
+	CHECK(( SortIndices(keys) == std::vector<uint32_t>{ 2, 3, 1, 4, 0 } ));
+	// 深度を除いた部分が同じなら1つの描画にまとめられる
+	CHECK(( keys[1] >> RenderSortKey::kStateShift ) == ( keys[3] >> RenderSortKey::kStateShift ));
+	CHECK(( keys[0] >> RenderSortKey::kStateShift ) != ( keys[2] >> RenderSortKey::kStateShift ));
+}
+
+///=============================================================================
+///						半透明とパーティクルは奥から手前へ、不透明の後
+TEST_CASE(RenderQueue_TransparentSortsBackToFront) {
+	const float kFarClip = 100.0f;
+	std::vector<uint64_t> keys;
+	auto push = [&](RenderQueuePass pass, uint32_t pipeline, float depth) {
+		RenderSortKeyDesc desc;
+		desc.pass = pass;
+		desc.pipeline = pipeline;
+		desc.depth = RenderSortKey::QuantizeDepth(depth, kFarClip);
+		keys.push_back(RenderSortKey::Make(desc));
+	};
+	push(RenderQueuePass::kTransparent, 0, 10.0f);		// 0
+	push(RenderQueuePass::kParticle, 0, 80.0f);			// 1
+	push(RenderQueuePass::kTransparent, 3, 60.0f);		// 2
+	push(RenderQueuePass::kOpaque, 0, 90.0f);			// 3
+	push(RenderQueuePass::kTransparent, 1, 30.0f);		// 4
+	push(RenderQueuePass::kParticle, 0, 5.0f);			// 5
+	push(RenderQueuePass::kOpaque, 0, 1.0f);			// 6
+	// 半透明はステートより深度を優先する
+	CHECK(( SortIndices(keys) == std::vector<uint32_t>{ 6, 3, 2, 4, 0, 1, 5 } ));
+}
+
+///=============================================================================
+///						深度の量子化
+TEST_CASE(RenderQueue_QuantizeDepthIsMonotonicAndClamped) {
+	const float kFarClip = 50.0f;
+	constexpr uint32_t kMaxDepth = ( 1u << RenderSortKey::kDepthBits ) - 1;
+	CHECK(RenderSortKey::QuantizeDepth(-1.0f, kFarClip) == 0);
+	CHECK(RenderSortKey::QuantizeDepth(0.0f, kFarClip) == 0);
+	CHECK(RenderSortKey::QuantizeDepth(kFarClip, kFarClip) == kMaxDepth);
+	CHECK(RenderSortKey::QuantizeDepth(kFarClip * 4.0f, kFarClip) == kMaxDepth);
+	CHECK(RenderSortKey::QuantizeDepth(1.0f, 0.0f) == 0);
+	uint32_t previous = 0;
+	for(float depth = 0.01f; depth < kFarClip; depth *= 1.1f) {
+		uint32_t quantized = RenderSortKey::QuantizeDepth(depth, kFarClip);
+		CHECK(quantized >= previous);
+		CHECK(quantized <= kMaxDepth);
+		previous = quantized;
+	}
+}
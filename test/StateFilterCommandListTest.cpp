@@ -0,0 +1,218 @@
+/*********************************************************************
+ * \file   StateFilterCommandListTest.cpp
+ * \brief  StateFilterCommandListのテスト(NullCommandListに届くコマンドを確かめる)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "StateFilterCommandList.h"
+#include "NullCommandList.h"
+
+namespace {
+	/// \brief 記録値として使うだけの偽のポインタ
+	template<class T>
+	T* FakePointer(uintptr_t value) {
+		return reinterpret_cast<T*>( value );
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  FilterFixture NullCommandListの前にフィルタを置いたもの
+	 */
+	struct FilterFixture {
+		NullCommandList target;
+		StateFilterCommandList filter;
+
+		FilterFixture() { filter.SetTarget(&target); }
+
+		/// \brief 呼び出しが発行先まで届いたか
+		template<class Function>
+		bool Reaches(Function function) {
+			size_t count = target.GetCommands().size();
+			function(filter);
+			return target.GetCommands().size() > count;
+		}
+	};
+}
+
+///=============================================================================
+///						同じ値の再設定は落とし、違う値は流す
+TEST_CASE(StateFilterCommandList_DropsRedundantSets) {
+	FilterFixture fixture;
+	ID3D12DescriptorHeap* heap = FakePointer<ID3D12DescriptorHeap>(0x10);
+	VertexBufferView vertexBuffer = { 0x1000, 256, 32 };
+	IndexBufferView indexBuffer = { 0x2000, 128, IndexFormat::kUint16 };
+	auto setAll = [&](StateFilterCommandList& filter) {
+		filter.SetDescriptorHeaps(1, &heap);
+		filter.SetGraphicsRootSignature(FakePointer<ID3D12RootSignature>(0x20));
+		filter.SetPipelineState(FakePointer<ID3D12PipelineState>(0x30));
+		filter.IASetPrimitiveTopology(PrimitiveTopology::kTriangleList);
+		filter.IASetVertexBuffers(0, 1, &vertexBuffer);
+		filter.IASetIndexBuffer(indexBuffer);
+		filter.SetGraphicsRootConstantBufferView(0, 0x100);
+		filter.SetGraphicsRootShaderResourceView(1, 0x200);
+		filter.SetGraphicsRootDescriptorTable(2, 0x300);
+	};
+
+	//========================================
+	// 1回目はすべて流れ、2回目はすべて落ちる
+	setAll(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == 9);
+	setAll(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == 9);
+	CHECK(fixture.filter.GetStateSetCount() == 18);
+	CHECK(fixture.filter.GetSkippedCount() == 9);
+
+	//========================================
+	// 描画とバリアは状態ではないので毎回流れる
+	CHECK(fixture.Reaches([](StateFilterCommandList& filter) { filter.DrawInstanced(3, 1, 0, 0); }));
+	CHECK(fixture.Reaches([](StateFilterCommandList& filter) { filter.DrawInstanced(3, 1, 0, 0); }));
+	ResourceBarrierDesc barrier;
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.ResourceBarriers(1, &barrier); }));
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.ResourceBarriers(1, &barrier); }));
+	CHECK(fixture.filter.GetStateSetCount() == 18);
+
+	//========================================
+	// 値が1つでも違えば流れる
+	VertexBufferView otherStride = vertexBuffer;
+	otherStride.strideInBytes = 16;
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(0, 1, &otherStride); }));
+	IndexBufferView otherFormat = indexBuffer;
+	otherFormat.format = IndexFormat::kUint32;
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetIndexBuffer(otherFormat); }));
+	CHECK(fixture.Reaches([](StateFilterCommandList& filter) { filter.SetGraphicsRootConstantBufferView(0, 0x101); }));
+
+	//========================================
+	// Invalidateの後はすべて流れる
+	fixture.filter.Invalidate();
+	fixture.filter.ResetCounts();
+	size_t count = fixture.target.GetCommands().size();
+	setAll(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == count + 9);
+	CHECK(fixture.filter.GetSkippedCount() == 0);
+}
+
+///=============================================================================
+///						ルートシグネチャが変わるとルート引数を忘れる
+TEST_CASE(StateFilterCommandList_RootSignatureChangeDropsRootArguments) {
+	FilterFixture fixture;
+	ID3D12RootSignature* rootSignatureA = FakePointer<ID3D12RootSignature>(0x20);
+	ID3D12RootSignature* rootSignatureB = FakePointer<ID3D12RootSignature>(0x28);
+	VertexBufferView vertexBuffer = { 0x1000, 256, 32 };
+	fixture.filter.SetGraphicsRootSignature(rootSignatureA);
+	fixture.filter.SetPipelineState(FakePointer<ID3D12PipelineState>(0x30));
+	fixture.filter.IASetVertexBuffers(0, 1, &vertexBuffer);
+	auto setRootArguments = [](StateFilterCommandList& filter) {
+		filter.SetGraphicsRootConstantBufferView(0, 0x100);
+		filter.SetGraphicsRootShaderResourceView(1, 0x200);
+		filter.SetGraphicsRootDescriptorTable(2, 0x300);
+	};
+	setRootArguments(fixture.filter);
+
+	//========================================
+	// 同じルートシグネチャの再設定では忘れない
+	CHECK(!fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetGraphicsRootSignature(rootSignatureA); }));
+	size_t count = fixture.target.GetCommands().size();
+	setRootArguments(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == count);
+
+	//========================================
+	// 別のルートシグネチャにすると同じ値でも3つとも届く
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetGraphicsRootSignature(rootSignatureB); }));
+	count = fixture.target.GetCommands().size();
+	setRootArguments(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == count + 3);
+	// 届いた後はまた覚えている
+	setRootArguments(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == count + 3);
+
+	//========================================
+	// ルート引数以外(PSO・頂点バッファ)は覚えたまま
+	CHECK(!fixture.Reaches([](StateFilterCommandList& filter) { filter.SetPipelineState(FakePointer<ID3D12PipelineState>(0x30)); }));
+	CHECK(!fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(0, 1, &vertexBuffer); }));
+}
+
+///=============================================================================
+///						ディスクリプタヒープが変わるとルート引数を忘れる
+TEST_CASE(StateFilterCommandList_DescriptorHeapChangeDropsRootArguments) {
+	FilterFixture fixture;
+	ID3D12DescriptorHeap* heapsA[2] = { FakePointer<ID3D12DescriptorHeap>(0x10), FakePointer<ID3D12DescriptorHeap>(0x18) };
+	ID3D12DescriptorHeap* heapsB[2] = { FakePointer<ID3D12DescriptorHeap>(0x10), FakePointer<ID3D12DescriptorHeap>(0x1C) };
+	fixture.filter.SetGraphicsRootSignature(FakePointer<ID3D12RootSignature>(0x20));
+	fixture.filter.SetDescriptorHeaps(2, heapsA);
+	auto setTables = [](StateFilterCommandList& filter) {
+		filter.SetGraphicsRootDescriptorTable(2, 0x300);
+		filter.SetGraphicsRootDescriptorTable(3, 0x400);
+		filter.SetGraphicsRootConstantBufferView(0, 0x100);
+	};
+	setTables(fixture.filter);
+
+	//========================================
+	// 同じヒープの再設定は落ちて、テーブルも覚えたまま
+	CHECK(!fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetDescriptorHeaps(2, heapsA); }));
+	size_t count = fixture.target.GetCommands().size();
+	setTables(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == count);
+
+	//========================================
+	// 2つめだけ違うヒープ、ヒープ数だけ違う場合も変化として扱う
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetDescriptorHeaps(2, heapsB); }));
+	count = fixture.target.GetCommands().size();
+	setTables(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == count + 3);
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetDescriptorHeaps(1, heapsB); }));
+	count = fixture.target.GetCommands().size();
+	setTables(fixture.filter);
+	CHECK(fixture.target.GetCommands().size() == count + 3);
+
+	//========================================
+	// 覚えられる数を超えるヒープは毎回流れる
+	ID3D12DescriptorHeap* manyHeaps[StateFilterCommandList::kMaxDescriptorHeaps + 1] = {};
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetDescriptorHeaps(StateFilterCommandList::kMaxDescriptorHeaps + 1, manyHeaps); }));
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetDescriptorHeaps(StateFilterCommandList::kMaxDescriptorHeaps + 1, manyHeaps); }));
+}
+
+///=============================================================================
+///						覚えられる範囲の外のスロットは常に流れる
+TEST_CASE(StateFilterCommandList_UntrackedSlotsPassThrough) {
+	FilterFixture fixture;
+	const uint32_t kRootIndex = StateFilterCommandList::kMaxRootParameters;
+	const uint32_t kSlot = StateFilterCommandList::kMaxVertexBuffers;
+
+	//========================================
+	// ルートパラメータ(範囲の直後と、さらに先)
+	for(uint32_t index : { kRootIndex, kRootIndex + 15 }) {
+		for(int repeat = 0; repeat < 2; ++repeat) {
+			CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetGraphicsRootConstantBufferView(index, 0x100); }));
+			CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetGraphicsRootShaderResourceView(index, 0x200); }));
+			CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.SetGraphicsRootDescriptorTable(index, 0x300); }));
+		}
+	}
+	// 範囲の最後は覚える
+	CHECK(fixture.Reaches([](StateFilterCommandList& filter) { filter.SetGraphicsRootConstantBufferView(StateFilterCommandList::kMaxRootParameters - 1, 0x100); }));
+	CHECK(!fixture.Reaches([](StateFilterCommandList& filter) { filter.SetGraphicsRootConstantBufferView(StateFilterCommandList::kMaxRootParameters - 1, 0x100); }));
+
+	//========================================
+	// 頂点バッファ
+	VertexBufferView views[2] = { { 0x1000, 256, 32 }, { 0x2000, 256, 32 } };
+	for(int repeat = 0; repeat < 2; ++repeat) {
+		CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(kSlot, 1, views); }));
+		// 範囲をまたぐ設定
+		CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(kSlot - 1, 2, views); }));
+	}
+	// 届いた発行先では範囲をまたぐ設定も全スロット分そろっている
+	const RenderCommand& last = fixture.target.GetCommands().back();
+	CHECK(last.type == RenderCommandType::kIASetVertexBuffer);
+	CHECK(last.index == kSlot);
+	CHECK(last.value == views[1].bufferLocation);
+
+	//========================================
+	// またいだ設定で変わった範囲内のスロットは新しい値として覚える
+	VertexBufferView previous = { 0x3000, 256, 32 };
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(kSlot - 1, 1, &previous); }));
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(kSlot - 1, 2, views); }));
+	// 発行先では前の値に戻すので落としてはいけない
+	CHECK(fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(kSlot - 1, 1, &previous); }));
+	CHECK(!fixture.Reaches([&](StateFilterCommandList& filter) { filter.IASetVertexBuffers(kSlot - 1, 1, &previous); }));
+}
@@ -0,0 +1,89 @@
+/*********************************************************************
+ * \file   TestFramework.h
+ * \brief  ウィンドウとGPUを使わないエンジンのテスト
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   TEST_CASEで登録した関数をTestMainで順に実行する。
+ *         CHECKが失敗してもそのテストの残りは続け、失敗数を終了コードで返す。
+ *         DEATH_TESTは自分自身を子プロセスで起動し、assertで止まることを確かめる
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///=============================================================================
+///						テスト
+namespace EngineTest {
+
+	/**----------------------------------------------------------------------------
+	 * \brief  TestCase 登録されたテスト
+	 */
+	struct TestCase {
+		const char* name;
+		void (*function)();
+		bool isDeathTest;	// assertで止まれば成功
+	};
+
+	/// \brief 登録されたテストの取得
+	std::vector<TestCase>& GetTestCases();
+
+	/// \brief 判定の失敗を記録する
+	void ReportFailure(const char* file, int line, const std::string& message);
+
+	/**----------------------------------------------------------------------------
+	 * \brief  Registrar 静的初期化でテストを登録する
+	 */
+	struct Registrar {
+		Registrar(const char* name, void (*function)(), bool isDeathTest = false) {
+			GetTestCases().push_back({ name, function, isDeathTest });
+		}
+	};
+}
+
+///=============================================================================
+///						登録と判定
+// テストの登録(名前は実行ファイル全体で一意にする)
+#define TEST_CASE(name) \
+	static void name(); \
+	static const EngineTest::Registrar name##Registrar_(#name, &name); \
+	static void name()
+
+// assertで止まることのテスト(本体は子プロセスで実行する。NDEBUGではassertがないので飛ばす)
+#define DEATH_TEST(name) \
+	static void name(); \
+	static const EngineTest::Registrar name##Registrar_(#name, &name, true); \
+	static void name()
+
+// 条件の判定(失敗しても続ける)
+#define CHECK(expression) \
+	do { \
+		if(!( expression )) { \
+			EngineTest::ReportFailure(__FILE__, __LINE__, #expression); \
+		} \
+	} while(false)
+
+// 条件の判定(失敗したらそのテストを打ち切る)
+#define REQUIRE(expression) \
+	do { \
+		if(!( expression )) { \
+			EngineTest::ReportFailure(__FILE__, __LINE__, #expression); \
+			return; \
+		} \
+	} while(false)
+
+// 例外が送出されることの判定
+#define CHECK_THROWS_AS(expression, exceptionType) \
+	do { \
+		bool isThrown = false; \
+		try { \
+			expression; \
+		} catch(const exceptionType&) { \
+			isThrown = true; \
+		} catch(...) { \
+		} \
+		if(!isThrown) { \
+			EngineTest::ReportFailure(__FILE__, __LINE__, #expression " does not throw " #exceptionType); \
+		} \
+	} while(false)
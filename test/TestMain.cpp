@@ -0,0 +1,124 @@
+/*********************************************************************
+ * \file   TestMain.cpp
+ * \brief  登録されたテストを実行する
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note   引数を渡すと名前にその文字列を含むテストだけを実行する。
+ *         「--death 名前」はDEATH_TESTの子プロセス用
+ *********************************************************************/
+#include "TestFramework.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#ifdef _MSC_VER
+#include <crtdbg.h>
+#endif
+
+namespace {
+	// 実行中のテストの失敗数
+	uint32_t currentFailureCount = 0;
+
+	/**----------------------------------------------------------------------------
+	 * \brief  RunDeathTestChild DEATH_TESTの本体を実行する(子プロセス)
+	 * \return assertで止まらずに戻ってきたら0(親はこれを失敗として扱う)
+	 */
+	int RunDeathTestChild(const char* name) {
+#ifdef _MSC_VER
+		//assertと中断でダイアログを出さず、標準エラーに書いて終わる
+		_set_error_mode(_OUT_TO_STDERR);
+		_set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+		_CrtSetReportMode(_CRT_ASSERT, _CRTDBG_MODE_FILE);
+		_CrtSetReportFile(_CRT_ASSERT, _CRTDBG_FILE_STDERR);
+#endif
+		for(const EngineTest::TestCase& testCase : EngineTest::GetTestCases()) {
+			if(testCase.isDeathTest && std::strcmp(testCase.name, name) == 0) {
+				//例外で終わった場合もassertではないので失敗にする
+				try {
+					testCase.function();
+				} catch(...) {
+				}
+				return 0;
+			}
+		}
+		std::printf("  death test %s not found\n", name);
+		return 0;
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  RunDeathTest DEATH_TESTを子プロセスで実行する
+	 * \param  executablePath この実行ファイルのパス
+	 * \note   子プロセスが0以外で終われば(assertで止まれば)成功
+	 */
+	void RunDeathTest(const char* executablePath, const EngineTest::TestCase& testCase) {
+#ifdef NDEBUG
+		(void)executablePath;
+		std::printf("  %s skipped (assert is disabled)\n", testCase.name);
+#else
+		std::string command = std::string("\"") + executablePath + "\" --death " + testCase.name;
+#ifdef _WIN32
+		//cmd /cは先頭と末尾の引用符を外すので、全体をもう一度囲む
+		command = "\"" + command + "\"";
+#endif
+		std::fflush(stdout);
+		if(std::system(command.c_str()) == 0) {
+			EngineTest::ReportFailure(__FILE__, __LINE__, std::string(testCase.name) + " did not stop on an assertion");
+		}
+#endif
+	}
+}
+
+///=============================================================================
+///						登録されたテストの取得
+std::vector<EngineTest::TestCase>& EngineTest::GetTestCases() {
+	// 静的初期化の順番に依存しないよう関数内で持つ
+	static std::vector<TestCase> testCases;
+	return testCases;
+}
+
+///=============================================================================
+///						失敗の記録
+void EngineTest::ReportFailure(const char* file, int line, const std::string& message) {
+	std::printf("  %s(%d): %s\n", file, line, message.c_str());
+	++currentFailureCount;
+}
+
+///=============================================================================
+///						エントリーポイント
+int main(int argc, char* argv[]) {
+	if(argc > 2 && std::strcmp(argv[1], "--death") == 0) {
+		return RunDeathTestChild(argv[2]);
+	}
+	const std::string filter = argc > 1 ? argv[1] : "";
+	uint32_t runCount = 0;
+	uint32_t failedCount = 0;
+	for(const EngineTest::TestCase& testCase : EngineTest::GetTestCases()) {
+		if(!filter.empty() && std::string(testCase.name).find(filter) == std::string::npos) {
+			continue;
+		}
+		//========================================
+		// 実行(例外が漏れたら失敗として扱う)
+		currentFailureCount = 0;
+		try {
+			if(testCase.isDeathTest) {
+				RunDeathTest(argv[0], testCase);
+			} else {
+				testCase.function();
+			}
+		} catch(const std::exception& exception) {
+			EngineTest::ReportFailure(__FILE__, __LINE__, std::string("unexpected exception: ") + exception.what());
+		} catch(...) {
+			EngineTest::ReportFailure(__FILE__, __LINE__, "unexpected exception");
+		}
+		++runCount;
+		if(currentFailureCount != 0) {
+			++failedCount;
+			std::printf("[FAILED] %s\n", testCase.name);
+		} else {
+			std::printf("[    OK] %s\n", testCase.name);
+		}
+	}
+	std::printf("%u / %u tests passed\n", runCount - failedCount, runCount);
+	return failedCount == 0 ? 0 : 1;
+}
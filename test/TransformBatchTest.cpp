@@ -0,0 +1,108 @@
+/*********************************************************************
+ * \file   TransformBatchTest.cpp
+ * \brief  TransformBatchのテスト(1つずつ求めた行列との比較)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "TransformBatch.h"
+#include "AffineTransformations.h"
+#include "MathFunc4x4.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+	/// \brief 行列が誤差の範囲で一致するか(SinCosの近似の分だけずれる)
+	bool IsNear(const Matrix4x4& actual, const Matrix4x4& expected) {
+		for(int row = 0; row < 4; ++row) {
+			for(int column = 0; column < 4; ++column) {
+				float tolerance = 1.0e-4f * ( 1.0f + std::fabs(expected.m[row][column]) );
+				if(!( std::fabs(actual.m[row][column] - expected.m[row][column]) <= tolerance )) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/// \brief ばらばらなTransform
+	std::vector<Transform> MakeTransforms(size_t count) {
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+		std::uniform_real_distribution<float> angle(-3.14159265f, 3.14159265f);
+		std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+		std::vector<Transform> transforms(count);
+		for(Transform& transform : transforms) {
+			transform.scale = { scale(random), scale(random), scale(random) };
+			transform.rotate = { angle(random), angle(random), angle(random) };
+			transform.translate = { position(random), position(random), position(random) };
+		}
+		return transforms;
+	}
+
+	/// \brief 書き込んだ行列がMakeAffineMatrixから求めたものと一致するか
+	bool MatchesScalar(const std::vector<Transform>& transforms, const Matrix4x4& billboard,
+		const Matrix4x4& viewProjection, uint32_t threadCount) {
+		const Vector4 kColor = { 0.25f, 0.5f, 0.75f, 1.0f };
+		// 1つ余分に用意して、範囲外に書き込まないことも確認する
+		std::vector<ParticleForGPU> output(transforms.size() + 1);
+		for(ParticleForGPU& particle : output) {
+			particle.color = kColor;
+		}
+		ParticleForGPU sentinel = output.back();
+		TransformBatch::WriteParticleMatrices(transforms, billboard, viewProjection, output, threadCount);
+		for(size_t i = 0; i < transforms.size(); ++i) {
+			const Transform& transform = transforms[i];
+			Matrix4x4 world = Multiply4x4(billboard, MakeAffineMatrix(transform.scale, transform.rotate, transform.translate));
+			if(!IsNear(output[i].World, world) || !IsNear(output[i].WVP, Multiply4x4(world, viewProjection))) {
+				return false;
+			}
+			// colorは書き換えない
+			if(output[i].color.x != kColor.x || output[i].color.w != kColor.w) {
+				return false;
+			}
+		}
+		return IsNear(output.back().World, sentinel.World) && IsNear(output.back().WVP, sentinel.WVP);
+	}
+
+	/// \brief ビルボードの代わりに使う回転と平行移動
+	Matrix4x4 MakeBillboard() {
+		return MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, { 0.3f, -1.2f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+	}
+
+	/// \brief ビュープロジェクションの代わりに使う行列
+	Matrix4x4 MakeViewProjection() {
+		Matrix4x4 matrix = MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, { 0.1f, 0.2f, 0.0f }, { 1.0f, -2.0f, 15.0f });
+		matrix.m[2][3] = 1.0f;
+		matrix.m[3][3] = 0.0f;
+		return matrix;
+	}
+}
+
+///=============================================================================
+///						4の倍数でない数も1つずつ求めたものと一致する
+TEST_CASE(TransformBatch_MatchesScalarForAnyCount) {
+	const Matrix4x4 billboard = MakeBillboard();
+	const Matrix4x4 viewProjection = MakeViewProjection();
+	for(size_t count : { size_t(0), size_t(1), size_t(3), size_t(4), size_t(5), size_t(8), size_t(31) }) {
+		CHECK(MatchesScalar(MakeTransforms(count), billboard, viewProjection, 1));
+	}
+	// ビルボードを使わない場合
+	CHECK(MatchesScalar(MakeTransforms(13), Identity4x4(), viewProjection, 1));
+}
+
+///=============================================================================
+///						複数スレッドでも同じ結果になる
+TEST_CASE(TransformBatch_MatchesScalarOnThreads) {
+	const Matrix4x4 billboard = MakeBillboard();
+	const Matrix4x4 viewProjection = MakeViewProjection();
+	// スレッドごとの区間と端数の両方が出る数
+	const size_t kCount = TransformBatch::kMinCountPerThread * 3 + 7;
+	std::vector<Transform> transforms = MakeTransforms(kCount);
+	for(uint32_t threadCount : { 0u, 2u, 3u, 8u }) {
+		CHECK(MatchesScalar(transforms, billboard, viewProjection, threadCount));
+	}
+}
@@ -0,0 +1,319 @@
+/*********************************************************************
+ * \file   TransformHierarchyTest.cpp
+ * \brief  TransformHierarchyのテスト(親をたどって求めた行列との比較)
+ *
+ * \author Harukichimaru
+ * \date   October 2026
+ * \note
+ *********************************************************************/
+#include "TestFramework.h"
+#include "TransformHierarchy.h"
+#include "AffineTransformations.h"
+#include "MathFunc4x4.h"
+#include <random>
+#include <vector>
+
+namespace {
+	constexpr uint32_t kRoot = TransformHierarchy::kInvalidHandle;
+
+	/// \brief 番号ごとに違うTransform
+	Transform MakeTransform(float seed) {
+		Transform transform;
+		transform.scale = { 1.0f + 0.1f * seed, 1.0f, 1.0f - 0.05f * seed };
+		transform.rotate = { 0.1f * seed, -0.2f * seed, 0.3f };
+		transform.translate = { seed, 2.0f * seed, -seed };
+		return transform;
+	}
+
+	/**----------------------------------------------------------------------------
+	 * \brief  ExpectedWorld 親を1つずつたどって求めたワールド行列
+	 * \note   TransformHierarchyと同じ式なので一致は完全一致で確かめる
+	 */
+	Matrix4x4 ExpectedWorld(const TransformHierarchy& hierarchy, uint32_t handle) {
+		const Transform& local = hierarchy.GetLocalTransform(handle);
+		Matrix4x4 localMatrix = MakeAffineMatrix(local.scale, local.rotate, local.translate);
+		uint32_t parent = hierarchy.GetParent(handle);
+		return parent == kRoot ? localMatrix : Multiply4x4(localMatrix, ExpectedWorld(hierarchy, parent));
+	}
+
+	/// \brief 生きているノードのワールド行列がすべて親をたどったものと一致するか
+	bool MatchesExpected(const TransformHierarchy& hierarchy, const std::vector<uint32_t>& handles) {
+		for(uint32_t handle : handles) {
+			if(!( hierarchy.GetWorldMatrix(handle) == ExpectedWorld(hierarchy, handle) )) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// \brief ancestorがhandle自身か祖先か
+	bool IsInSubtree(const TransformHierarchy& hierarchy, uint32_t handle, uint32_t ancestor) {
+		for(uint32_t node = handle; node != kRoot; node = hierarchy.GetParent(node)) {
+			if(node == ancestor) {
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+///=============================================================================
+///						親を付け替えても親が先に求まる
+TEST_CASE(TransformHierarchy_ReparentKeepsParentsBeforeChildren) {
+	TransformHierarchy hierarchy;
+	//========================================
+	// 子になるノードを先に作る(並びでは後から作る親より前にある)
+	uint32_t child = hierarchy.Create(MakeTransform(1.0f));
+	uint32_t grandChild = hierarchy.Create(MakeTransform(2.0f), child);
+	uint32_t parent = hierarchy.Create(MakeTransform(3.0f));
+	uint32_t grandParent = hierarchy.Create(MakeTransform(4.0f));
+	std::vector<uint32_t> handles = { child, grandChild, parent, grandParent };
+	hierarchy.UpdateWorldMatrices();
+	CHECK(MatchesExpected(hierarchy, handles));
+
+	//========================================
+	// 後ろにあるノードの下へ部分木ごと移す
+	hierarchy.SetParent(child, parent);
+	hierarchy.SetParent(parent, grandParent);
+	CHECK(hierarchy.GetParent(child) == parent);
+	hierarchy.UpdateWorldMatrices();
+	CHECK(MatchesExpected(hierarchy, handles));
+
+	//========================================
+	// 親だけを動かしても子孫まで反映される
+	hierarchy.SetLocalTransform(grandParent, MakeTransform(5.0f));
+	hierarchy.UpdateWorldMatrices();
+	CHECK(MatchesExpected(hierarchy, handles));
+	Matrix4x4 expected = Identity4x4();
+	for(float seed : { 5.0f, 3.0f, 1.0f, 2.0f }) {
+		Transform transform = MakeTransform(seed);
+		expected = seed == 5.0f ? MakeAffineMatrix(transform.scale, transform.rotate, transform.translate)
+			: Multiply4x4(MakeAffineMatrix(transform.scale, transform.rotate, transform.translate), expected);
+	}
+	CHECK(hierarchy.GetWorldMatrix(grandChild) == expected);
+
+	//========================================
+	// ルートに戻す
+	hierarchy.SetParent(child, kRoot);
+	hierarchy.UpdateWorldMatrices();
+	CHECK(hierarchy.GetParent(child) == kRoot);
+	CHECK(MatchesExpected(hierarchy, handles));
+}
+
+///=============================================================================
+///						親を消すと子は祖父母につなぎ替わる
+TEST_CASE(TransformHierarchy_DestroyReattachesChildrenToGrandparent) {
+	TransformHierarchy hierarchy;
+	uint32_t root = hierarchy.Create(MakeTransform(1.0f));
+	uint32_t middle = hierarchy.Create(MakeTransform(2.0f), root);
+	uint32_t leafA = hierarchy.Create(MakeTransform(3.0f), middle);
+	uint32_t leafB = hierarchy.Create(MakeTransform(4.0f), middle);
+	uint32_t grandLeaf = hierarchy.Create(MakeTransform(5.0f), leafA);
+	hierarchy.UpdateWorldMatrices();
+
+	//========================================
+	// 間のノードを消す
+	hierarchy.Destroy(middle);
+	CHECK(hierarchy.GetParent(leafA) == root);
+	CHECK(hierarchy.GetParent(leafB) == root);
+	CHECK(hierarchy.GetParent(grandLeaf) == leafA);
+	CHECK(hierarchy.GetSize() == 4);
+	hierarchy.UpdateWorldMatrices();
+	std::vector<uint32_t> handles = { root, leafA, leafB, grandLeaf };
+	CHECK(MatchesExpected(hierarchy, handles));
+
+	//========================================
+	// ルートを消すと子はルートになる
+	hierarchy.Destroy(root);
+	CHECK(hierarchy.GetParent(leafA) == kRoot);
+	CHECK(hierarchy.GetParent(leafB) == kRoot);
+	hierarchy.UpdateWorldMatrices();
+	handles = { leafA, leafB, grandLeaf };
+	CHECK(MatchesExpected(hierarchy, handles));
+	CHECK(hierarchy.GetWorldMatrix(leafA) == MakeAffineMatrix(MakeTransform(3.0f).scale, MakeTransform(3.0f).rotate, MakeTransform(3.0f).translate));
+}
+
+///=============================================================================
+///						使い回したハンドルは前のノードの状態を引き継がない
+TEST_CASE(TransformHierarchy_ReusedHandleStartsFresh) {
+	TransformHierarchy hierarchy;
+	uint32_t root = hierarchy.Create(MakeTransform(1.0f));
+	uint32_t old = hierarchy.Create(MakeTransform(2.0f), root);
+	uint32_t oldChild = hierarchy.Create(MakeTransform(3.0f), old);
+	for(int i = 0; i < 3; ++i) {
+		hierarchy.SetLocalTransform(old, MakeTransform(2.0f + i));
+		hierarchy.UpdateWorldMatrices();
+	}
+	CHECK(hierarchy.GetWorldVersion(old) == 3);
+
+	//========================================
+	// 印がついたまま消して、同じハンドルで作り直す
+	hierarchy.SetLocalTransform(old, MakeTransform(9.0f));
+	hierarchy.Destroy(old);
+	uint32_t reused = hierarchy.Create(MakeTransform(6.0f));
+	CHECK(reused == old);
+	// 求める前は版も行列も初期値
+	CHECK(hierarchy.GetWorldVersion(reused) == 0);
+	CHECK(hierarchy.GetWorldMatrix(reused) == Identity4x4());
+	CHECK(hierarchy.GetParent(reused) == kRoot);
+	CHECK(hierarchy.GetLocalTransform(reused).translate.x == MakeTransform(6.0f).translate.x);
+	// 前のノードの子は前のノードの親につながったまま
+	CHECK(hierarchy.GetParent(oldChild) == root);
+
+	hierarchy.UpdateWorldMatrices();
+	CHECK(hierarchy.GetWorldVersion(reused) == 1);
+	std::vector<uint32_t> handles = { root, reused, oldChild };
+	CHECK(MatchesExpected(hierarchy, handles));
+
+	//========================================
+	// 変更がなければ何もしない(使い回したハンドルが印を残していない)
+	hierarchy.ResetUpdatedCount();
+	hierarchy.UpdateWorldMatrices();
+	CHECK(hierarchy.GetUpdatedCount() == 0);
+	CHECK(hierarchy.GetWorldVersion(reused) == 1);
+
+	//========================================
+	// 求める前に消して作り直しても同じ
+	hierarchy.Destroy(reused);
+	uint32_t again = hierarchy.Create(MakeTransform(7.0f), oldChild);
+	CHECK(again == reused);
+	CHECK(hierarchy.GetWorldVersion(again) == 0);
+	hierarchy.UpdateWorldMatrices();
+	CHECK(hierarchy.GetWorldVersion(again) == 1);
+	handles = { root, oldChild, again };
+	CHECK(MatchesExpected(hierarchy, handles));
+}
+
+///=============================================================================
+///						版は変更した部分木だけ上がる
+TEST_CASE(TransformHierarchy_WorldVersionBumpsOnlyChangedSubtree) {
+	TransformHierarchy hierarchy;
+	uint32_t root = hierarchy.Create(MakeTransform(1.0f));
+	uint32_t left = hierarchy.Create(MakeTransform(2.0f), root);
+	uint32_t leftChild = hierarchy.Create(MakeTransform(3.0f), left);
+	uint32_t right = hierarchy.Create(MakeTransform(4.0f), root);
+	uint32_t rightChild = hierarchy.Create(MakeTransform(5.0f), right);
+	uint32_t other = hierarchy.Create(MakeTransform(6.0f));
+	std::vector<uint32_t> handles = { root, left, leftChild, right, rightChild, other };
+	hierarchy.UpdateWorldMatrices();
+	for(uint32_t handle : handles) {
+		CHECK(hierarchy.GetWorldVersion(handle) == 1);
+	}
+
+	//========================================
+	// 左の部分木だけ
+	hierarchy.ResetUpdatedCount();
+	hierarchy.SetLocalTransform(left, MakeTransform(7.0f));
+	// 部分木の中で重ねて印をつけても1回だけ求める
+	hierarchy.SetLocalTransform(leftChild, MakeTransform(8.0f));
+	hierarchy.UpdateWorldMatrices();
+	CHECK(hierarchy.GetUpdatedCount() == 2);
+	CHECK(hierarchy.GetWorldVersion(left) == 2);
+	CHECK(hierarchy.GetWorldVersion(leftChild) == 2);
+	CHECK(hierarchy.GetWorldVersion(root) == 1);
+	CHECK(hierarchy.GetWorldVersion(right) == 1);
+	CHECK(hierarchy.GetWorldVersion(rightChild) == 1);
+	CHECK(hierarchy.GetWorldVersion(other) == 1);
+	CHECK(MatchesExpected(hierarchy, handles));
+
+	//========================================
+	// 付け替えは移した部分木だけ
+	hierarchy.ResetUpdatedCount();
+	hierarchy.SetParent(right, other);
+	hierarchy.UpdateWorldMatrices();
+	CHECK(hierarchy.GetUpdatedCount() == 2);
+	CHECK(hierarchy.GetWorldVersion(right) == 2);
+	CHECK(hierarchy.GetWorldVersion(rightChild) == 2);
+	CHECK(hierarchy.GetWorldVersion(other) == 1);
+	CHECK(hierarchy.GetWorldVersion(left) == 2);
+	CHECK(MatchesExpected(hierarchy, handles));
+
+	//========================================
+	// ルートは全体
+	hierarchy.ResetUpdatedCount();
+	hierarchy.SetLocalTransform(root, MakeTransform(9.0f));
+	hierarchy.UpdateWorldMatrices();
+	CHECK(hierarchy.GetUpdatedCount() == 3);
+	CHECK(hierarchy.GetWorldVersion(root) == 2);
+	CHECK(hierarchy.GetWorldVersion(left) == 3);
+	CHECK(hierarchy.GetWorldVersion(leftChild) == 3);
+	CHECK(hierarchy.GetWorldVersion(right) == 2);
+	CHECK(MatchesExpected(hierarchy, handles));
+}
+
+///=============================================================================
+///						ばらばらな操作の後も親をたどったものと一致する
+TEST_CASE(TransformHierarchy_RandomOperationsMatchExpected) {
+	TransformHierarchy hierarchy;
+	std::mt19937 random(1234);
+	std::vector<uint32_t> handles;
+	std::vector<uint32_t> versions;
+	bool isMatched = true;
+	bool isVersionMatched = true;
+	for(int step = 0; step < 2000; ++step) {
+		uint32_t operation = handles.size() < 4 ? 0 : random() % 4;
+		uint32_t changed = kRoot;
+		if(operation == 0) {
+			//========================================
+			// 作成(半分はどこかの子)
+			uint32_t parent = handles.empty() || random() % 2 ? kRoot : handles[random() % handles.size()];
+			handles.push_back(hierarchy.Create(MakeTransform(static_cast<float>( step % 17 )), parent));
+			changed = handles.back();
+		} else if(operation == 1) {
+			//========================================
+			// 削除(子は祖父母へ移るので、その子たちの部分木が変わる)
+			size_t position = random() % handles.size();
+			hierarchy.Destroy(handles[position]);
+			handles.erase(handles.begin() + position);
+		} else if(operation == 2) {
+			//========================================
+			// 付け替え(子孫は親にできないのでルートにする)
+			uint32_t handle = handles[random() % handles.size()];
+			uint32_t parent = random() % 4 == 0 ? kRoot : handles[random() % handles.size()];
+			if(parent != kRoot && IsInSubtree(hierarchy, parent, handle)) {
+				parent = kRoot;
+			}
+			if(hierarchy.GetParent(handle) != parent) {
+				changed = handle;
+			}
+			hierarchy.SetParent(handle, parent);
+		} else {
+			uint32_t handle = handles[random() % handles.size()];
+			hierarchy.SetLocalTransform(handle, MakeTransform(static_cast<float>( random() % 13 )));
+			changed = handle;
+		}
+
+		//========================================
+		// 毎回求め直し、変えた部分木だけ版が上がることを確かめる
+		// NOTE:削除はつなぎ替わった子の部分木が変わるので版の比較はしない
+		versions.clear();
+		for(uint32_t handle : handles) {
+			versions.push_back(hierarchy.GetWorldVersion(handle));
+		}
+		hierarchy.UpdateWorldMatrices();
+		if(operation != 1) {
+			for(size_t i = 0; i < handles.size(); ++i) {
+				bool isBumped = hierarchy.GetWorldVersion(handles[i]) != versions[i];
+				bool isChanged = changed != kRoot && IsInSubtree(hierarchy, handles[i], changed);
+				isVersionMatched &= isBumped == isChanged;
+			}
+		}
+		if(step % 16 == 0) {
+			isMatched &= MatchesExpected(hierarchy, handles);
+		}
+	}
+	hierarchy.UpdateWorldMatrices();
+	isMatched &= MatchesExpected(hierarchy, handles);
+	CHECK(isMatched);
+	CHECK(isVersionMatched);
+	CHECK(hierarchy.GetSize() == handles.size());
+}
+
+///=============================================================================
+///						自分の子孫を親にするとassertで止まる
+DEATH_TEST(TransformHierarchy_ParentToDescendantAsserts) {
+	TransformHierarchy hierarchy;
+	uint32_t root = hierarchy.Create(MakeTransform(1.0f));
+	uint32_t child = hierarchy.Create(MakeTransform(2.0f), root);
+	hierarchy.SetParent(root, child);
+}